@@ -41,28 +41,76 @@ namespace ns_olsr2_0
 
  /********************************************************************
   * @function  recv_olsr
-  * @brief     This function stores the attached network information
-  *            received from Gateway
-  * @param     network_table.
+  * @brief     This function queues a packet received by the Gateway
+  *            for the next receive tick
+  * @param     olsr_packet - points to a T_RX_PACKET.
   * @return    None.
-  * @note      None.
+  * @note      The packet is copied, the caller keeps its buffer.
  ********************************************************************/
  void C_OLSR::recv_olsr(void * olsr_packet)
  {
-   ;
+   const T_RX_PACKET* rx_packet = (const T_RX_PACKET*)olsr_packet;
+
+   enqueue_olsr_packet(rx_packet->packet, rx_packet->sender_address, rx_packet->receiver_address, rx_packet->l_in_metric);
  }
 
  /********************************************************************
    * @function  send_olsr_msg
-   * @brief     This function returns the attached network information
-   *            to the Gateway
+   * @brief     This function packs the pending OLSR messages into
+   *            packets and hands them to the transport
    * @param     None.
    * @return    None.
-   * @note      None.
+   * @note      Messages are dropped when no transport is set.
   ********************************************************************/
  void C_OLSR::send_olsr_msg()
  {
-   ;
+   if((m_transport != NULL) and (olsr_msg_list.empty() == false))
+     {
+       C_PACKET_HEADER olsr_packet;
+
+       for(C_MESSAGE_HEADER::OlsrMsgList::const_iterator msg_iter = olsr_msg_list.begin(); msg_iter != olsr_msg_list.end(); msg_iter++)
+         {
+           E_METRIC_COUNTER tx_counter = (msg_iter->get_message_type() == TC_MESSAGE) ? TX_TC_COUNTER : TX_HELLO_COUNTER;
+
+           if(olsr_packet.append_message(*msg_iter) == true)
+             {
+               C_OLSR_METRICS::count(tx_counter);
+               continue;
+             }
+
+           if(olsr_packet.get_packet_length() != 0)
+             {
+               m_transport->send_packet(m_node_address, olsr_packet);
+               olsr_packet.set_packet_length(0);
+             }
+
+           /* A message larger than a packet is dropped */
+           if(olsr_packet.append_message(*msg_iter) == true)
+             {
+               C_OLSR_METRICS::count(tx_counter);
+             }
+         }
+
+       if(olsr_packet.get_packet_length() != 0)
+         {
+           m_transport->send_packet(m_node_address, olsr_packet);
+         }
+     }
+
+   olsr_msg_list.clear();
+ }
+
+ /********************************************************************
+   * @function  set_transport
+   * @brief     This function sets the transport of the packets sent
+   *            by this instance
+   * @param     transport.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+ void C_OLSR::set_transport(C_OLSR_TRANSPORT* transport)
+ {
+   m_transport = transport;
  }
 
 #ifdef M_TO_BE_DELETED
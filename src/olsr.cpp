@@ -20,7 +20,18 @@
  */
 #include <iostream>
 
+#include <cstdlib>
+#include <string>
+#include <fstream>
+#include <csignal>
 #include "olsr.hpp"
+#include "olsr_host.hpp"
+#include "olsr_emulator.hpp"
+#include "olsr_benchmark.hpp"
+#include "olsr_load_generator.hpp"
+#include "olsr_udp_driver.hpp"
+#include "olsr_self_check.hpp"
+#include "olsr_control_server.hpp"
 
 using namespace std;
 
@@ -41,6 +52,21 @@ namespace ns_olsr2_0
 
     m_op_state = INIT_STATE;
 
+    m_is_node_addr_set = false;
+    m_transport = NULL;
+
+    m_scheduler = &m_own_scheduler;
+    m_timer_generation.fill(0);
+    m_timer_pending.fill(false);
+    m_expiry_deadline = M_TIME_INFINITE;
+    m_hello_deadline = M_TIME_INFINITE;
+    m_tc_deadline = M_TIME_INFINITE;
+    m_recompute_pending = false;
+    m_last_recompute = 0;
+    m_mpr_dirty = false;
+    m_routes_dirty = false;
+    m_advertised_change_count = 0;
+
   }
 
 
@@ -50,11 +76,12 @@ namespace ns_olsr2_0
    * @brief     This is a destructor of C_OLSR_ROUTING_PROTOCOL class
    * @param     interface_ip.
    * @return    None.
-   * @note      None.
+   * @note      The timers are dropped from a shared scheduler, which
+   *            outlives the instance.
   ********************************************************************/
   C_OLSR::~C_OLSR()
   {
-
+    remove_timers();
   }
 
   /********************************************************************
@@ -67,17 +94,19 @@ namespace ns_olsr2_0
   ********************************************************************/
   void C_OLSR::init(ns_olsr2_0::E_OLSR_INSTANCE instance_type)
   {
-      cout << "OLSR instance : " << instance_type << endl;
+      M_LOG_INFO("OLSR instance : {}", instance_type);
       if(m_op_state == INIT_STATE)
         {
           this->m_state.init_state_tuples();
 
-          cout << "OLSR Operational State = " << this->getOperationState() << endl;
+          M_LOG_INFO("OLSR Operational State = {}", this->getOperationState());
 
           this->init_op(instance_type);
 
+          this->start_timers();
+
           m_op_state = RUN_STATE;
-          cout << "OLSR Operational State = " << this->getOperationState() << endl;
+          M_LOG_INFO("OLSR Operational State = {}", this->getOperationState());
         }
 
       else
@@ -98,12 +127,15 @@ namespace ns_olsr2_0
    {
        if(m_op_state == RUN_STATE)
          {
-           send_hello();
-           /* TBD - send_tc(); */
+           /* The time is sampled once per iteration, all processing below reads the cached value */
+           get_olsr_clock()->update();
+
+           process_rx_queue();
 
-           this->m_state.check_tables_timeout();
+           /* HELLO and TC transmission, tuple expiry and recomputation are driven by the timers */
+           m_scheduler->run_due(get_cur_time());
 
-           cout << "OLSR is inside run state "<< endl;
+           M_LOG_TRACE("OLSR is inside run state");
          }
 
        else
@@ -134,6 +166,430 @@ namespace ns_olsr2_0
      }
 
   }
+  /********************************************************************
+   * @function  next_deadline
+   * @brief     This function returns the time of the next pending
+   *            timer of the scheduler used by this instance.
+   * @param     None.
+   * @return    Deadline, M_TIME_INFINITE if nothing is pending.
+   * @note      The host can sleep until then or until a packet is
+   *            received.
+  ********************************************************************/
+  Time C_OLSR::next_deadline(void)
+  {
+    return m_scheduler->next_deadline();
+  }
+
+  /********************************************************************
+   * @function  set_scheduler
+   * @brief     This function moves the timers of this instance to a
+   *            scheduler shared with other instances.
+   * @param     scheduler.
+   * @return    None.
+   * @note      With a shared scheduler the host runs the scheduler
+   *            instead of calling run() on each instance. The previous
+   *            scheduler keeps no entry of this instance.
+  ********************************************************************/
+  void C_OLSR::set_scheduler(C_OLSR_SCHEDULER* scheduler)
+  {
+    remove_timers();
+
+    m_scheduler = (scheduler != NULL) ? scheduler : &m_own_scheduler;
+
+    if(m_op_state == RUN_STATE)
+      {
+        start_timers();
+      }
+  }
+
+  /********************************************************************
+   * @function  start_timers
+   * @brief     This function schedules the periodic HELLO and TC
+   *            timers with an initial jitter.
+   * @param     None.
+   * @return    None.
+   * @note      Timers pending from a previous run are cancelled.
+  ********************************************************************/
+  void C_OLSR::start_timers(void)
+  {
+    Time cur_time = get_cur_time();
+
+    m_hello_deadline = cur_time + get_jitter(m_hello_interval);
+    m_tc_deadline = cur_time + get_jitter(m_tc_interval);
+    schedule_timer(HELLO_TIMER, m_hello_deadline);
+    schedule_timer(TC_TIMER, m_tc_deadline);
+
+    cancel_timer(EXPIRY_TIMER);
+    cancel_timer(RECOMPUTE_TIMER);
+    m_expiry_deadline = M_TIME_INFINITE;
+    m_recompute_pending = false;
+
+    schedule_expiry_timer();
+  }
+
+  /********************************************************************
+   * @function  schedule_timer
+   * @brief     This function schedules a timer, a pending one of the
+   *            same type is cancelled.
+   * @param     event, deadline.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR::schedule_timer(E_TIMER_EVENT event, Time deadline)
+  {
+    cancel_timer(event);
+    m_scheduler->schedule(this, event, deadline, m_timer_generation[event]);
+    m_timer_pending[event] = true;
+  }
+
+  /********************************************************************
+   * @function  cancel_timer
+   * @brief     This function cancels a pending timer.
+   * @param     event.
+   * @return    None.
+   * @note      The entry stays in the heap with an older generation,
+   *            the scheduler counts it to compact the heap.
+  ********************************************************************/
+  void C_OLSR::cancel_timer(E_TIMER_EVENT event)
+  {
+    m_timer_generation[event]++;
+
+    if(m_timer_pending[event] == true)
+      {
+        m_timer_pending[event] = false;
+        m_scheduler->cancel();
+      }
+  }
+
+  /********************************************************************
+   * @function  remove_timers
+   * @brief     This function drops the timers of this instance from
+   *            its scheduler.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR::remove_timers(void)
+  {
+    m_scheduler->remove_node(this);
+    m_timer_pending.fill(false);
+  }
+
+  /********************************************************************
+   * @function  get_jitter
+   * @brief     This function returns a random jitter between zero and
+   *            a quarter of the interval, as per RFC 5148.
+   * @param     interval.
+   * @return    jitter.
+   * @note      None.
+  ********************************************************************/
+  Time C_OLSR::get_jitter(Time interval)
+  {
+    std::uniform_int_distribution<Time> jitter_dist(0, interval / M_MAX_JITTER_DIVISOR);
+
+    return jitter_dist(m_jitter_rng);
+  }
+
+  /********************************************************************
+   * @function  request_recomputation
+   * @brief     This function marks the MPRs and/or the routing table
+   *            as outdated and schedules a single recomputation.
+   * @param     mpr, routes.
+   * @return    None.
+   * @note      All changes made before the timer fires are handled by
+   *            one recomputation. The timer fires at once after a quiet
+   *            period, and M_RECOMPUTE_MIN_INTERVAL after the previous
+   *            recomputation during a burst of changes.
+  ********************************************************************/
+  void C_OLSR::request_recomputation(T_BOOL mpr, T_BOOL routes)
+  {
+    m_mpr_dirty = (m_mpr_dirty or mpr);
+    m_routes_dirty = (m_routes_dirty or routes);
+
+    if(m_recompute_pending == false)
+      {
+        m_recompute_pending = true;
+        schedule_timer(RECOMPUTE_TIMER, std::max(get_cur_time(), m_last_recompute + M_RECOMPUTE_MIN_INTERVAL));
+      }
+  }
+
+  /********************************************************************
+   * @function  schedule_expiry_timer
+   * @brief     This function moves the expiry timer to the earliest
+   *            tuple expiry when that is earlier than the pending one.
+   * @param     None.
+   * @return    None.
+   * @note      Nothing is scheduled while the state holds no tuple
+   *            with a validity time.
+  ********************************************************************/
+  void C_OLSR::schedule_expiry_timer(void)
+  {
+    Time next_expiry = m_state.get_next_expiry();
+
+    if(next_expiry < m_expiry_deadline)
+      {
+        m_expiry_deadline = next_expiry;
+        schedule_timer(EXPIRY_TIMER, next_expiry);
+      }
+  }
+
+  /********************************************************************
+   * @function  schedule_hello_timer
+   * @brief     This function schedules the next HELLO one current
+   *            interval minus a jitter after cur_time.
+   * @param     cur_time.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR::schedule_hello_timer(Time cur_time)
+  {
+    m_hello_deadline = cur_time + m_hello_interval - get_jitter(m_hello_interval);
+    schedule_timer(HELLO_TIMER, m_hello_deadline);
+  }
+
+  /********************************************************************
+   * @function  schedule_tc_timer
+   * @brief     This function schedules the next TC one current
+   *            interval minus a jitter after cur_time.
+   * @param     cur_time.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR::schedule_tc_timer(Time cur_time)
+  {
+    m_tc_deadline = cur_time + m_tc_interval - get_jitter(m_tc_interval);
+    schedule_timer(TC_TIMER, m_tc_deadline);
+  }
+
+  /********************************************************************
+   * @function  note_churn
+   * @brief     This function returns the HELLO and/or TC interval to
+   *            its minimum after a link loss, a new neighbor or a
+   *            topology change, and brings forward a pending message
+   *            scheduled beyond the minimum interval.
+   * @param     neighborhood - the link or neighbor set changed.
+   *            topology - the advertised or the router topology
+   *            changed.
+   * @return    None.
+   * @note      A neighborhood change also changes the advertised
+   *            neighbors, so it shrinks both intervals. Both cover
+   *            the advertised set changes made until then.
+  ********************************************************************/
+  void C_OLSR::note_churn(T_BOOL neighborhood, T_BOOL topology)
+  {
+    Time cur_time = get_cur_time();
+
+    if((neighborhood == true) or (topology == true))
+      {
+        m_advertised_change_count = m_state.get_advertised_change_count();
+      }
+
+    if(m_op_state != RUN_STATE)
+      {
+        return;
+      }
+
+    if(neighborhood == true)
+      {
+        m_hello_adaptive.note_change();
+        m_hello_interval = m_hello_adaptive.get_interval();
+
+        if(m_hello_deadline > cur_time + m_hello_interval)
+          {
+            schedule_hello_timer(cur_time);
+          }
+      }
+
+    if((neighborhood == true) or (topology == true))
+      {
+        m_tc_adaptive.note_change();
+        m_tc_interval = m_tc_adaptive.get_interval();
+
+        if(m_tc_deadline > cur_time + m_tc_interval)
+          {
+            schedule_tc_timer(cur_time);
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  note_advertised_churn
+   * @brief     This function notes a change of the advertised set not
+   *            noted yet as a topology change, so that the next TC
+   *            carrying it is brought forward.
+   * @param     None.
+   * @return    None.
+   * @note      The state counts the changes, the count read by the
+   *            last note_churn tells the ones already noted.
+  ********************************************************************/
+  void C_OLSR::note_advertised_churn(void)
+  {
+    if(m_state.get_advertised_change_count() != m_advertised_change_count)
+      {
+        note_churn(false, true);
+      }
+  }
+
+  /********************************************************************
+   * @function  set_interval_config
+   * @brief     This function sets the bounds of the adaptive HELLO and
+   *            TC intervals, both restart from their minimum.
+   * @param     hello_config, tc_config.
+   * @return    None.
+   * @note      Equal min_interval and max_interval disable the
+   *            adaptation of that message.
+  ********************************************************************/
+  void C_OLSR::set_interval_config(const T_INTERVAL_CONFIG& hello_config, const T_INTERVAL_CONFIG& tc_config)
+  {
+    m_hello_adaptive.set_config(hello_config);
+    m_tc_adaptive.set_config(tc_config);
+    m_hello_interval = m_hello_adaptive.get_interval();
+    m_tc_interval = m_tc_adaptive.get_interval();
+  }
+
+  /********************************************************************
+   * @function  handle_timer
+   * @brief     This function runs the work of a fired timer and
+   *            schedules its next occurrence.
+   * @param     event.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR::handle_timer(E_TIMER_EVENT event)
+  {
+    Time cur_time = get_cur_time();
+
+    m_timer_pending[event] = false;
+
+    switch(event)
+    {
+      case HELLO_TIMER:
+        m_hello_interval = m_hello_adaptive.next_interval();
+        send_hello();
+        send_olsr_msg();
+        schedule_hello_timer(cur_time);
+        break;
+
+      case TC_TIMER:
+        m_tc_interval = m_tc_adaptive.next_interval();
+        send_tc();
+        send_olsr_msg();
+        schedule_tc_timer(cur_time);
+        break;
+
+      case EXPIRY_TIMER:
+        m_expiry_deadline = M_TIME_INFINITE;
+        if(m_state.check_tables_timeout() == true)
+          {
+            request_recomputation(true, true);
+            note_churn(true, true);
+          }
+        break;
+
+      case RECOMPUTE_TIMER:
+        m_recompute_pending = false;
+        m_last_recompute = cur_time;
+        if(m_mpr_dirty == true)
+          {
+            m_mpr_dirty = false;
+            mpr_computation();
+          }
+        if(m_routes_dirty == true)
+          {
+            m_routes_dirty = false;
+            routing_table_computation();
+          }
+        break;
+
+      default:
+        break;
+    }
+
+    /* The expiry and the MPR computation may change the advertised set */
+    note_advertised_churn();
+
+    schedule_expiry_timer();
+
+    publish_set_sizes();
+
+    serve_state_snapshot();
+  }
+
+  /********************************************************************
+   * @function  publish_set_sizes
+   * @brief     This function updates the set size gauges of the metrics
+   *            with the sizes of this instance.
+   * @param     None.
+   * @return    None.
+   * @note      Called after the sets changed, only the changes are
+   *            added to the gauges.
+  ********************************************************************/
+  void C_OLSR::publish_set_sizes(void)
+  {
+    m_set_gauges.set(LINK_SET_GAUGE, m_state.get_links().size());
+    m_set_gauges.set(NEIGHBOUR_SET_GAUGE, m_state.get_one_hop_neighbors().size());
+    m_set_gauges.set(TWO_HOP_SET_GAUGE, m_state.get_two_hop_neighbours().size());
+    m_set_gauges.set(ADVERTISING_ROUTER_SET_GAUGE, m_state.get_advertising_remote_router_set().size());
+    m_set_gauges.set(ROUTER_TOPOLOGY_SET_GAUGE, m_state.get_router_topology_count());
+    m_set_gauges.set(PROCESSED_MSG_SET_GAUGE, m_state.get_processed_msgs().size());
+    m_set_gauges.set(FORWARDED_MSG_SET_GAUGE, m_state.get_forwarded_msgs().size());
+  }
+
+  /********************************************************************
+   * @function  take_state_snapshot
+   * @brief     This function copies the information bases of this
+   *            instance.
+   * @param     None.
+   * @return    Snapshot.
+   * @note      Only call it from the thread running this instance, the
+   *            copy is consistent because no message is processed
+   *            meanwhile.
+  ********************************************************************/
+  std::shared_ptr<T_STATE_SNAPSHOT> C_OLSR::take_state_snapshot(void)
+  {
+    std::shared_ptr<T_STATE_SNAPSHOT> snapshot = std::make_shared<T_STATE_SNAPSHOT>();
+
+    snapshot->sequence = 0;
+    snapshot->node_address = m_node_address;
+    snapshot->time = get_cur_time();
+    snapshot->ansn = m_ansn;
+    snapshot->link_set = m_state.get_links();
+    snapshot->neighbour_set = m_state.get_one_hop_neighbors();
+    snapshot->two_hop_neighbour_set = m_state.get_two_hop_neighbours();
+    snapshot->advertising_remote_router_set = m_state.get_advertising_remote_router_set();
+    m_state.for_each_router_topology_tuple([&](const T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab, const T_ROUTER_TOPOLOGY_TUPLE& tuple)
+      {
+        snapshot->router_topology_set.push_back(tuple);
+        snapshot->router_topology_set.back().tr_time = slab.ar_time;
+      });
+
+    for(const auto& route : m_state.get_routing_table())
+      {
+        snapshot->routing_set.push_back(route.second);
+      }
+
+    return snapshot;
+  }
+
+  /********************************************************************
+   * @function  serve_state_snapshot
+   * @brief     This function publishes a snapshot when another thread
+   *            requested one.
+   * @param     None.
+   * @return    None.
+   * @note      Called between messages and timers. Without a request
+   *            it costs two relaxed loads; with one, only the copy of
+   *            the sets, the serialization runs on the requesting
+   *            thread.
+  ********************************************************************/
+  void C_OLSR::serve_state_snapshot(void)
+  {
+    if(m_introspection.is_requested() == true)
+      {
+        m_introspection.publish(take_state_snapshot());
+      }
+  }
+
   /********************************************************************
    * @function  init_op
    * @brief     This is an entry point function for initializing OLSR
@@ -147,17 +603,27 @@ namespace ns_olsr2_0
     T_ADDR loc_node_addr;
 
     loc_node_addr = this->get_node_address();
+
+    /* An address set before init overrides the one given by the Gateway */
+    if(m_is_node_addr_set == true)
+    {
+        loc_node_addr.field.m_oid = m_node_address.net_id;
+        loc_node_addr.field.m_nid = m_node_address.node_id;
+    }
+
     if(inst_type == NORMAL_NODE_INSTANCE)
     {
-        m_node_address.net_id = loc_node_addr.field.m_oid;
-        m_node_address.node_id = loc_node_addr.field.m_nid;
+        if(m_is_node_addr_set == false)
+        {
+            m_node_address.net_id = loc_node_addr.field.m_oid;
+            m_node_address.node_id = loc_node_addr.field.m_nid;
+        }
 
-        cout << "Normal Node address.netId = " << m_node_address.net_id<< endl;
-        cout << "Normal Node address.nodeId = " << m_node_address.node_id<< endl;
+        M_LOG_INFO("Normal Node address = {}.{}", m_node_address.net_id, m_node_address.node_id);
         m_is_leader = false;
         m_instance = NORMAL_NODE_INSTANCE;
 
-        cout << "Leader status : " << m_is_leader << endl;
+        M_LOG_INFO("Leader status : {}", m_is_leader);
 
         if(get_is_leader() == true)
           {
@@ -173,24 +639,43 @@ namespace ns_olsr2_0
     }
     else if(inst_type == LEADER_NODE_INSTANCE)
     {
-        m_node_address.net_id = loc_node_addr.field.m_oid;
+        if(m_is_node_addr_set == false)
+        {
+            m_node_address.net_id = loc_node_addr.field.m_oid;
+        }
         m_node_address.node_id = 0x0;
 
         if((get_is_leader() == true) ? (m_is_leader = true):(m_is_leader = false))
 
-        cout << "Leader Node address.netId = " << m_node_address.net_id<< endl;
-        cout << "Leader Node address.nodeId = " << m_node_address.node_id<< endl;
+        M_LOG_INFO("Leader Node address = {}.{}", m_node_address.net_id, m_node_address.node_id);
 
 
-        cout << "Leader status : " << m_is_leader << endl;
+        M_LOG_INFO("Leader status : {}", m_is_leader);
         m_instance = LEADER_NODE_INSTANCE;
     }
 
 
     m_willingness.willingness = this->get_willingness();
 
-    cout << "routing_willingness = " << m_willingness.fields.route_will << endl;
-    cout << "flooding_willingness = " << m_willingness.fields.flood_will << endl;
+    m_message_sequence_number = 0;
+    m_ansn = 0;
+    m_empty_tc_deadline = 0;
+    olsr_msg_list.reserve(M_MSG_LIST_CAPACITY);
+    T_INTERVAL_CONFIG hello_config, tc_config;
+
+    hello_config.min_interval = M_HELLO_INTERVAL * M_MSEC_PER_SEC;
+    hello_config.max_interval = M_HELLO_MAX_INTERVAL * M_MSEC_PER_SEC;
+    hello_config.stretch_percent = M_INTERVAL_STRETCH_PERCENT;
+    hello_config.stable_periods = M_INTERVAL_STABLE_PERIODS;
+
+    tc_config = hello_config;
+    tc_config.min_interval = M_TC_INTERVAL * M_MSEC_PER_SEC;
+    tc_config.max_interval = M_TC_MAX_INTERVAL * M_MSEC_PER_SEC;
+
+    set_interval_config(hello_config, tc_config);
+    m_jitter_rng.seed(((m_node_address.net_id << 8) | m_node_address.node_id) + 1);
+
+    M_LOG_INFO("routing_willingness = {}, flooding_willingness = {}", m_willingness.fields.route_will, m_willingness.fields.flood_will);
 
     /* TBD  - Subscription to Gateway component */
 
@@ -229,7 +714,7 @@ template <typename T>
 
   T_UINT16 C_OLSR::get_next_msg_seq_num(void)
   {
-    m_message_sequence_number += (m_message_sequence_number + 1) % (M_MAX_MSG_SEQ_NUM + 1);
+    m_message_sequence_number = (m_message_sequence_number + 1) % (M_MAX_MSG_SEQ_NUM + 1);
     return m_message_sequence_number;
   }
 
@@ -245,12 +730,12 @@ template <typename T>
     if((leader_tuple != NULL) and (leader_tuple->is_leader == true))
     {
       hello_msg.leader_info = *leader_tuple;
-      cout << "Leader node set in Hello message" << endl;
+      M_LOG_DEBUG("Leader node set in Hello message");
     }
     else
     {
       hello_msg.leader_info.is_leader = false;
-      cout << "Leader node not set in Hello message" << endl;
+      M_LOG_DEBUG("Leader node not set in Hello message");
     }
   }
 
@@ -268,26 +753,41 @@ template <typename T>
   }
 
   /********************************************************************
-      * @function  set_common_address
-      * @brief     This function increments the message sequence
-      *            number and sends
-      * @return    None.
-      * @note      None.
+      * @function  check_message_validity
+      * @brief     This function checks the common header of a received
+      *            message and tells whether it has to be dropped
+      *            before its address blocks are decoded.
+      * @param     raw_header.
+      * @return    true if the message has expired TTL, is originated by
+      *            this node, is of unknown type or is already processed.
+      * @note      A duplicate message refreshes its processed tuple.
   ********************************************************************/
-  T_BOOL C_OLSR::check_message_validity(const C_MESSAGE_HEADER& msg_header)
+  T_BOOL C_OLSR::check_message_validity(const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header)
   {
-    T_BOOL return_status = false;
-
-    if (msg_header.get_time_to_live () == 0)
+    if (raw_header.time_to_live == 0)
+    {
+        C_OLSR_METRICS::count(TTL_DROP_COUNTER);
+        return true;
+    }
+    if(raw_header.orig_addr == this->get_node_addr())
+    {
+      return true;
+    }
+    if((raw_header.msg_type != HELLO_MESSAGE) and (raw_header.msg_type != TC_MESSAGE))
     {
-        return_status = true;
+      return true;
     }
-    if(msg_header.get_originator_address() == this->get_node_addr())
+
+    T_PROCESSED_MSG_TUPLE* processed_tuple = this->m_state.find_processed_msg_tuple (raw_header.orig_addr, raw_header.seq_num);
+
+    if(processed_tuple != NULL)
     {
-      return_status = true;
+      C_OLSR_METRICS::count(DUPLICATE_DROP_COUNTER);
+      processed_tuple->p_time = get_cur_time() + ((Time)raw_header.validity_time * M_MSEC_PER_SEC);
+      return true;
     }
 
-    return return_status;
+    return false;
   }
 
   /********************************************************************
@@ -300,7 +800,7 @@ template <typename T>
   T_PROCESSED_MSG_TUPLE
   C_OLSR::create_processed_msg_tuple(const C_MESSAGE_HEADER& msg_header)
   {
-    T_PROCESSED_MSG_TUPLE new_proc_msg_tuple;
+    T_PROCESSED_MSG_TUPLE new_proc_msg_tuple = T_PROCESSED_MSG_TUPLE();
     Time cur_time = get_cur_time();
 
     new_proc_msg_tuple.p_orig_addr = msg_header.get_originator_address();
@@ -321,7 +821,7 @@ template <typename T>
   T_FORWARDED_MSG_TUPLE
   C_OLSR::create_forwarded_msg_tuple(const C_MESSAGE_HEADER& msg_header)
   {
-    T_FORWARDED_MSG_TUPLE new_fwd_msg_tuple;
+    T_FORWARDED_MSG_TUPLE new_fwd_msg_tuple = T_FORWARDED_MSG_TUPLE();
     Time cur_time = get_cur_time();
 
     new_fwd_msg_tuple.f_orig_addr = msg_header.get_originator_address();
@@ -341,8 +841,11 @@ template <typename T>
   T_LINK_TUPLE
   C_OLSR::create_new_link_tuple(const C_MESSAGE_HEADER& msg_header, Time cur_time, float in_metric)
   {
-    T_LINK_TUPLE new_link_tuple;
+    T_LINK_TUPLE new_link_tuple = T_LINK_TUPLE ();
+
+    /* Inserted fully built, the state derives the flooding selector bit on insertion */
     new_link_tuple.l_neighbor_iface_addr = msg_header.get_originator_address ();
+    new_link_tuple.l_heard_time = cur_time + msg_header.get_validity_time ();
     new_link_tuple.l_sym_time = cur_time - 1;
     new_link_tuple.l_time = cur_time + msg_header.get_validity_time ();
     new_link_tuple.l_in_metric = in_metric;
@@ -387,7 +890,7 @@ template <typename T>
   ********************************************************************/
   void C_OLSR::populate_two_hop_set()
   {
-    ;
+    M_PHASE_TIMER(TWO_HOP_SET_PHASE);
   }
 
   /********************************************************************
@@ -403,21 +906,55 @@ template <typename T>
 
     const LinkSet &link_set = this->m_state.get_links();
 
+#ifdef M_TUPLE_COLUMNS
+    T_MATCH_MASK sym_mask;
+    T_MATCH_MASK heard_mask;
+
+    this->m_state.get_link_columns().get_symmetric_mask(cur_time, sym_mask);
+    this->m_state.get_link_columns().get_heard_mask(cur_time, heard_mask);
+#endif
+
     for(LinkSet::const_iterator link_set_iter = link_set.begin() ; link_set_iter != link_set.end() ; link_set_iter++)
     {
-        T_LINK_TUPLE link_tuple = *link_set_iter;
+        const T_LINK_TUPLE& link_tuple = *link_set_iter;
+#ifdef M_TUPLE_COLUMNS
+        T_BOOL symmetric = get_match(sym_mask, link_set_iter - link_set.begin());
+        T_BOOL heard = get_match(heard_mask, link_set_iter - link_set.begin());
+#else
+        T_BOOL symmetric = (link_tuple.l_sym_time >= cur_time);
+        T_BOOL heard = (link_tuple.l_heard_time >= cur_time);
+#endif
+
+        /* Only the neighbors sharing the common part of the address can be listed */
+        if(hello_msg.abf == E_ADDRESS_BLOCK_FLAGS::NET_ID_COMMON)
+          {
+            if(link_tuple.l_neighbor_iface_addr.net_id != hello_msg.common_id)
+              {
+                continue;
+              }
+            nbr_addr_block.unique_id = link_tuple.l_neighbor_iface_addr.node_id;
+          }
+        else
+          {
+            if(link_tuple.l_neighbor_iface_addr.node_id != hello_msg.common_id)
+              {
+                continue;
+              }
+            nbr_addr_block.unique_id = link_tuple.l_neighbor_iface_addr.net_id;
+          }
 
-        if((link_tuple.l_in_metric > 0) and (link_tuple.l_out_metric > 0))
+        /* The out metric is learnt from the neighbor's HELLO, a link heard only once is advertised without it */
+        if(link_tuple.l_in_metric > 0)
           {
             nbr_addr_block.metric[1] = link_tuple.l_in_metric;
             nbr_addr_block.metric[0] = link_tuple.l_out_metric;
 
-            if(link_tuple.l_sym_time >= cur_time)
+            if(symmetric == true)
             {
                 nbr_addr_block.common_field.link_state.type_fields.link_type = SYMMETRIC_LINK;
             }
 
-            else if (link_tuple.l_heard_time >= cur_time)
+            else if (heard == true)
             {
                 nbr_addr_block.common_field.link_state.type_fields.link_type = HEARD_LINK;
             }
@@ -426,43 +963,38 @@ template <typename T>
                 nbr_addr_block.common_field.link_state.type_fields.link_type = LOST_LINK;
             }
 
-            const NeighbourSet &neighb_set = this->m_state.get_one_hop_neighbors();
+            const T_NEIGHBOUR_TUPLE* neighb_tuple = this->m_state.find_neighbour_tuple(link_tuple.l_neighbor_iface_addr);
             T_BOOL to_be_added = false;
-            for(NeighbourSet::const_iterator neighb_set_iter = neighb_set.begin(); neighb_set_iter != neighb_set.end(); neighb_set_iter++)
-            {
-                T_NEIGHBOUR_TUPLE neighb_tuple = *neighb_set_iter;
-
-                if(link_tuple.l_neighbor_iface_addr == neighb_tuple.n_neighbor_addr)
-                  {
-                    if((neighb_tuple.n_routing_mpr == true) and (neighb_tuple.n_flooding_mpr == true))
-                    {
-                        nbr_addr_block.common_field.link_state.type_fields.nbr_type = MPR_FLOOD_ROUTE;
-                    }
-                    else if(neighb_tuple.n_routing_mpr == true)
-                    {
-                        nbr_addr_block.common_field.link_state.type_fields.nbr_type = ROUTING_MPR;
-                    }
-                    else if(neighb_tuple.n_flooding_mpr == true)
-                    {
-                        nbr_addr_block.common_field.link_state.type_fields.nbr_type = FLOODING_MPR;
-                    }
-                    else if(neighb_tuple.n_symmetric == true)
-                    {
-                        nbr_addr_block.common_field.link_state.type_fields.nbr_type = SYMMETRIC_NEIGHBOR;
-                    }
-                    else
-                    {
-                        nbr_addr_block.common_field.link_state.type_fields.nbr_type = NOT_A_NEIGHBOR;
-                    }
-
-                    to_be_added = true;
-                    break;
-                  }
-             }
-            if(to_be_added)
+
+            if(neighb_tuple != NULL)
+              {
+                if((neighb_tuple->n_routing_mpr == true) and (neighb_tuple->n_flooding_mpr == true))
+                {
+                    nbr_addr_block.common_field.link_state.type_fields.nbr_type = MPR_FLOOD_ROUTE;
+                }
+                else if(neighb_tuple->n_routing_mpr == true)
+                {
+                    nbr_addr_block.common_field.link_state.type_fields.nbr_type = ROUTING_MPR;
+                }
+                else if(neighb_tuple->n_flooding_mpr == true)
+                {
+                    nbr_addr_block.common_field.link_state.type_fields.nbr_type = FLOODING_MPR;
+                }
+                else if(neighb_tuple->n_symmetric == true)
+                {
+                    nbr_addr_block.common_field.link_state.type_fields.nbr_type = SYMMETRIC_NEIGHBOR;
+                }
+                else
+                {
+                    nbr_addr_block.common_field.link_state.type_fields.nbr_type = NOT_A_NEIGHBOR;
+                }
+
+                to_be_added = true;
+              }
+            if(to_be_added and (hello_msg.neighbor_set.size() < hello_msg.neighbor_set.max_size()))
             {
               hello_msg.neighbor_set.push_back(nbr_addr_block);
-              cout << "Tuple added to hello message" << endl;
+              M_LOG_TRACE("Tuple added to hello message");
             }
 
 
@@ -481,7 +1013,21 @@ template <typename T>
   {
     if(p_mpr_type == ROUTING_MPR)
       {
+#ifdef M_TUPLE_COLUMNS
+        const NeighbourSet& neighbour_set = m_state.get_one_hop_neighbors();
+        T_MATCH_MASK allowed_mask;
 
+        m_state.get_neighbour_columns().get_routing_allowed_mask(allowed_mask);
+
+        for_each_match(allowed_mask, [&](std::size_t idx)
+          {
+            T_ALLOWED_ONE_HOP_TUPLE new_allowed_nbr_tuple;
+            new_allowed_nbr_tuple.one_hop_neighb_addr = neighbour_set[idx].n_neighbor_addr;
+            new_allowed_nbr_tuple.n_willingness = neighbour_set[idx].n_willingness;
+            new_allowed_nbr_tuple.in_out_metric = neighbour_set[idx].n_in_metric;
+            p_allowed_one_hop_set.push_back(new_allowed_nbr_tuple);
+          });
+#else
         for(NeighbourSet::const_iterator nbr_itr = m_state.get_one_hop_neighbors().begin();
                     nbr_itr != m_state.get_one_hop_neighbors().end(); nbr_itr++)
         {
@@ -496,15 +1042,37 @@ template <typename T>
             }
 
         }
+#endif
 
       }
     else if(p_mpr_type == FLOODING_MPR)
       {
+        Time cur_time = get_cur_time();
+
+#ifdef M_TUPLE_COLUMNS
+        const LinkSet& link_set = m_state.get_links();
+        T_MATCH_MASK allowed_mask;
+
+        m_state.get_link_columns().get_allowed_mask(cur_time, allowed_mask);
+
+        for_each_match(allowed_mask, [&](std::size_t idx)
+          {
+            T_NEIGHBOUR_TUPLE * nbr_tuple = m_state.find_neighbour_tuple(link_set[idx].l_neighbor_iface_addr);
+            if((nbr_tuple != NULL) and (nbr_tuple->n_willingness.fields.flood_will > E_WILLINGNESS::WILL_NEVER))
+              {
+                T_ALLOWED_ONE_HOP_TUPLE new_allowed_link_tuple;
+                new_allowed_link_tuple.one_hop_neighb_addr = link_set[idx].l_neighbor_iface_addr;
+                new_allowed_link_tuple.n_willingness = nbr_tuple->n_willingness;
+                new_allowed_link_tuple.in_out_metric = link_set[idx].l_out_metric;
+                p_allowed_one_hop_set.push_back(new_allowed_link_tuple);
+              }
+          });
+#else
         for(LinkSet::const_iterator link_itr = m_state.get_links().begin();
                 link_itr != m_state.get_links().end(); link_itr++)
         {
 
-          if((link_itr->l_status == SYMMETRIC) and (link_itr->l_out_metric >= 0))
+          if((link_itr->l_status == SYMMETRIC) and (link_itr->l_sym_time >= cur_time) and (link_itr->l_out_metric >= 0))
             {
               T_NEIGHBOUR_TUPLE * nbr_tuple = m_state.find_neighbour_tuple(link_itr->l_neighbor_iface_addr);
               if((nbr_tuple != NULL) and (nbr_tuple->n_willingness.fields.flood_will > E_WILLINGNESS::WILL_NEVER))
@@ -517,6 +1085,7 @@ template <typename T>
                 }
             }
         }
+#endif
 
       }
 
@@ -668,18 +1237,19 @@ template <typename T>
 
     }
 
-  for(RouterTopologySet::const_iterator topology_set_iter = m_state.get_router_topology_set().begin();
-      topology_set_iter != m_state.get_router_topology_set().end(); topology_set_iter++)
+  p_network_topology_graph->router_topology_set.reserve(m_state.get_router_topology_count());
+
+  m_state.for_each_router_topology_tuple([&](const T_ADVERTISING_REMOTE_ROUTER_TUPLE& /* slab */, const T_ROUTER_TOPOLOGY_TUPLE& tuple)
     {
       T_NETWORK_LINK topology_network_link;
 
-      topology_network_link.src_addr = topology_set_iter->tr_from_orig_addr;
-      topology_network_link.dest_addr = topology_set_iter->tr_to_orig_addr;
-      topology_network_link.out_metric = topology_set_iter->tr_metric;
+      topology_network_link.src_addr = tuple.tr_from_orig_addr;
+      topology_network_link.dest_addr = tuple.tr_to_orig_addr;
+      topology_network_link.out_metric = tuple.tr_metric;
 
       p_network_topology_graph->router_topology_set.push_back(topology_network_link);
 
-    }
+    });
 
   }
 
@@ -702,12 +1272,16 @@ template <typename T>
   ********************************************************************/
   void C_OLSR::routing_table_computation(void)
   {
+    M_PHASE_TIMER(ROUTING_TABLE_PHASE);
+    M_TRACE_SPAN("routing_table_computation", m_node_address);
     T_NETWORK_TOPOLOGY_GRAPH network_topology_graph;
 
+    C_OLSR_METRICS::count(ROUTE_COMPUTATION_COUNTER);
+
     create_network_topology_graph(&network_topology_graph);
 
     /* TBD - calculate_routing_table();*/
-    cout << "Completed Routing Tale preparation" << endl;
+    M_LOG_DEBUG("Completed Routing Table preparation");
 
   }
 
@@ -720,6 +1294,10 @@ template <typename T>
   ********************************************************************/
   void C_OLSR::mpr_computation(void)
   {
+    M_PHASE_TIMER(MPR_COMPUTATION_PHASE);
+    M_TRACE_SPAN("mpr_computation", m_node_address);
+    C_OLSR_METRICS::count(MPR_COMPUTATION_COUNTER);
+
     routing_mpr_computation();
     flooding_mpr_computation();
   }
@@ -818,45 +1396,183 @@ template <typename T>
    {
      return true;
    }
-
-   /********************************************************************
-     * @function  get_cur_time
-     * @brief     This function returns the current time
-     * @param     None.
-     * @return    None.
-     * @note      None.
-   ********************************************************************/
-   Time get_cur_time()
-   {
-     Time now = 1;
-     return now;
-   }
 }
 
+/********************************************************************
+ * @function  write_trace_file
+ * @brief     This function stops the tracing and writes the recorded
+ *            events to a file.
+ * @param     trace_file - Output file, NULL when tracing is off.
+ * @return    None.
+ * @note      None.
+********************************************************************/
+static void write_trace_file(const char* trace_file)
+{
+	if(trace_file != NULL)
+	{
+		ns_olsr2_0::C_OLSR_TRACE::set_enabled(false);
+
+		std::ofstream trace_out(trace_file);
 
+		ns_olsr2_0::C_OLSR_TRACE::write_json(trace_out);
+		cout << "Trace events " << ns_olsr2_0::C_OLSR_TRACE::get_event_count() << " written to " << trace_file << endl;
+	}
+}
 
 
-int main()
+int main(int argc, char* argv[])
 {
 
-	cout << "!!!Hello World!!!" << endl; // prints !!!Hello World!!!
+	/* The measurement modes below do not start the logger, its level stays LOG_OFF and the instances are quiet */
 
-	ns_olsr2_0::C_OLSR Normal_Node_Olsr;
-	ns_olsr2_0::C_OLSR Leader_Node_Olsr;
+	/* olsr bench [max_size] [file] writes the micro benchmark results as JSON */
+	if((argc > 1) and (std::string(argv[1]) == "bench"))
+	{
+		ns_olsr2_0::C_OLSR_BENCHMARK benchmark(M_BENCH_MIN_SIZE, (argc > 2) ? strtoul(argv[2], NULL, 10) : M_BENCH_MAX_SIZE);
 
-	Normal_Node_Olsr.init(ns_olsr2_0::E_OLSR_INSTANCE::NORMAL_NODE_INSTANCE);
+		benchmark.run();
 
-	Leader_Node_Olsr.init(ns_olsr2_0::E_OLSR_INSTANCE::LEADER_NODE_INSTANCE);
+		if(argc > 3)
+		{
+			std::ofstream json_file(argv[3]);
 
-	cout << "Size of olsr msg header class " << sizeof(ns_olsr2_0::C_MESSAGE_HEADER) << endl;
+			benchmark.write_json(json_file);
+		}
+		else
+		{
+			benchmark.write_json(cout);
+		}
+
+		return 0;
+	}
+
+	/* olsr load [packets] [neighbors] [originators] [duplicate_ratio] measures the receive path */
+	if((argc > 1) and (std::string(argv[1]) == "load"))
+	{
+		ns_olsr2_0::T_LOAD_CONFIG config = ns_olsr2_0::C_OLSR_LOAD_GENERATOR::get_default_config();
+
+		config.packet_count = (argc > 2) ? strtoul(argv[2], NULL, 10) : config.packet_count;
+		config.neighbor_count = (argc > 3) ? strtoul(argv[3], NULL, 10) : config.neighbor_count;
+		config.topology_size = (argc > 4) ? strtoul(argv[4], NULL, 10) : config.topology_size;
+		config.duplicate_ratio = (argc > 5) ? strtof(argv[5], NULL) : config.duplicate_ratio;
+
+		ns_olsr2_0::C_OLSR_LOAD_GENERATOR load_generator(config);
+		ns_olsr2_0::C_OLSR_LOAD_GENERATOR::print_report(config, load_generator.run());
+		ns_olsr2_0::C_PHASE_HISTOGRAMS::write_text(cout);
 
-    Normal_Node_Olsr.mpr_computation();
-    Normal_Node_Olsr.routing_table_computation();
+		return 0;
+	}
 
-	Normal_Node_Olsr.send_hello();
+	/* olsr udp [nodes] [degree] [seconds] [base_port] [saturate_ms] measures the datagram rates of a ring of instances over the loopback */
+	if((argc > 1) and (std::string(argv[1]) == "udp"))
+	{
+		ns_olsr2_0::T_UDP_DRIVER_CONFIG config = ns_olsr2_0::C_OLSR_UDP_DRIVER::get_default_config();
 
+		config.node_count = (argc > 2) ? strtoul(argv[2], NULL, 10) : config.node_count;
+		config.degree = (argc > 3) ? strtoul(argv[3], NULL, 10) : config.degree;
+		config.duration = (argc > 4) ? (strtoul(argv[4], NULL, 10) * M_MSEC_PER_SEC) : config.duration;
+		config.base_port = (argc > 5) ? strtoul(argv[5], NULL, 10) : config.base_port;
+		config.saturate_duration = (argc > 6) ? strtoul(argv[6], NULL, 10) : config.saturate_duration;
 
-	//Leader_Node_Olsr.send_hello();
+		ns_olsr2_0::C_OLSR_UDP_DRIVER udp_driver(config);
+		ns_olsr2_0::C_OLSR_UDP_DRIVER::print_report(config, udp_driver.run());
+		ns_olsr2_0::C_PHASE_HISTOGRAMS::write_text(cout);
+
+		return 0;
+	}
+
+	/* olsr check compares the state indexes with plain references, the exit status is non zero on a failure */
+	if((argc > 1) and (std::string(argv[1]) == "check"))
+	{
+		ns_olsr2_0::C_OLSR_SELF_CHECK self_check(cout);
+
+		return (self_check.run() == 0) ? 0 : 1;
+	}
+
+	cout << "!!!Hello World!!!" << endl; // prints !!!Hello World!!!
+
+	/* Protocol logs are written by the logger thread, stopped before the reports */
+	ns_olsr2_0::C_OLSR_LOGGER::start(cout);
+
+	/* OLSR_TRACE_FILE=<file> records the protocol activity as a Chrome / Perfetto trace */
+	const char* trace_file = getenv("OLSR_TRACE_FILE");
+	ns_olsr2_0::C_OLSR_TRACE::set_enabled(trace_file != NULL);
+
+	ns_olsr2_0::T_UINT32 node_count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 2;
+	ns_olsr2_0::C_OLSR_HOST olsr_host;
+
+	/* olsr <count> grid|random|clustered [static|waypoint|walk] [workers] runs an emulated scenario */
+	if(argc > 2)
+	{
+		ns_olsr2_0::T_EMULATOR_CONFIG config = ns_olsr2_0::C_OLSR_EMULATOR::get_default_config();
+		std::string topology(argv[2]);
+		std::string mobility((argc > 3) ? argv[3] : "static");
+
+		config.node_count = node_count;
+		config.topology = (topology == "random") ? ns_olsr2_0::RANDOM_GEOMETRIC_TOPOLOGY
+		                : (topology == "clustered") ? ns_olsr2_0::CLUSTERED_TOPOLOGY : ns_olsr2_0::GRID_TOPOLOGY;
+		config.cluster_count = 1 + (node_count / M_EMULATOR_NODES_PER_NET);
+		config.mobility = (mobility == "waypoint") ? ns_olsr2_0::RANDOM_WAYPOINT_MOBILITY
+		                : (mobility == "walk") ? ns_olsr2_0::RANDOM_WALK_MOBILITY : ns_olsr2_0::STATIC_MOBILITY;
+		config.max_speed = 5.0;
+		config.worker_count = (argc > 4) ? strtoul(argv[4], NULL, 10) : config.worker_count;
+
+		ns_olsr2_0::C_OLSR_EMULATOR emulator(config);
+		ns_olsr2_0::T_EMULATOR_REPORT report = emulator.run();
+
+		ns_olsr2_0::C_OLSR_LOGGER::stop();
+		write_trace_file(trace_file);
+		ns_olsr2_0::C_OLSR_EMULATOR::print_report(config, report);
+
+		return 0;
+	}
+
+	/* A chain of nodes, 254 nodes per orthogonal net */
+	for(ns_olsr2_0::T_UINT32 idx = 0; idx < node_count; idx++)
+	{
+		ns_olsr2_0::T_NODE_ADDRESS node_addr;
+
+		node_addr.net_id = 1 + (idx / 254);
+		node_addr.node_id = 1 + (idx % 254);
+
+		ns_olsr2_0::T_UINT32 node_idx = olsr_host.add_node(node_addr, ns_olsr2_0::E_OLSR_INSTANCE::NORMAL_NODE_INSTANCE);
+
+		if(node_idx > 0)
+		{
+			olsr_host.add_link(node_idx - 1, node_idx);
+		}
+	}
+
+	/* OLSR_CONTROL_SOCKET=<path> serves state dumps of the nodes, SIGUSR1 writes them to olsr_state.json */
+	const char* control_socket = getenv("OLSR_CONTROL_SOCKET");
+	ns_olsr2_0::C_OLSR_CONTROL_SERVER control_server((control_socket != NULL) ? control_socket : "", "olsr_state.json");
+
+	if(control_socket != NULL)
+	{
+		for(ns_olsr2_0::T_UINT32 idx = 0; idx < olsr_host.get_node_count(); idx++)
+		{
+			control_server.add_node(&olsr_host.get_node(idx));
+		}
+		ns_olsr2_0::C_OLSR_INTROSPECTION::install_signal_handler(SIGUSR1);
+		control_server.start();
+	}
+
+	olsr_host.run_until(60 * M_MSEC_PER_SEC);
+
+	control_server.stop();
+	ns_olsr2_0::C_OLSR_LOGGER::stop();
+	write_trace_file(trace_file);
+
+	cout << "Size of olsr msg header class " << sizeof(ns_olsr2_0::C_MESSAGE_HEADER) << endl;
+	cout << "Size of olsr instance " << sizeof(ns_olsr2_0::C_OLSR) << endl;
+	cout << "Packets sent " << olsr_host.get_counters().packets_sent
+	     << " delivered " << olsr_host.get_counters().packets_delivered
+	     << " timers " << olsr_host.get_counters().timers_fired
+	     << " pooled buffers " << olsr_host.get_packet_pool().get_allocated_count() << endl;
+
+	ns_olsr2_0::C_OLSR_METRICS::print_snapshot(ns_olsr2_0::C_OLSR_METRICS::snapshot());
+	ns_olsr2_0::C_PHASE_HISTOGRAMS::write_text(cout);
+	cout << "Dropped log records " << ns_olsr2_0::C_OLSR_LOGGER::get_dropped_count() << endl;
 
 	return 0;
 }
@@ -23,10 +23,23 @@
 
 #include "olsr_header.hpp"           /* Include file for hearder functionalities */
 #include "olsr_state.hpp"            /* Include file for olsr state functionalities */
+#include "olsr_overload.hpp"         /* Include file for receive overload control */
+#include "olsr_scheduler.hpp"        /* Include file for timer scheduling */
+#include "olsr_clock.hpp"            /* Include file for the time source */
+#include "olsr_transport.hpp"        /* Include file for the packet transport */
+#include "olsr_interval.hpp"         /* Include file for the adaptive message intervals */
+#include "olsr_metrics.hpp"          /* Include file for the protocol counters */
+#include "olsr_histogram.hpp"        /* Include file for the phase latency histograms */
+#include "olsr_log.hpp"              /* Include file for the asynchronous logger */
+#include "olsr_trace.hpp"            /* Include file for the trace event recorder */
+#include "olsr_introspection.hpp"    /* Include file for the state snapshots */
 #include "array"
+#include <random>
 
 namespace ns_olsr2_0
 {
+#define M_MSG_LIST_CAPACITY     8       /* Messages queued per send without growing olsr_msg_list */
+#define M_RECOMPUTE_MIN_INTERVAL 100    /* Minimum time between two recomputations in ms, the changes in between wait for the next one */
 
 
   class C_OLSR
@@ -46,6 +59,17 @@ namespace ns_olsr2_0
       RUN_STATE = 0X1
     }E_OPERATION_STATE;
 
+    /**
+     * Packet waiting in the receive queue
+     */
+    typedef struct
+    {
+      C_PACKET_HEADER packet;               /* Serialised packet */
+      T_NODE_ADDRESS sender_address;        /* Interface address of the sender */
+      T_NODE_ADDRESS receiver_address;      /* Interface address of the receiver */
+      float l_in_metric;                    /* Incoming link metric */
+    }T_RX_PACKET;
+
 
     void init(ns_olsr2_0::E_OLSR_INSTANCE);    /* OLSR entry point function for INIT State */
 
@@ -53,6 +77,34 @@ namespace ns_olsr2_0
 
     void reset(void);    /* Resets the OLSR instance */
 
+    Time next_deadline(void);   /* Returns the time of the next timer, the host may sleep until then */
+
+    void handle_timer(E_TIMER_EVENT event);    /* Runs the work of a fired timer */
+
+    void set_scheduler(C_OLSR_SCHEDULER* scheduler);   /* Shares a scheduler between OLSR instances */
+
+    std::shared_ptr<T_STATE_SNAPSHOT> take_state_snapshot(void);   /* Protocol thread only, copies the sets */
+
+    /* Any thread, asks the protocol thread for a snapshot and returns the sequence to wait for */
+    T_UINT32
+    request_state_snapshot ()
+    {
+      return m_introspection.request();
+    }
+
+    /* Any thread, returns an empty snapshot if the request was not served in time */
+    std::shared_ptr<const T_STATE_SNAPSHOT>
+    wait_state_snapshot (T_UINT32 sequence, T_UINT32 timeout_ms) const
+    {
+      return m_introspection.wait_snapshot(sequence, timeout_ms);
+    }
+
+    T_UINT32
+    get_timer_generation (E_TIMER_EVENT event) const
+    {
+      return m_timer_generation[event];
+    }
+
 #ifdef M_TO_BE_DELETED
     T_ADDR get_node_address(void);  /* Returns the Node address */
 
@@ -64,8 +116,16 @@ namespace ns_olsr2_0
 
     void send_olsr_msg(void);   /* Sends OLSR packet to Gateway */
 
+    void set_transport(C_OLSR_TRANSPORT* transport);   /* Sets the transport used by send_olsr_msg */
+
     void recv_olsr(void* olsr_packet);  /* Receives OLSR packet from Gateway */
 
+    /* Queues a received packet for the next receive tick */
+    T_BOOL enqueue_olsr_packet(const C_PACKET_HEADER& olsr_packet, const T_NODE_ADDRESS& sender_address,
+                               const T_NODE_ADDRESS& receiver_address, float l_in_metric);
+
+    void process_rx_queue(void);    /* Processes the receive queue within the overload thresholds */
+
     T_ADDR* get_routing_destination_address(T_ADDR* Csrc, T_ADDR* Dest, T_ADDR* RDest);
 
     template <typename T>
@@ -98,6 +158,11 @@ namespace ns_olsr2_0
     void
     setHelloInterval (Time helloInterval)
     {
+      T_INTERVAL_CONFIG config = m_hello_adaptive.get_config();
+
+      config.min_interval = helloInterval;
+      config.max_interval = helloInterval;
+      m_hello_adaptive.set_config(config);
       m_hello_interval = helloInterval;
     }
 
@@ -147,6 +212,7 @@ namespace ns_olsr2_0
     set_node_addr (T_NODE_ADDRESS nodeAddress)
     {
       m_node_address = nodeAddress;
+      m_is_node_addr_set = true;
     }
 
     E_OPERATION_STATE
@@ -182,9 +248,28 @@ namespace ns_olsr2_0
     void
     setTcInterval (Time tcInterval)
     {
+      T_INTERVAL_CONFIG config = m_tc_adaptive.get_config();
+
+      config.min_interval = tcInterval;
+      config.max_interval = tcInterval;
+      m_tc_adaptive.set_config(config);
       m_tc_interval = tcInterval;
     }
 
+    void set_interval_config(const T_INTERVAL_CONFIG& hello_config, const T_INTERVAL_CONFIG& tc_config);   /* Sets the adaptive interval bounds */
+
+    const T_OVERLOAD_COUNTERS&
+    get_overload_counters () const
+    {
+      return m_overload.get_counters();
+    }
+
+    void
+    set_overload_config (const T_OVERLOAD_CONFIG& config)
+    {
+      m_overload.set_config(config);
+    }
+
     const U_WILLINGNESS&
     getWillingness () const
     {
@@ -197,17 +282,19 @@ namespace ns_olsr2_0
       m_willingness = willingness;
     }
 
-    void recv_olsr(const C_PACKET_HEADER, T_NODE_ADDRESS&, T_NODE_ADDRESS&, float);    /* Segregates OLSR messages and calls for processing */
+    void recv_olsr(const C_PACKET_HEADER&, const T_NODE_ADDRESS&, const T_NODE_ADDRESS&, float);    /* Segregates OLSR messages and calls for processing */
 
     void send_hello(void);  /* Prepares hello message and sends to the tx buffer */
 
-    void process_hello(const C_MESSAGE_HEADER&, const T_NODE_ADDRESS&, float);   /* Processes  hello message received from neighbor node */
+    void send_tc(void);     /* Prepares the TC messages of the advertised set and sends to the tx buffer */
 
-    void link_sensing(const C_MESSAGE_HEADER&, const C_MESSAGE_HEADER::T_HELLO&, const T_NODE_ADDRESS&, float); /* Sense the link and processes it*/
+    T_BOOL process_hello(const C_MESSAGE_HEADER&, const T_NODE_ADDRESS&, float);   /* Processes  hello message received from neighbor node, true if the neighborhood changed */
 
-    void process_tc(const C_MESSAGE_HEADER&, const T_NODE_ADDRESS&);  /* Processes  tc message received from neighbor node */
+    T_BOOL link_sensing(const C_MESSAGE_HEADER&, const C_MESSAGE_HEADER::T_HELLO&, const T_NODE_ADDRESS&, float); /* Sense the link and processes it, true if the link or neighbor changed */
 
-    void forward_default(const C_MESSAGE_HEADER&);  /* Forwards the TC messages received from Flooding mpr selectors*/
+    T_BOOL process_tc(const C_MESSAGE_HEADER&, const T_NODE_ADDRESS&);  /* Processes  tc message received from neighbor node, true if the topology changed */
+
+    void forward_default(const C_MESSAGE_HEADER&, const T_NODE_ADDRESS&);  /* Forwards the TC messages received from Flooding mpr selectors*/
 
     void mpr_computation();   /* wrapper function for MPR Computation */
     void routing_mpr_computation();   /* Finds the routing mprs of this node*/
@@ -226,30 +313,115 @@ namespace ns_olsr2_0
 
     T_UINT16 m_message_sequence_number;         /* Messages sequence number counter. */
     T_UINT16 m_ansn;                            /* Advertised Neighbor Set sequence number. */
+    Time m_empty_tc_deadline;                   /* Empty TCs are sent until then once the advertised set emptied */
 
     Time m_hello_interval;                      /* HELLO messages' transmission interval. */
     Time m_tc_interval;                         /* TC messages' transmission interval.  */
+
+    C_OLSR_INTERVAL_CONTROLLER m_hello_adaptive;        /* Stretches the HELLO interval of a stable neighborhood */
+    C_OLSR_INTERVAL_CONTROLLER m_tc_adaptive;           /* Stretches the TC interval of a stable topology */
+
+    Time m_hello_deadline;                      /* Deadline of the pending HELLO timer */
+    Time m_tc_deadline;                         /* Deadline of the pending TC timer */
     U_WILLINGNESS m_willingness;                      /* Willingness for forwarding packets on behalf of other nodes. */
 
     T_NODE_ADDRESS m_node_address;              /* Node address */
 
+    T_BOOL m_is_node_addr_set;                  /* True if the node address is set before init */
+
     T_BOOL m_is_leader;                         /* Flag to check whether the current node is a leader or not */
 
     E_OLSR_INSTANCE m_instance;                 /* Instance type(Normal node instance / Leader node instance) */
 
     C_MESSAGE_HEADER::OlsrMsgList olsr_msg_list;
 
+    C_OLSR_TRANSPORT* m_transport;              /* Transport of the packets sent by this instance */
+
+    std::vector<T_RX_PACKET> m_rx_queue;        /* Packets waiting for the next receive tick, no memory until used */
+
+    std::vector<T_RX_PACKET> m_deferred_msgs;   /* TC messages deferred during an overload, one per packet */
+
+    C_OLSR_OVERLOAD_CONTROLLER m_overload;      /* Sheds and defers control traffic under overload */
+
+    C_OLSR_SCHEDULER m_own_scheduler;           /* Scheduler used when none is shared */
+
+    C_OLSR_SCHEDULER* m_scheduler;              /* Scheduler owning the timers of this instance */
+
+    std::array<T_UINT32, MAX_TIMER_EVENT> m_timer_generation;     /* Generation of each pending timer */
+
+    std::array<T_BOOL, MAX_TIMER_EVENT> m_timer_pending;          /* True while the timer has an entry in the scheduler */
+
+    Time m_expiry_deadline;                     /* Deadline of the pending expiry timer */
+
+    T_BOOL m_recompute_pending;                 /* True while the recomputation timer is pending */
+
+    Time m_last_recompute;                      /* Time of the last recomputation */
+
+    T_BOOL m_mpr_dirty;                         /* MPRs have to be recomputed */
+
+    T_BOOL m_routes_dirty;                      /* Routing table has to be recomputed */
+
+    T_UINT32 m_advertised_change_count;         /* Changes of the advertised set already noted as churn */
+
+    std::minstd_rand m_jitter_rng;              /* Random source of the message jitter */
+
+    C_OLSR_GAUGE_SET m_set_gauges;              /* Set sizes published to the metrics */
+
+    C_OLSR_INTROSPECTION m_introspection;       /* Snapshots requested by other threads */
+
     void init_op(ns_olsr2_0::E_OLSR_INSTANCE);  /* Initializes the OLSR main data members  */
 
     T_UINT16 get_next_msg_seq_num(void);    /* Prepares the next OLSR message sequence number and sends */
 
+    void start_timers(void);    /* Schedules the periodic timers */
+
+    void schedule_timer(E_TIMER_EVENT event, Time deadline);    /* Schedules or reschedules a timer */
+
+    void cancel_timer(E_TIMER_EVENT event);     /* Cancels a pending timer */
+
+    void remove_timers(void);   /* Drops the timers of this instance from its scheduler */
+
+    Time get_jitter(Time interval);     /* Returns a random jitter for a periodic message */
+
+    void request_recomputation(T_BOOL mpr, T_BOOL routes);     /* Defers the MPR and routing table computation */
+
+    void schedule_expiry_timer(void);   /* Moves the expiry timer to the earliest tuple expiry */
+
+    void schedule_hello_timer(Time cur_time);   /* Schedules the next HELLO from the current interval */
+
+    void schedule_tc_timer(Time cur_time);      /* Schedules the next TC from the current interval */
+
+    void note_churn(T_BOOL neighborhood, T_BOOL topology);     /* Shrinks the intervals after a change */
+
+    void note_advertised_churn(void);   /* Notes a change of the advertised set as a topology change */
+
+    void publish_set_sizes(void);       /* Updates the set size gauges of the metrics */
+
+    void serve_state_snapshot(void);    /* Publishes a snapshot if another thread requested one */
+
     void set_leader_info(C_MESSAGE_HEADER::T_HELLO& hello_msg, T_LEADER_TUPLE* leader_tuple);
 
     void set_common_address(C_MESSAGE_HEADER::T_HELLO& hello_msg, E_ADDRESS_BLOCK_FLAGS common_field, T_UINT8 common_id);
 
+    C_MESSAGE_HEADER& add_tc_message(void);    /* Queues an empty TC message of the current ANSN */
+
     void set_neighbor_info(C_MESSAGE_HEADER::T_HELLO& hello_msg, Time cur_time);
 
-    T_BOOL check_message_validity(const C_MESSAGE_HEADER& message_header);
+    T_BOOL check_message_validity(const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header);
+
+    T_BOOL check_tc_freshness(const T_UINT8* msg_buf, const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header);
+
+    T_BOOL check_sym_neighbor_hello(const C_PACKET_HEADER& olsr_packet);   /* Checks if a packet carries a HELLO of a symmetric neighbor */
+
+    T_BOOL evict_rx_packet(void);   /* Drops the newest queued packet without a HELLO of a symmetric neighbor */
+
+    void process_raw_message(const T_UINT8* msg_buf, const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header,
+                             const T_NODE_ADDRESS& sender_address, float l_in_metric);
+
+    void defer_raw_message(const T_UINT8* msg_buf, const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header,
+                           const T_NODE_ADDRESS& sender_address, float l_in_metric);
+
+    void process_deferred_msgs(void);
 
     T_PROCESSED_MSG_TUPLE create_processed_msg_tuple(const C_MESSAGE_HEADER& msg_header);
 
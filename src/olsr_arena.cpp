@@ -0,0 +1,199 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_arena.cpp
+ *
+ * Description        :   Implements the per instance memory arena of the olsr tuple sets .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include "olsr_arena.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  C_OLSR_ARENA
+   * @brief     This function is the constructor of C_OLSR_ARENA.
+   * @param     initial_block - Size of the first heap block.
+   * @return    None.
+   * @note      No memory is taken before the first allocation.
+  ********************************************************************/
+  C_OLSR_ARENA::C_OLSR_ARENA(std::size_t initial_block)
+  : m_buffer(initial_block), m_bytes_in_use(0), m_peak_bytes(0), m_allocation_count(0), m_fixed(false)
+  {
+    m_free_lists.fill(nullptr);
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_ARENA
+   * @brief     This function is the constructor of a C_OLSR_ARENA
+   *            limited to a fixed buffer.
+   * @param     buffer - Memory of the arena, aligned to max_align_t.
+   *            size - Bytes of the buffer.
+   * @return    None.
+   * @note      The buffer must outlive the arena.
+  ********************************************************************/
+  C_OLSR_ARENA::C_OLSR_ARENA(void* buffer, std::size_t size)
+  : m_buffer(buffer, size, std::pmr::null_memory_resource()), m_bytes_in_use(0), m_peak_bytes(0), m_allocation_count(0), m_fixed(true)
+  {
+    m_free_lists.fill(nullptr);
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_ARENA
+   * @brief     This function is the destructor of C_OLSR_ARENA.
+   * @param     None.
+   * @return    None.
+   * @note      The members free the blocks.
+  ********************************************************************/
+  C_OLSR_ARENA::~C_OLSR_ARENA()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  release
+   * @brief     This function gives all the blocks back to the heap.
+   * @param     None.
+   * @return    None.
+   * @note      The cost depends on the number of heap blocks, about
+   *            the logarithm of the peak size, not on the number of
+   *            tuples.
+  ********************************************************************/
+  void C_OLSR_ARENA::release(void)
+  {
+    m_free_lists.fill(nullptr);
+    m_buffer.release();
+
+    m_bytes_in_use = 0;
+    m_peak_bytes = 0;
+    m_allocation_count = 0;
+  }
+
+  /********************************************************************
+   * @function  get_size_class
+   * @brief     This function finds the size class of a block.
+   * @param     bytes.
+   * @return    Index of the free list, M_ARENA_CLASS_COUNT if the
+   *            block is too large for the arena.
+   * @note      Class i holds blocks of 2^(i + M_ARENA_MIN_CLASS_SHIFT)
+   *            bytes.
+  ********************************************************************/
+  T_UINT32 C_OLSR_ARENA::get_size_class(std::size_t bytes)
+  {
+    T_UINT32 size_class = 0;
+
+    while((size_class < M_ARENA_CLASS_COUNT) and
+          ((std::size_t(1) << (size_class + M_ARENA_MIN_CLASS_SHIFT)) < bytes))
+      {
+        size_class++;
+      }
+
+    return size_class;
+  }
+
+  /********************************************************************
+   * @function  do_allocate
+   * @brief     This function takes a block from the free list of its
+   *            size class, or carves a new one from the buffer.
+   * @param     bytes, alignment.
+   * @return    Block.
+   * @note      Blocks larger than the last class or more aligned than
+   *            max_align_t come straight from the heap, or from the
+   *            buffer of a fixed arena.
+  ********************************************************************/
+  void* C_OLSR_ARENA::do_allocate(std::size_t bytes, std::size_t alignment)
+  {
+    T_UINT32 size_class = get_size_class(bytes);
+    void* block;
+
+    if((size_class == M_ARENA_CLASS_COUNT) or (alignment > alignof(std::max_align_t)))
+      {
+        if(m_fixed == true)
+          {
+            block = m_buffer.allocate(get_block_size(bytes), alignment);
+          }
+        else
+          {
+            block = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+          }
+      }
+    else if(m_free_lists[size_class] != nullptr)
+      {
+        block = m_free_lists[size_class];
+        m_free_lists[size_class] = m_free_lists[size_class]->next;
+      }
+    else
+      {
+        block = m_buffer.allocate(std::size_t(1) << (size_class + M_ARENA_MIN_CLASS_SHIFT), alignof(std::max_align_t));
+      }
+
+    m_bytes_in_use += bytes;
+    m_allocation_count++;
+
+    if(m_bytes_in_use > m_peak_bytes)
+      {
+        m_peak_bytes = m_bytes_in_use;
+      }
+
+    return block;
+  }
+
+  /********************************************************************
+   * @function  do_deallocate
+   * @brief     This function puts a block on the free list of its
+   *            size class.
+   * @param     block, bytes, alignment.
+   * @return    None.
+   * @note      A large block of a fixed arena stays in the buffer
+   *            until release().
+  ********************************************************************/
+  void C_OLSR_ARENA::do_deallocate(void* block, std::size_t bytes, std::size_t alignment)
+  {
+    T_UINT32 size_class = get_size_class(bytes);
+
+    if((size_class == M_ARENA_CLASS_COUNT) or (alignment > alignof(std::max_align_t)))
+      {
+        if(m_fixed == false)
+          {
+            std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+          }
+      }
+    else
+      {
+        T_FREE_BLOCK* free_block = static_cast<T_FREE_BLOCK*>(block);
+
+        free_block->next = m_free_lists[size_class];
+        m_free_lists[size_class] = free_block;
+      }
+
+    m_bytes_in_use -= bytes;
+  }
+
+  /********************************************************************
+   * @function  do_is_equal
+   * @brief     This function checks if blocks of the other resource
+   *            can be freed by this one.
+   * @param     other.
+   * @return    true only for the same arena.
+   * @note      None.
+  ********************************************************************/
+  bool C_OLSR_ARENA::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+  {
+    return (this == &other);
+  }
+
+}
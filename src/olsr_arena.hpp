@@ -0,0 +1,122 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_arena.hpp
+ *
+ * Description        :   To store the per instance memory arena of the olsr tuple sets .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_ARENA_HPP_
+#define OLSR_ARENA_HPP_
+
+#include <array>
+#include <memory_resource>
+#include "olsr_utility.hpp"        /* Include file for basic utilities */
+
+namespace ns_olsr2_0
+{
+#define M_ARENA_INITIAL_BLOCK   4096    /* First block taken from the heap, later blocks grow geometrically */
+#define M_ARENA_MIN_CLASS_SHIFT 4       /* Smallest size class, 16 bytes */
+#define M_ARENA_CLASS_COUNT     13      /* Size classes 16 bytes to 64 KB, larger blocks bypass the arena */
+
+  /**
+   * Memory resource of the tuple sets of one instance. Blocks are
+   * rounded up to a power of two and carved from a monotonic buffer fed
+   * by a few large heap blocks, freed blocks go to the free list of
+   * their size class and are reused by the next insertions. Blocks
+   * above the last class are taken from and given back to the heap.
+   * release() hands all of it back at once, without visiting the
+   * blocks in use. An arena built on a fixed buffer never touches the
+   * heap, a request the buffer cannot serve throws std::bad_alloc. Not
+   * thread safe, only the thread running the instance allocates from
+   * it.
+   */
+  class C_OLSR_ARENA : public std::pmr::memory_resource
+  {
+
+  public:
+    C_OLSR_ARENA(std::size_t initial_block = M_ARENA_INITIAL_BLOCK);
+
+    C_OLSR_ARENA(void* buffer, std::size_t size);       /* Arena limited to a fixed buffer */
+
+    ~C_OLSR_ARENA();
+
+    void release(void);                 /* Frees everything, the containers using the arena must be empty */
+
+    std::size_t
+    get_bytes_in_use () const
+    {
+      return m_bytes_in_use;
+    }
+
+    std::size_t
+    get_peak_bytes () const
+    {
+      return m_peak_bytes;
+    }
+
+    T_UINT64
+    get_allocation_count () const
+    {
+      return m_allocation_count;
+    }
+
+    /* Bytes taken from the buffer by a block, to size a fixed buffer */
+    static constexpr std::size_t
+    get_block_size (std::size_t bytes)
+    {
+      std::size_t block_size = std::size_t(1) << M_ARENA_MIN_CLASS_SHIFT;
+
+      while((block_size < bytes) and (block_size < (std::size_t(1) << (M_ARENA_MIN_CLASS_SHIFT + M_ARENA_CLASS_COUNT - 1))))
+        {
+          block_size <<= 1;
+        }
+
+      return (block_size < bytes) ? (((bytes + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t)) : block_size;
+    }
+
+  private:
+
+    std::pmr::monotonic_buffer_resource m_buffer;       /* Large blocks from the heap */
+
+    /* Freed block, the link is stored in the block itself */
+    struct T_FREE_BLOCK
+    {
+      T_FREE_BLOCK* next;
+    };
+
+    std::array<T_FREE_BLOCK*, M_ARENA_CLASS_COUNT> m_free_lists;        /* Freed blocks of each size class */
+
+    std::size_t m_bytes_in_use;         /* Bytes handed out and not freed */
+
+    std::size_t m_peak_bytes;           /* Highest m_bytes_in_use since the last release */
+
+    T_UINT64 m_allocation_count;        /* Allocations since the last release */
+
+    T_BOOL m_fixed;                     /* Large blocks come from the buffer instead of the heap */
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    static T_UINT32 get_size_class(std::size_t bytes);
+  };
+
+}
+
+#endif /* OLSR_ARENA_HPP_ */
@@ -0,0 +1,424 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_benchmark.cpp
+ *
+ * Description        :   Implements the micro benchmarks of the olsr state, computations and codecs .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include "olsr_benchmark.hpp"
+
+using namespace std;
+
+namespace ns_olsr2_0
+{
+#define M_BENCH_NODES_PER_NET       254         /* Node ids of one orthogonal net */
+#define M_BENCH_TUPLE_LIFETIME      (3600 * M_MSEC_PER_SEC)     /* Tuples never expire during a run */
+
+  /********************************************************************
+   * @function  C_OLSR_BENCHMARK
+   * @brief     This function is the constructor of C_OLSR_BENCHMARK.
+   * @param     min_size, max_size.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_BENCHMARK::C_OLSR_BENCHMARK(T_UINT32 min_size, T_UINT32 max_size)
+    : m_min_size(min_size), m_max_size(max_size)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_BENCHMARK
+   * @brief     This function is the destructor of C_OLSR_BENCHMARK.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_BENCHMARK::~C_OLSR_BENCHMARK()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  get_address
+   * @brief     This function returns the address of the idx-th node,
+   *            the nets are filled one after the other.
+   * @param     idx.
+   * @return    Node address.
+   * @note      None.
+  ********************************************************************/
+  T_NODE_ADDRESS C_OLSR_BENCHMARK::get_address(T_UINT32 idx)
+  {
+    T_NODE_ADDRESS node_addr;
+
+    node_addr.net_id = 1 + (idx / M_BENCH_NODES_PER_NET);
+    node_addr.node_id = 1 + (idx % M_BENCH_NODES_PER_NET);
+
+    return node_addr;
+  }
+
+  /********************************************************************
+   * @function  measure
+   * @brief     This function repeats an operation in growing batches
+   *            until the measurement lasts M_BENCH_MIN_DURATION and
+   *            records its mean time.
+   * @param     name, size, bytes, func.
+   * @return    None.
+   * @note      The clock is read once per batch, so the cost of
+   *            reading it is not charged to short operations.
+  ********************************************************************/
+  template <typename T_FUNC>
+  void C_OLSR_BENCHMARK::measure(const char* name, T_UINT32 size, T_UINT32 bytes, T_FUNC func)
+  {
+    typedef std::chrono::steady_clock T_BENCH_CLOCK;
+
+    T_BENCH_RESULT result;
+    T_UINT64 batch = 1;
+    T_BENCH_CLOCK::duration elapsed(0);
+    T_BENCH_CLOCK::time_point start = T_BENCH_CLOCK::now();
+
+    result.iterations = 0;
+
+    while(elapsed < std::chrono::milliseconds(M_BENCH_MIN_DURATION))
+      {
+        for(T_UINT64 idx = 0; idx < batch; idx++)
+          {
+            func(result.iterations + idx);
+          }
+
+        result.iterations += batch;
+        batch *= 2;
+        elapsed = T_BENCH_CLOCK::now() - start;
+      }
+
+    result.name = name;
+    result.size = size;
+    result.bytes = bytes;
+    result.ns_per_op = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / result.iterations;
+
+    m_results.push_back(result);
+  }
+
+  /********************************************************************
+   * @function  fill_state
+   * @brief     This function adds size symmetric neighbors, each one
+   *            reaching M_BENCH_TWO_HOP_FANOUT 2-hop neighbors, and a
+   *            processed message tuple per neighbor.
+   * @param     state, size.
+   * @return    None.
+   * @note      The 2-hop neighbors are shared, half as many as the
+   *            neighbors, so the MPR computation has a choice to make.
+  ********************************************************************/
+  void C_OLSR_BENCHMARK::fill_state(C_OLSR_STATE& state, T_UINT32 size)
+  {
+    Time expiry_time = m_clock.now() + M_BENCH_TUPLE_LIFETIME;
+    T_UINT32 two_hop_count = (size / 2) + 1;
+
+    for(T_UINT32 idx = 0; idx < size; idx++)
+      {
+        T_LINK_TUPLE link_tuple;
+        T_NEIGHBOUR_TUPLE neighbour_tuple;
+        T_PROCESSED_MSG_TUPLE processed_tuple;
+
+        link_tuple.l_neighbor_iface_addr = get_address(idx);
+        link_tuple.l_in_metric = 1.0;
+        link_tuple.l_out_metric = 1.0;
+        link_tuple.l_mpr_selector = false;
+        link_tuple.l_heard_time = expiry_time;
+        link_tuple.l_sym_time = expiry_time;
+        link_tuple.l_time = expiry_time;
+        link_tuple.l_status = SYMMETRIC;
+        state.insert_link_tuple(link_tuple);
+
+        neighbour_tuple.n_neighbor_addr = get_address(idx);
+        neighbour_tuple.n_in_metric = 1.0;
+        neighbour_tuple.n_out_metric = 1.0;
+        neighbour_tuple.n_willingness.fields.route_will = WILL_MEDIUM;
+        neighbour_tuple.n_willingness.fields.flood_will = WILL_MEDIUM;
+        neighbour_tuple.n_symmetric = true;
+        neighbour_tuple.n_flooding_mpr = false;
+        neighbour_tuple.n_routing_mpr = false;
+        neighbour_tuple.n_mpr_selector = false;
+        neighbour_tuple.n_advertised = false;
+        state.insert_neighbour_tuple(neighbour_tuple);
+
+        for(T_UINT32 fanout = 0; fanout < M_BENCH_TWO_HOP_FANOUT; fanout++)
+          {
+            T_TWO_HOP_NEIGHBOUR_TUPLE two_hop_tuple;
+
+            two_hop_tuple.n2_neighbor_iface_addr = get_address(idx);
+            two_hop_tuple.n2_2hop_addr = get_address(size + ((idx + fanout) % two_hop_count));
+            two_hop_tuple.n2_in_metric = 1.0;
+            two_hop_tuple.n2_out_metric = 1.0;
+            two_hop_tuple.n2_time = expiry_time;
+            state.insert_two_hop_neighbour_tuple(two_hop_tuple);
+          }
+
+        processed_tuple.p_type = TC_MESSAGE;
+        processed_tuple.p_orig_addr = get_address(idx);
+        processed_tuple.p_seq_number = (T_UINT16)idx;
+        processed_tuple.p_time = expiry_time;
+        state.insert_processed_msg_tuple(processed_tuple);
+      }
+  }
+
+  /********************************************************************
+   * @function  bench_state_lookups
+   * @brief     This function times the find functions of the state,
+   *            each lookup hits a tuple, and the mask kernels of the
+   *            link and neighbor columns.
+   * @param     size.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_BENCHMARK::bench_state_lookups(T_UINT32 size)
+  {
+    C_OLSR_STATE state;
+    volatile const void* sink = NULL;
+    T_UINT32 two_hop_count = (size / 2) + 1;
+
+    state.init_state_tuples();
+    fill_state(state, size);
+
+    measure("find_link_tuple", size, 0, [&](T_UINT64 iteration)
+      {
+        sink = state.find_link_tuple(get_address(iteration % size));
+      });
+
+    measure("find_neighbour_tuple", size, 0, [&](T_UINT64 iteration)
+      {
+        sink = state.find_neighbour_tuple(get_address(iteration % size));
+      });
+
+    measure("find_sym_neighbour_tuple", size, 0, [&](T_UINT64 iteration)
+      {
+        sink = state.find_sym_neighbour_tuple(get_address(iteration % size));
+      });
+
+    measure("find_two_hop_neighbour_tuple", size, 0, [&](T_UINT64 iteration)
+      {
+        T_UINT32 idx = iteration % size;
+
+        sink = state.find_two_hop_neighbour_tuple(get_address(idx), get_address(size + (idx % two_hop_count)));
+      });
+
+    measure("find_processed_msg_tuple", size, 0, [&](T_UINT64 iteration)
+      {
+        T_UINT32 idx = iteration % size;
+
+        sink = state.find_processed_msg_tuple(get_address(idx), (T_UINT16)idx);
+      });
+
+#ifdef M_TUPLE_COLUMNS
+    T_MATCH_MASK mask;
+    Time cur_time = m_clock.now();
+
+    measure("link_allowed_mask", size, 0, [&](T_UINT64 /* iteration */)
+      {
+        state.get_link_columns().get_allowed_mask(cur_time, mask);
+        sink = &mask[0];
+      });
+
+    measure("neighbour_routing_allowed_mask", size, 0, [&](T_UINT64 /* iteration */)
+      {
+        state.get_neighbour_columns().get_routing_allowed_mask(mask);
+        sink = &mask[0];
+      });
+#endif
+
+    (void)sink;
+  }
+
+  /********************************************************************
+   * @function  bench_computations
+   * @brief     This function times the MPR and routing table
+   *            computations and the HELLO construction of an instance.
+   * @param     size.
+   * @return    None.
+   * @note      The HELLO lists the neighbors of its own net only, at
+   *            most M_BENCH_NODES_PER_NET of them.
+  ********************************************************************/
+  void C_OLSR_BENCHMARK::bench_computations(T_UINT32 size)
+  {
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+    C_NULL_TRANSPORT transport;
+    C_OLSR node;
+    T_NODE_ADDRESS node_addr;
+
+    node_addr.net_id = 1;
+    node_addr.node_id = M_BENCH_NODES_PER_NET + 1;
+
+    set_olsr_clock(&m_clock);
+
+    node.set_node_addr(node_addr);
+    node.set_transport(&transport);
+    node.init(NORMAL_NODE_INSTANCE);
+
+    C_OLSR_STATE state = node.getState();
+
+    fill_state(state, size);
+    node.setState(state);
+
+    measure("mpr_computation", size, 0, [&](T_UINT64 /* iteration */)
+      {
+        node.mpr_computation();
+      });
+
+    measure("routing_table_computation", size, 0, [&](T_UINT64 /* iteration */)
+      {
+        node.routing_table_computation();
+      });
+
+    measure("send_hello", size, 0, [&](T_UINT64 /* iteration */)
+      {
+        node.send_hello();
+        node.send_olsr_msg();
+      });
+
+    m_results.back().bytes = transport.m_bytes;
+
+    set_olsr_clock(prev_clock);
+  }
+
+  /********************************************************************
+   * @function  bench_codec
+   * @brief     This function times the size, serialization and
+   *            decoding of a HELLO and a TC listing size neighbors.
+   * @param     size.
+   * @return    None.
+   * @note      Messages larger than a packet are coded into a buffer
+   *            large enough, to follow the cost past MAX_OLSR_BUF_SIZE.
+  ********************************************************************/
+  void C_OLSR_BENCHMARK::bench_codec(T_UINT32 size)
+  {
+    C_MESSAGE_HEADER hello;
+    C_MESSAGE_HEADER tc;
+    C_MESSAGE_HEADER decoded;
+    C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK tc_addr_block;
+    std::vector<T_UINT8> buffer(0xFFFF);
+    volatile T_UINT32 sink = 0;
+    T_NODE_ADDRESS node_addr = get_address(0);
+
+    hello.set_message_attributes(node_addr, HELLO_MESSAGE, 1);
+    hello.get_hello().abf = NET_ID_COMMON;
+    hello.get_hello().common_id = node_addr.net_id;
+
+    tc.set_message_attributes(node_addr, TC_MESSAGE, 1);
+    tc.get_tc().ansn = 1;
+    tc_addr_block.tc_msg_type = ROUTABLE_ORIG;
+    tc_addr_block.abf = NET_ID_COMMON;
+    tc_addr_block.common_id = node_addr.net_id;
+
+    for(T_UINT32 idx = 0; idx < size; idx++)
+      {
+        C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK addr_block;
+
+        addr_block.unique_id = get_address(idx).node_id;
+        addr_block.common_field.link_state.type_fields.link_type = SYMMETRIC_LINK;
+        addr_block.common_field.link_state.type_fields.nbr_type = SYMMETRIC_NEIGHBOR;
+        addr_block.metric[0] = 1.0;
+        addr_block.metric[1] = 1.0;
+
+        hello.get_hello().neighbor_set.push_back(addr_block);
+        tc_addr_block.network_info.push_back(addr_block);
+      }
+
+    tc.get_tc().tc_addr_set.push_back(tc_addr_block);
+    hello.set_message_length(hello.get_msg_size());
+    tc.set_message_length(tc.get_msg_size());
+
+    measure("hello_msg_size", size, hello.get_message_length(), [&](T_UINT64 /* iteration */)
+      {
+        sink = hello.get_msg_size();
+      });
+
+    measure("hello_serialize", size, hello.get_message_length(), [&](T_UINT64 /* iteration */)
+      {
+        sink = hello.serialize(buffer.data(), buffer.size());
+      });
+
+    measure("hello_deserialize", size, hello.get_message_length(), [&](T_UINT64 /* iteration */)
+      {
+        sink = decoded.deserialize(buffer.data(), hello.get_message_length());
+      });
+
+    tc.serialize(buffer.data(), buffer.size());
+
+    measure("tc_serialize", size, tc.get_message_length(), [&](T_UINT64 /* iteration */)
+      {
+        sink = tc.serialize(buffer.data(), buffer.size());
+      });
+
+    measure("tc_deserialize", size, tc.get_message_length(), [&](T_UINT64 /* iteration */)
+      {
+        sink = decoded.deserialize(buffer.data(), tc.get_message_length());
+      });
+
+    (void)sink;
+  }
+
+  /********************************************************************
+   * @function  run
+   * @brief     This function runs all the cases, the neighborhood grows
+   *            by M_BENCH_SIZE_FACTOR from min_size to max_size.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_BENCHMARK::run(void)
+  {
+    m_results.clear();
+
+    for(T_UINT32 size = m_min_size; size <= m_max_size; size *= M_BENCH_SIZE_FACTOR)
+      {
+        bench_state_lookups(size);
+        bench_computations(size);
+        bench_codec(size);
+      }
+  }
+
+  /********************************************************************
+   * @function  write_json
+   * @brief     This function writes the results as a JSON document,
+   *            one object per case.
+   * @param     out.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_BENCHMARK::write_json(std::ostream& out) const
+  {
+    out << "{" << endl;
+    out << "  \"benchmark\": \"olsr\"," << endl;
+    out << "  \"results\": [" << endl;
+
+    for(std::vector<T_BENCH_RESULT>::const_iterator result_iter = m_results.begin(); result_iter != m_results.end(); result_iter++)
+      {
+        out << "    {\"name\": \"" << result_iter->name << "\""
+            << ", \"size\": " << result_iter->size
+            << ", \"iterations\": " << result_iter->iterations
+            << ", \"ns_per_op\": " << result_iter->ns_per_op
+            << ", \"bytes\": " << result_iter->bytes << "}"
+            << (((result_iter + 1) != m_results.end()) ? "," : "") << endl;
+      }
+
+    out << "  ]" << endl;
+    out << "}" << endl;
+  }
+
+}
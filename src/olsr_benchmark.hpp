@@ -0,0 +1,116 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_benchmark.hpp
+ *
+ * Description        :   To store the micro benchmarks of the olsr state, computations and codecs .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_BENCHMARK_HPP_
+#define OLSR_BENCHMARK_HPP_
+
+#include <string>
+#include <ostream>
+#include "olsr.hpp"                  /* Include file for olsr instance */
+
+namespace ns_olsr2_0
+{
+#define M_BENCH_MIN_SIZE            10          /* Smallest neighborhood */
+#define M_BENCH_MAX_SIZE            10000       /* Largest neighborhood */
+#define M_BENCH_SIZE_FACTOR         10          /* Growth of the neighborhood between runs */
+#define M_BENCH_MIN_DURATION        100         /* Shortest measurement of a case, in milli seconds */
+#define M_BENCH_TWO_HOP_FANOUT      2           /* 2-hop neighbors reached through each 1-hop neighbor */
+
+  /**
+   * Result of one benchmark case
+   */
+  typedef struct
+  {
+    std::string name;                   /* Benchmarked operation */
+    T_UINT32 size;                      /* Neighborhood size */
+    T_UINT64 iterations;                /* Operations measured */
+    double ns_per_op;                   /* Mean time of one operation, in nano seconds */
+    T_UINT32 bytes;                     /* Bytes produced by one operation, 0 if none */
+  }T_BENCH_RESULT;
+
+  /**
+   * Times the state lookups, the MPR and routing table computations,
+   * the HELLO construction and the message codec of an instance whose
+   * neighborhood grows from min_size to max_size
+   */
+  class C_OLSR_BENCHMARK
+  {
+
+  public:
+    C_OLSR_BENCHMARK(T_UINT32 min_size = M_BENCH_MIN_SIZE, T_UINT32 max_size = M_BENCH_MAX_SIZE);
+
+    ~C_OLSR_BENCHMARK();
+
+    void run(void);                     /* Runs all the cases of all the sizes */
+
+    void write_json(std::ostream& out) const;   /* Writes the results as a JSON document */
+
+    const std::vector<T_BENCH_RESULT>&
+    get_results () const
+    {
+      return m_results;
+    }
+
+  private:
+
+    /**
+     * Transport counting the packets handed to it
+     */
+    class C_NULL_TRANSPORT : public C_OLSR_TRANSPORT
+    {
+
+    public:
+      C_NULL_TRANSPORT() : m_bytes(0) {}
+
+      void
+      send_packet (const T_NODE_ADDRESS& /* sender_address */, const C_PACKET_HEADER& olsr_packet)
+      {
+        m_bytes = olsr_packet.get_packet_length();
+      }
+
+      T_UINT32 m_bytes;                 /* Length of the last packet */
+    };
+
+    T_UINT32 m_min_size;                /* Smallest neighborhood */
+
+    T_UINT32 m_max_size;                /* Largest neighborhood */
+
+    C_VIRTUAL_CLOCK m_clock;            /* Clock of the benchmarked instances, never moves */
+
+    std::vector<T_BENCH_RESULT> m_results;
+
+    static T_NODE_ADDRESS get_address(T_UINT32 idx);   /* Address of the idx-th node */
+
+    void fill_state(C_OLSR_STATE& state, T_UINT32 size);    /* Adds size symmetric neighbors and their 2-hop neighbors */
+
+    void bench_state_lookups(T_UINT32 size);
+
+    void bench_computations(T_UINT32 size);
+
+    void bench_codec(T_UINT32 size);
+
+    template <typename T_FUNC>
+    void measure(const char* name, T_UINT32 size, T_UINT32 bytes, T_FUNC func);
+  };
+
+}
+
+#endif /* OLSR_BENCHMARK_HPP_ */
@@ -0,0 +1,213 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_clock.cpp
+ *
+ * Description        :   Implements the clocks used by olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <time.h>
+#include "olsr_clock.hpp"
+
+namespace ns_olsr2_0
+{
+
+  static thread_local C_MONOTONIC_CLOCK g_monotonic_clock;               /* Default clock of each thread */
+
+  static thread_local C_OLSR_CLOCK* g_olsr_clock = &g_monotonic_clock;   /* Clock installed for each thread */
+
+  /********************************************************************
+   * @function  ~C_OLSR_CLOCK
+   * @brief     This function is the destructor of C_OLSR_CLOCK.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_CLOCK::~C_OLSR_CLOCK()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  update
+   * @brief     This function samples the time source.
+   * @param     None.
+   * @return    None.
+   * @note      Clocks which are not sampled do nothing.
+  ********************************************************************/
+  void C_OLSR_CLOCK::update(void)
+  {
+    ;
+  }
+
+  /********************************************************************
+   * @function  C_MONOTONIC_CLOCK
+   * @brief     This function is the constructor of C_MONOTONIC_CLOCK.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_MONOTONIC_CLOCK::C_MONOTONIC_CLOCK()
+  {
+    update();
+  }
+
+  /********************************************************************
+   * @function  ~C_MONOTONIC_CLOCK
+   * @brief     This function is the destructor of C_MONOTONIC_CLOCK.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_MONOTONIC_CLOCK::~C_MONOTONIC_CLOCK()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  now
+   * @brief     This function returns the time sampled by the last
+   *            update.
+   * @param     None.
+   * @return    Time in milli seconds.
+   * @note      No system call is made here.
+  ********************************************************************/
+  Time C_MONOTONIC_CLOCK::now(void) const
+  {
+    return m_cached_time;
+  }
+
+  /********************************************************************
+   * @function  update
+   * @brief     This function samples CLOCK_MONOTONIC.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_MONOTONIC_CLOCK::update(void)
+  {
+    struct timespec mono_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &mono_time);
+
+    m_cached_time = ((Time)mono_time.tv_sec * M_MSEC_PER_SEC) + (mono_time.tv_nsec / 1000000);
+  }
+
+  /********************************************************************
+   * @function  C_VIRTUAL_CLOCK
+   * @brief     This function is the constructor of C_VIRTUAL_CLOCK.
+   * @param     start_time.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_VIRTUAL_CLOCK::C_VIRTUAL_CLOCK(Time start_time)
+  {
+    m_cur_time = start_time;
+  }
+
+  /********************************************************************
+   * @function  ~C_VIRTUAL_CLOCK
+   * @brief     This function is the destructor of C_VIRTUAL_CLOCK.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_VIRTUAL_CLOCK::~C_VIRTUAL_CLOCK()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  now
+   * @brief     This function returns the virtual time.
+   * @param     None.
+   * @return    Time in milli seconds.
+   * @note      None.
+  ********************************************************************/
+  Time C_VIRTUAL_CLOCK::now(void) const
+  {
+    return m_cur_time;
+  }
+
+  /********************************************************************
+   * @function  advance
+   * @brief     This function moves the virtual time forward.
+   * @param     delta.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_VIRTUAL_CLOCK::advance(Time delta)
+  {
+    if(delta > 0)
+      {
+        m_cur_time += delta;
+      }
+  }
+
+  /********************************************************************
+   * @function  advance_to
+   * @brief     This function moves the virtual time forward to the
+   *            given time, typically the next scheduler deadline.
+   * @param     new_time.
+   * @return    None.
+   * @note      The time never goes backwards.
+  ********************************************************************/
+  void C_VIRTUAL_CLOCK::advance_to(Time new_time)
+  {
+    if(new_time > m_cur_time)
+      {
+        m_cur_time = new_time;
+      }
+  }
+
+  /********************************************************************
+   * @function  set_olsr_clock
+   * @brief     This function installs the clock used by the OLSR
+   *            instances running on the calling thread.
+   * @param     clock.
+   * @return    None.
+   * @note      NULL restores the monotonic clock.
+  ********************************************************************/
+  void set_olsr_clock(C_OLSR_CLOCK* clock)
+  {
+    g_olsr_clock = (clock != NULL) ? clock : &g_monotonic_clock;
+  }
+
+  /********************************************************************
+   * @function  get_olsr_clock
+   * @brief     This function returns the clock of the calling thread.
+   * @param     None.
+   * @return    clock.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_CLOCK* get_olsr_clock(void)
+  {
+    return g_olsr_clock;
+  }
+
+  /********************************************************************
+   * @function  get_cur_time
+   * @brief     This function returns the current time
+   * @param     None.
+   * @return    Time in milli seconds.
+   * @note      None.
+  ********************************************************************/
+  Time get_cur_time()
+  {
+    return g_olsr_clock->now();
+  }
+
+}
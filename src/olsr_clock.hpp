@@ -0,0 +1,94 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_clock.hpp
+ *
+ * Description        :   To store the clocks used by olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_CLOCK_HPP_
+#define OLSR_CLOCK_HPP_
+
+#include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+
+namespace ns_olsr2_0
+{
+
+  /**
+   * Time source of the OLSR instances, get_cur_time() returns the
+   * time of the clock installed for the calling thread
+   */
+  class C_OLSR_CLOCK
+  {
+
+  public:
+    virtual ~C_OLSR_CLOCK();
+
+    virtual Time now(void) const = 0;   /* Returns the current time in milli seconds */
+
+    virtual void update(void);          /* Samples the time source, once per event loop iteration */
+  };
+
+  /**
+   * CLOCK_MONOTONIC based clock, the time is sampled by update() and
+   * cached until the next update
+   */
+  class C_MONOTONIC_CLOCK : public C_OLSR_CLOCK
+  {
+
+  public:
+    C_MONOTONIC_CLOCK();
+
+    ~C_MONOTONIC_CLOCK();
+
+    Time now(void) const;
+
+    void update(void);
+
+  private:
+
+    Time m_cached_time;                 /* Time sampled by the last update */
+  };
+
+  /**
+   * Clock moved by the simulator, used to fast forward long scenarios
+   */
+  class C_VIRTUAL_CLOCK : public C_OLSR_CLOCK
+  {
+
+  public:
+    C_VIRTUAL_CLOCK(Time start_time = 0);
+
+    ~C_VIRTUAL_CLOCK();
+
+    Time now(void) const;
+
+    void advance(Time delta);           /* Moves the time forward by delta */
+
+    void advance_to(Time new_time);     /* Moves the time forward to new_time, never backwards */
+
+  private:
+
+    Time m_cur_time;                    /* Current virtual time */
+  };
+
+  void set_olsr_clock(C_OLSR_CLOCK* clock);   /* Installs the clock of the calling thread, NULL restores the monotonic clock */
+
+  C_OLSR_CLOCK* get_olsr_clock(void);         /* Returns the clock of the calling thread */
+
+}
+
+#endif /* OLSR_CLOCK_HPP_ */
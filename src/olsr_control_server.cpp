@@ -0,0 +1,287 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_control_server.cpp
+ *
+ * Description        :   Implements the local control socket of the olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "olsr_control_server.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  C_OLSR_CONTROL_SERVER
+   * @brief     This function is the constructor of
+   *            C_OLSR_CONTROL_SERVER.
+   * @param     socket_path - Path of the Unix socket.
+   *            signal_dump_path - File written on a signal.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_CONTROL_SERVER::C_OLSR_CONTROL_SERVER(const std::string& socket_path, const std::string& signal_dump_path)
+  : m_socket_path(socket_path), m_signal_dump_path(signal_dump_path), m_listen_fd(-1), m_running(false)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_CONTROL_SERVER
+   * @brief     This function is the destructor of
+   *            C_OLSR_CONTROL_SERVER.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_CONTROL_SERVER::~C_OLSR_CONTROL_SERVER()
+  {
+    stop();
+  }
+
+  /********************************************************************
+   * @function  add_node
+   * @brief     This function adds an instance to the dumps.
+   * @param     node.
+   * @return    None.
+   * @note      Only call it before start.
+  ********************************************************************/
+  void C_OLSR_CONTROL_SERVER::add_node(C_OLSR* node)
+  {
+    m_nodes.push_back(node);
+  }
+
+  /********************************************************************
+   * @function  start
+   * @brief     This function opens the control socket and starts the
+   *            control thread.
+   * @param     None.
+   * @return    true if the socket is listening.
+   * @note      A stale socket file of the same path is removed.
+  ********************************************************************/
+  T_BOOL C_OLSR_CONTROL_SERVER::start(void)
+  {
+    struct sockaddr_un addr = {};
+
+    if((m_running.load() == true) or (m_socket_path.size() >= sizeof(addr.sun_path)))
+      {
+        return false;
+      }
+
+    m_listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if(m_listen_fd < 0)
+      {
+        return false;
+      }
+
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, m_socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    unlink(m_socket_path.c_str());
+
+    if((bind(m_listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) or (listen(m_listen_fd, 4) < 0))
+      {
+        close(m_listen_fd);
+        m_listen_fd = -1;
+        return false;
+      }
+
+    m_running.store(true);
+    m_thread = std::thread(&C_OLSR_CONTROL_SERVER::run, this);
+
+    return true;
+  }
+
+  /********************************************************************
+   * @function  stop
+   * @brief     This function stops the control thread and removes the
+   *            control socket.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_CONTROL_SERVER::stop(void)
+  {
+    if(m_running.exchange(false) == false)
+      {
+        return;
+      }
+
+    m_thread.join();
+
+    close(m_listen_fd);
+    m_listen_fd = -1;
+    unlink(m_socket_path.c_str());
+  }
+
+  /********************************************************************
+   * @function  dump
+   * @brief     This function requests a snapshot of each instance and
+   *            writes them once served.
+   * @param     out.
+   *            binary - Binary snapshots one after the other, otherwise
+   *                     a JSON array.
+   *            filter - Node address to dump, NULL for all.
+   * @return    None.
+   * @note      All requests are raised before the first wait, so the
+   *            protocol threads copy their sets in parallel. An
+   *            instance that does not answer in time is left out.
+  ********************************************************************/
+  void C_OLSR_CONTROL_SERVER::dump(std::ostream& out, T_BOOL binary, const T_NODE_ADDRESS* filter)
+  {
+    std::vector<std::pair<C_OLSR*, T_UINT32>> requests;
+    const char* separator = "\n";
+
+    for(C_OLSR* node : m_nodes)
+      {
+        if((filter == NULL) or (node->get_node_addr() == *filter))
+          {
+            requests.push_back(std::make_pair(node, node->request_state_snapshot()));
+          }
+      }
+
+    if(binary == false)
+      {
+        out << "[";
+      }
+
+    for(const auto& request : requests)
+      {
+        std::shared_ptr<const T_STATE_SNAPSHOT> snapshot = request.first->wait_state_snapshot(request.second, M_CONTROL_SNAPSHOT_TIMEOUT);
+
+        if(snapshot == NULL)
+          {
+            continue;
+          }
+
+        if(binary == true)
+          {
+            C_OLSR_INTROSPECTION::write_binary(out, *snapshot);
+          }
+        else
+          {
+            out << separator;
+            C_OLSR_INTROSPECTION::write_json(out, *snapshot);
+            separator = ",\n";
+          }
+      }
+
+    if(binary == false)
+      {
+        out << "]\n";
+      }
+  }
+
+  /********************************************************************
+   * @function  run
+   * @brief     This function is the control thread, it serves the
+   *            clients and the signal dumps.
+   * @param     None.
+   * @return    None.
+   * @note      Clients are served one at a time.
+  ********************************************************************/
+  void C_OLSR_CONTROL_SERVER::run(void)
+  {
+    T_UINT32 signal_count = C_OLSR_INTROSPECTION::get_signal_count();
+
+    while(m_running.load() == true)
+      {
+        struct pollfd listen_poll = {m_listen_fd, POLLIN, 0};
+
+        if((poll(&listen_poll, 1, M_CONTROL_POLL_MS) > 0) and ((listen_poll.revents & POLLIN) != 0))
+          {
+            int client_fd = accept4(m_listen_fd, NULL, NULL, SOCK_CLOEXEC);
+
+            if(client_fd >= 0)
+              {
+                serve_client(client_fd);
+                close(client_fd);
+              }
+          }
+
+        if(C_OLSR_INTROSPECTION::get_signal_count() != signal_count)
+          {
+            signal_count = C_OLSR_INTROSPECTION::get_signal_count();
+
+            std::ofstream dump_file(m_signal_dump_path);
+
+            dump(dump_file, false, NULL);
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  serve_client
+   * @brief     This function reads a command of a client and writes
+   *            the dump to it.
+   * @param     client_fd.
+   * @return    None.
+   * @note      Unknown commands are answered with an error line.
+  ********************************************************************/
+  void C_OLSR_CONTROL_SERVER::serve_client(int client_fd)
+  {
+    char command[M_CONTROL_MAX_COMMAND + 1] = {};
+    struct pollfd client_poll = {client_fd, POLLIN, 0};
+    ssize_t length = 0;
+
+    if(poll(&client_poll, 1, M_CONTROL_POLL_MS * 10) > 0)
+      {
+        length = recv(client_fd, command, M_CONTROL_MAX_COMMAND, 0);
+      }
+
+    if(length <= 0)
+      {
+        return;
+      }
+
+    char format[M_CONTROL_MAX_COMMAND + 1] = {};
+    T_UINT32 net_id = 0, node_id = 0;
+    T_INT32 fields = sscanf(command, "%64s %u.%u", format, &net_id, &node_id);
+    T_NODE_ADDRESS filter = {(T_UINT8)net_id, (T_UINT8)node_id};
+    std::ostringstream out;
+
+    if((strcmp(format, "json") == 0) or (strcmp(format, "binary") == 0))
+      {
+        dump(out, (strcmp(format, "binary") == 0), (fields == 3) ? &filter : NULL);
+      }
+    else
+      {
+        out << "error: unknown command, expected json|binary [net.node]\n";
+      }
+
+    const std::string& reply = out.str();
+
+    for(size_t sent = 0; sent < reply.size(); )
+      {
+        ssize_t count = send(client_fd, reply.data() + sent, reply.size() - sent, MSG_NOSIGNAL);
+
+        if(count <= 0)
+          {
+            break;
+          }
+        sent += count;
+      }
+  }
+
+}
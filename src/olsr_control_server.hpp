@@ -0,0 +1,82 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_control_server.hpp
+ *
+ * Description        :   To store the local control socket of the olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_CONTROL_SERVER_HPP_
+#define OLSR_CONTROL_SERVER_HPP_
+
+#include <string>
+#include <thread>
+#include "olsr.hpp"                  /* Include file for olsr instance */
+
+namespace ns_olsr2_0
+{
+#define M_CONTROL_POLL_MS           100     /* Period of the signal check of the control thread */
+#define M_CONTROL_SNAPSHOT_TIMEOUT  5000    /* Wait for a protocol thread to serve a snapshot, in milli seconds */
+#define M_CONTROL_MAX_COMMAND       64      /* Longest command line */
+
+  /**
+   * Local control socket dumping the state of the instances. A client
+   * connects to the Unix stream socket, sends "json" or "binary",
+   * optionally followed by a node address "net.node", and reads the
+   * dump until the server closes the connection. A counted signal
+   * (see C_OLSR_INTROSPECTION::install_signal_handler) writes a JSON
+   * dump of all instances to a file. All serialization runs on the
+   * control thread.
+   */
+  class C_OLSR_CONTROL_SERVER
+  {
+
+  public:
+    C_OLSR_CONTROL_SERVER(const std::string& socket_path, const std::string& signal_dump_path);
+
+    ~C_OLSR_CONTROL_SERVER();
+
+    void add_node(C_OLSR* node);        /* Adds an instance, only before start */
+
+    T_BOOL start(void);                 /* Opens the socket and starts the control thread */
+
+    void stop(void);                    /* Stops the control thread and removes the socket */
+
+    /* Writes the snapshots of the instances matching the filter, all if filter is NULL */
+    void dump(std::ostream& out, T_BOOL binary, const T_NODE_ADDRESS* filter);
+
+  private:
+
+    std::string m_socket_path;          /* Path of the Unix socket */
+
+    std::string m_signal_dump_path;     /* File written on a signal */
+
+    std::vector<C_OLSR*> m_nodes;       /* Instances dumped */
+
+    int m_listen_fd;                    /* Listening socket */
+
+    std::atomic<T_BOOL> m_running;      /* True while the control thread runs */
+
+    std::thread m_thread;               /* Control thread */
+
+    void run(void);                     /* Control thread */
+
+    void serve_client(int client_fd);   /* Reads a command and writes its dump */
+  };
+
+}
+
+#endif /* OLSR_CONTROL_SERVER_HPP_ */
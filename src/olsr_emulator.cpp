@@ -0,0 +1,601 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_emulator.cpp
+ *
+ * Description        :   Implements the topology and mobility emulator of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include "olsr_emulator.hpp"
+
+using namespace std;
+
+namespace ns_olsr2_0
+{
+#define M_GRID_SPACING_RATIO    0.9     /* Grid spacing in radio ranges, diagonals stay out of range */
+
+  /********************************************************************
+   * @function  C_OLSR_EMULATOR
+   * @brief     This function is the constructor of C_OLSR_EMULATOR, it
+   *            places the nodes.
+   * @param     config.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_EMULATOR::C_OLSR_EMULATOR(const T_EMULATOR_CONFIG& config)
+    : m_config(config), m_host(config.worker_count), m_rng(config.seed)
+  {
+    if(m_config.cluster_count == 0)
+      {
+        m_config.cluster_count = 1;
+      }
+    m_reverted_adds = 0;
+    m_reverted_losses = 0;
+
+    place_nodes();
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_EMULATOR
+   * @brief     This function is the destructor of C_OLSR_EMULATOR.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_EMULATOR::~C_OLSR_EMULATOR()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  get_default_config
+   * @brief     This function returns a static 10 x 10 grid of lossless
+   *            links run for one minute.
+   * @param     None.
+   * @return    config.
+   * @note      None.
+  ********************************************************************/
+  T_EMULATOR_CONFIG C_OLSR_EMULATOR::get_default_config(void)
+  {
+    T_EMULATOR_CONFIG config;
+
+    config.topology = GRID_TOPOLOGY;
+    config.node_count = 100;
+    config.cluster_count = 1;
+    config.area_size = 1000.0;
+    config.radio_range = 100.0;
+    config.link_delay = M_HOST_DEFAULT_LINK_DELAY;
+    config.loss_ratio = 0;
+    config.bandwidth = 0;
+    config.mobility = STATIC_MOBILITY;
+    config.max_speed = 0;
+    config.mobility_step = M_EMULATOR_MOBILITY_STEP;
+    config.sample_interval = M_EMULATOR_SAMPLE_INTERVAL;
+    config.duration = 60 * M_MSEC_PER_SEC;
+    config.worker_count = 1;
+    config.seed = 1;
+
+    return config;
+  }
+
+  /********************************************************************
+   * @function  place_nodes
+   * @brief     This function creates the instances and gives them an
+   *            address and a position.
+   * @param     None.
+   * @return    None.
+   * @note      Grid and random nodes fill the nets one after the other,
+   *            the nodes of a clustered topology are spread over the
+   *            nets in turn.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::place_nodes(void)
+  {
+    std::uniform_real_distribution<double> area_dist(0, m_config.area_size);
+    std::normal_distribution<double> cluster_dist(0, m_config.radio_range / 2);
+    std::vector<T_NODE_POSITION> centers;
+    T_UINT32 grid_side = (T_UINT32)std::ceil(std::sqrt((double)m_config.node_count));
+
+    if(m_config.topology == GRID_TOPOLOGY)
+      {
+        m_config.area_size = grid_side * m_config.radio_range * M_GRID_SPACING_RATIO;
+      }
+
+    for(T_UINT32 idx = 0; idx < m_config.cluster_count; idx++)
+      {
+        T_NODE_POSITION center;
+
+        center.pos_x = area_dist(m_rng);
+        center.pos_y = area_dist(m_rng);
+        centers.push_back(center);
+      }
+
+    for(T_UINT32 node_idx = 0; node_idx < m_config.node_count; node_idx++)
+      {
+        T_NODE_ADDRESS node_addr;
+        T_NODE_POSITION position;
+
+        if(m_config.topology == GRID_TOPOLOGY)
+          {
+            position.pos_x = (node_idx % grid_side) * m_config.radio_range * M_GRID_SPACING_RATIO;
+            position.pos_y = (node_idx / grid_side) * m_config.radio_range * M_GRID_SPACING_RATIO;
+          }
+        else if(m_config.topology == RANDOM_GEOMETRIC_TOPOLOGY)
+          {
+            position.pos_x = area_dist(m_rng);
+            position.pos_y = area_dist(m_rng);
+          }
+        else
+          {
+            const T_NODE_POSITION& center = centers[node_idx % m_config.cluster_count];
+
+            position.pos_x = std::min(std::max(center.pos_x + cluster_dist(m_rng), 0.0), m_config.area_size);
+            position.pos_y = std::min(std::max(center.pos_y + cluster_dist(m_rng), 0.0), m_config.area_size);
+          }
+
+        if(m_config.topology == CLUSTERED_TOPOLOGY)
+          {
+            node_addr.net_id = 1 + (node_idx % m_config.cluster_count);
+            node_addr.node_id = 1 + (node_idx / m_config.cluster_count);
+          }
+        else
+          {
+            node_addr.net_id = 1 + (node_idx / M_EMULATOR_NODES_PER_NET);
+            node_addr.node_id = 1 + (node_idx % M_EMULATOR_NODES_PER_NET);
+          }
+
+        position.speed = 0;
+        pick_target(position);
+
+        m_host.add_node(node_addr, NORMAL_NODE_INSTANCE);
+        m_positions.push_back(position);
+        m_net_ids.push_back(node_addr.net_id);
+      }
+
+    m_neighbors.resize(m_config.node_count);
+  }
+
+  /********************************************************************
+   * @function  pick_target
+   * @brief     This function picks the next way point of a node, or the
+   *            end of its next random walk step.
+   * @param     position.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::pick_target(T_NODE_POSITION& position)
+  {
+    std::uniform_real_distribution<double> area_dist(0, m_config.area_size);
+    std::uniform_real_distribution<double> speed_dist(m_config.max_speed / 10, m_config.max_speed);
+    std::uniform_real_distribution<double> angle_dist(0, 2 * M_PI);
+
+    if(m_config.mobility == STATIC_MOBILITY)
+      {
+        position.target_x = position.pos_x;
+        position.target_y = position.pos_y;
+        return;
+      }
+
+    position.speed = speed_dist(m_rng);
+
+    if(m_config.mobility == RANDOM_WAYPOINT_MOBILITY)
+      {
+        position.target_x = area_dist(m_rng);
+        position.target_y = area_dist(m_rng);
+      }
+    else
+      {
+        double angle = angle_dist(m_rng);
+        double step = position.speed * m_config.mobility_step / M_MSEC_PER_SEC;
+
+        position.target_x = std::min(std::max(position.pos_x + step * std::cos(angle), 0.0), m_config.area_size);
+        position.target_y = std::min(std::max(position.pos_y + step * std::sin(angle), 0.0), m_config.area_size);
+      }
+  }
+
+  /********************************************************************
+   * @function  move_nodes
+   * @brief     This function moves every node towards its target.
+   * @param     elapsed_sec - time since the last move.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::move_nodes(double elapsed_sec)
+  {
+    for(std::vector<T_NODE_POSITION>::iterator pos_iter = m_positions.begin(); pos_iter != m_positions.end(); pos_iter++)
+      {
+        double delta_x = pos_iter->target_x - pos_iter->pos_x;
+        double delta_y = pos_iter->target_y - pos_iter->pos_y;
+        double distance = std::sqrt((delta_x * delta_x) + (delta_y * delta_y));
+        double travel = pos_iter->speed * elapsed_sec;
+
+        if(travel >= distance)
+          {
+            pos_iter->pos_x = pos_iter->target_x;
+            pos_iter->pos_y = pos_iter->target_y;
+            pick_target(*pos_iter);
+          }
+        else
+          {
+            pos_iter->pos_x += delta_x * travel / distance;
+            pos_iter->pos_y += delta_y * travel / distance;
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  update_links
+   * @brief     This function links the nodes of a net which are within
+   *            the radio range and unlinks the others.
+   * @param     follow_changes - the changes are followed until their
+   *            detection.
+   * @return    Number of links added or removed.
+   * @note      The nodes are bucketed in cells of one radio range, so
+   *            only the 9 surrounding cells are searched. Nodes of
+   *            different nets are not linked, as a HELLO only lists
+   *            the neighbors of its own net.
+  ********************************************************************/
+  T_UINT32 C_OLSR_EMULATOR::update_links(T_BOOL follow_changes)
+  {
+    T_UINT32 cell_side = (T_UINT32)(m_config.area_size / m_config.radio_range) + 1;
+    std::vector<std::vector<T_UINT32> > cells(cell_side * cell_side);
+    double range_sq = m_config.radio_range * m_config.radio_range;
+    T_UINT32 changes = 0;
+
+    for(T_UINT32 node_idx = 0; node_idx < m_positions.size(); node_idx++)
+      {
+        T_UINT32 cell_x = std::min((T_UINT32)(m_positions[node_idx].pos_x / m_config.radio_range), cell_side - 1);
+        T_UINT32 cell_y = std::min((T_UINT32)(m_positions[node_idx].pos_y / m_config.radio_range), cell_side - 1);
+
+        cells[(cell_y * cell_side) + cell_x].push_back(node_idx);
+      }
+
+    for(T_UINT32 node_idx = 0; node_idx < m_positions.size(); node_idx++)
+      {
+        const T_NODE_POSITION& position = m_positions[node_idx];
+        T_INT32 cell_x = std::min((T_UINT32)(position.pos_x / m_config.radio_range), cell_side - 1);
+        T_INT32 cell_y = std::min((T_UINT32)(position.pos_y / m_config.radio_range), cell_side - 1);
+        std::vector<T_UINT32> in_range;
+
+        for(T_INT32 near_y = cell_y - 1; near_y <= cell_y + 1; near_y++)
+          {
+            for(T_INT32 near_x = cell_x - 1; near_x <= cell_x + 1; near_x++)
+              {
+                if((near_x < 0) or (near_y < 0) or (near_x >= (T_INT32)cell_side) or (near_y >= (T_INT32)cell_side))
+                  {
+                    continue;
+                  }
+
+                const std::vector<T_UINT32>& cell = cells[(near_y * cell_side) + near_x];
+
+                for(std::vector<T_UINT32>::const_iterator other = cell.begin(); other != cell.end(); other++)
+                  {
+                    double delta_x = m_positions[*other].pos_x - position.pos_x;
+                    double delta_y = m_positions[*other].pos_y - position.pos_y;
+
+                    if((*other != node_idx) and (m_net_ids[*other] == m_net_ids[node_idx])
+                        and (((delta_x * delta_x) + (delta_y * delta_y)) <= range_sq))
+                      {
+                        in_range.push_back(*other);
+                      }
+                  }
+              }
+          }
+
+        std::sort(in_range.begin(), in_range.end());
+
+        /* Each link is added or removed once, from its lower end */
+        std::vector<T_UINT32>& current = m_neighbors[node_idx];
+        std::vector<T_UINT32> added, removed;
+
+        std::set_difference(in_range.begin(), in_range.end(), current.begin(), current.end(), std::back_inserter(added));
+        std::set_difference(current.begin(), current.end(), in_range.begin(), in_range.end(), std::back_inserter(removed));
+
+        for(std::vector<T_UINT32>::const_iterator other = added.begin(); other != added.end(); other++)
+          {
+            if(*other > node_idx)
+              {
+                m_host.add_link(node_idx, *other, m_config.link_delay, 1.0, m_config.loss_ratio, m_config.bandwidth);
+                changes++;
+                if(follow_changes == true)
+                  {
+                    follow_link_change(node_idx, *other, true);
+                  }
+              }
+          }
+        for(std::vector<T_UINT32>::const_iterator other = removed.begin(); other != removed.end(); other++)
+          {
+            if(*other > node_idx)
+              {
+                m_host.remove_link(node_idx, *other);
+                changes++;
+                if(follow_changes == true)
+                  {
+                    follow_link_change(node_idx, *other, false);
+                  }
+              }
+          }
+
+        current.swap(in_range);
+      }
+
+    return changes;
+  }
+
+  /********************************************************************
+   * @function  get_sensed_links
+   * @brief     This function lists the nodes a node senses as symmetric
+   *            neighbors.
+   * @param     node_idx, sensed.
+   * @return    None.
+   * @note      The list is sorted, as m_neighbors.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::get_sensed_links(T_UINT32 node_idx, std::vector<T_UINT32>& sensed)
+  {
+    Time cur_time = m_host.get_time();
+    const LinkSet& links = m_host.get_node(node_idx).getState().get_links();
+
+    sensed.clear();
+
+    for(LinkSet::const_iterator link_iter = links.begin(); link_iter != links.end(); link_iter++)
+      {
+        if(link_iter->l_sym_time >= cur_time)
+          {
+            sensed.push_back(m_host.find_node(link_iter->l_neighbor_iface_addr));
+          }
+      }
+
+    std::sort(sensed.begin(), sensed.end());
+  }
+
+  /********************************************************************
+   * @function  check_convergence
+   * @brief     This function compares the symmetric links sensed by
+   *            every node to the links of the topology.
+   * @param     None.
+   * @return    true if all the nodes match.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_EMULATOR::check_convergence(void)
+  {
+    std::vector<T_UINT32> sensed;
+
+    for(T_UINT32 node_idx = 0; node_idx < m_neighbors.size(); node_idx++)
+      {
+        get_sensed_links(node_idx, sensed);
+
+        if(sensed != m_neighbors[node_idx])
+          {
+            return false;
+          }
+      }
+
+    return true;
+  }
+
+  /********************************************************************
+   * @function  follow_link_change
+   * @brief     This function starts following a link added or removed
+   *            by the mobility.
+   * @param     node_a - lower end, node_b - higher end, added.
+   * @return    None.
+   * @note      A change of a link still followed reverts the previous
+   *            one, which is counted as undetected.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::follow_link_change(T_UINT32 node_a, T_UINT32 node_b, T_BOOL added)
+  {
+    T_LINK_CHANGE change;
+
+    for(std::vector<T_LINK_CHANGE>::iterator pending = m_pending_changes.begin(); pending != m_pending_changes.end(); pending++)
+      {
+        if((pending->node_a == node_a) and (pending->node_b == node_b))
+          {
+            if(pending->added == true)
+              {
+                m_reverted_adds++;
+              }
+            else
+              {
+                m_reverted_losses++;
+              }
+            m_pending_changes.erase(pending);
+            break;
+          }
+      }
+
+    change.node_a = node_a;
+    change.node_b = node_b;
+    change.added = added;
+    change.change_time = m_host.get_time();
+    m_pending_changes.push_back(change);
+  }
+
+  /********************************************************************
+   * @function  check_link_changes
+   * @brief     This function records the time taken by the pending
+   *            link changes which both ends reflect now.
+   * @param     None.
+   * @return    None.
+   * @note      An added link is reflected once each end senses the
+   *            other as symmetric, a removed one once neither does.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::check_link_changes(void)
+  {
+    Time cur_time = m_host.get_time();
+    std::vector<T_UINT32> sensed_a, sensed_b;
+    std::size_t kept = 0;
+
+    for(std::size_t idx = 0; idx < m_pending_changes.size(); idx++)
+      {
+        const T_LINK_CHANGE& change = m_pending_changes[idx];
+
+        get_sensed_links(change.node_a, sensed_a);
+        get_sensed_links(change.node_b, sensed_b);
+
+        T_BOOL a_senses_b = std::binary_search(sensed_a.begin(), sensed_a.end(), change.node_b);
+        T_BOOL b_senses_a = std::binary_search(sensed_b.begin(), sensed_b.end(), change.node_a);
+
+        if((change.added == true) and (a_senses_b == true) and (b_senses_a == true))
+          {
+            m_add_latencies.push_back(cur_time - change.change_time);
+          }
+        else if((change.added == false) and (a_senses_b == false) and (b_senses_a == false))
+          {
+            m_loss_latencies.push_back(cur_time - change.change_time);
+          }
+        else
+          {
+            m_pending_changes[kept++] = change;
+          }
+      }
+
+    m_pending_changes.resize(kept);
+  }
+
+  /********************************************************************
+   * @function  fill_detection_report
+   * @brief     This function sums up the detection times of one kind
+   *            of link change.
+   * @param     latencies, undetected, detection.
+   * @return    None.
+   * @note      The percentile is the nearest rank, the latencies are
+   *            sorted in place.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::fill_detection_report(std::vector<Time>& latencies, T_UINT32 undetected, T_DETECTION_REPORT& detection)
+  {
+    double sum = 0;
+
+    detection.detected = latencies.size();
+    detection.undetected = undetected;
+    detection.mean_latency = 0;
+    detection.percentile_latency = 0;
+
+    if(latencies.empty() == true)
+      {
+        return;
+      }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    for(std::vector<Time>::const_iterator latency = latencies.begin(); latency != latencies.end(); latency++)
+      {
+        sum += *latency;
+      }
+
+    std::size_t rank = ((latencies.size() * M_EMULATOR_LATENCY_PERCENT) + 99) / 100;
+
+    detection.mean_latency = sum / latencies.size();
+    detection.percentile_latency = latencies[(rank > 0) ? (rank - 1) : 0];
+  }
+
+  /********************************************************************
+   * @function  run
+   * @brief     This function runs the scenario, checking the
+   *            convergence every sample interval and moving the nodes
+   *            every mobility step.
+   * @param     None.
+   * @return    report.
+   * @note      None.
+  ********************************************************************/
+  T_EMULATOR_REPORT C_OLSR_EMULATOR::run(void)
+  {
+    T_EMULATOR_REPORT report;
+    T_UINT32 samples = 0, converged_samples = 0;
+    Time next_move = m_config.mobility_step;
+
+    report.convergence_time = -1;
+    report.link_changes = 0;
+
+    /* The initial links are part of the convergence, only the later changes are followed */
+    update_links(false);
+
+    for(Time cur_time = m_config.sample_interval; cur_time <= m_config.duration; cur_time += m_config.sample_interval)
+      {
+        m_host.run_until(cur_time);
+
+        samples++;
+        check_link_changes();
+        if(check_convergence() == true)
+          {
+            converged_samples++;
+            if(report.convergence_time < 0)
+              {
+                report.convergence_time = cur_time;
+              }
+          }
+
+        if((m_config.mobility != STATIC_MOBILITY) and (cur_time >= next_move))
+          {
+            move_nodes((double)m_config.mobility_step / M_MSEC_PER_SEC);
+            report.link_changes += update_links(true);
+            next_move += m_config.mobility_step;
+          }
+      }
+
+    double node_seconds = (double)m_config.node_count * m_config.duration / M_MSEC_PER_SEC;
+
+    T_UINT32 pending_adds = std::count_if(m_pending_changes.begin(), m_pending_changes.end(), [](const T_LINK_CHANGE& change)
+      {
+        return change.added;
+      });
+
+    fill_detection_report(m_add_latencies, m_reverted_adds + pending_adds, report.link_add_detection);
+    fill_detection_report(m_loss_latencies, m_reverted_losses + (m_pending_changes.size() - pending_adds), report.link_loss_detection);
+
+    report.counters = m_host.get_counters();
+    report.converged_ratio = (samples != 0) ? ((double)converged_samples / samples) : 0;
+    report.control_bytes_per_node_sec = (node_seconds > 0) ? (report.counters.bytes_sent / node_seconds) : 0;
+    report.control_packets_per_node_sec = (node_seconds > 0) ? (report.counters.packets_sent / node_seconds) : 0;
+
+    init_memory_report(report.memory);
+    for(T_UINT32 node_idx = 0; node_idx < m_host.get_node_count(); node_idx++)
+      {
+        add_memory_report(report.memory, m_host.get_node(node_idx).getState());
+      }
+
+    return report;
+  }
+
+  /********************************************************************
+   * @function  print_report
+   * @brief     This function prints the scenario and its results.
+   * @param     config, report.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_EMULATOR::print_report(const T_EMULATOR_CONFIG& config, const T_EMULATOR_REPORT& report)
+  {
+    cout << "Emulated nodes = " << config.node_count << " topology = " << config.topology
+         << " mobility = " << config.mobility << " duration = " << config.duration << " ms"
+         << " workers = " << config.worker_count << endl;
+    cout << "Convergence time = " << report.convergence_time << " ms" << endl;
+    cout << "Converged ratio = " << report.converged_ratio << endl;
+    cout << "Link changes = " << report.link_changes << endl;
+    cout << "Link add detection count = " << report.link_add_detection.detected
+         << " mean = " << report.link_add_detection.mean_latency << " ms p" << M_EMULATOR_LATENCY_PERCENT
+         << " = " << report.link_add_detection.percentile_latency << " ms undetected = " << report.link_add_detection.undetected << endl;
+    cout << "Link loss detection count = " << report.link_loss_detection.detected
+         << " mean = " << report.link_loss_detection.mean_latency << " ms p" << M_EMULATOR_LATENCY_PERCENT
+         << " = " << report.link_loss_detection.percentile_latency << " ms undetected = " << report.link_loss_detection.undetected << endl;
+    cout << "Control bytes per node per second = " << report.control_bytes_per_node_sec << endl;
+    cout << "Control packets per node per second = " << report.control_packets_per_node_sec << endl;
+    cout << "Packets lost = " << report.counters.packets_lost << endl;
+    print_memory_report(cout, report.memory);
+  }
+
+}
@@ -0,0 +1,202 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_emulator.hpp
+ *
+ * Description        :   To store the topology and mobility emulator of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_EMULATOR_HPP_
+#define OLSR_EMULATOR_HPP_
+
+#include <random>
+#include "olsr_parallel_host.hpp"    /* Include file for the parallel host */
+#include "olsr_memory_report.hpp"    /* Include file for the tuple memory report */
+
+namespace ns_olsr2_0
+{
+#define M_EMULATOR_NODES_PER_NET    254     /* Nodes of one orthogonal net, node id 0 is kept for the leader */
+#define M_EMULATOR_SAMPLE_INTERVAL  100     /* Convergence check period, in milli seconds */
+#define M_EMULATOR_MOBILITY_STEP    1000    /* Position update period, in milli seconds */
+#define M_EMULATOR_LATENCY_PERCENT  95      /* Percentile of the detection latency in the report */
+
+  /**
+   * Placement of the nodes
+   */
+  typedef enum
+  {
+    GRID_TOPOLOGY = 0X0,                /* Square grid, each node reaches its 4 closest nodes */
+    RANDOM_GEOMETRIC_TOPOLOGY = 0X1,    /* Uniform placement, links within the radio range */
+    CLUSTERED_TOPOLOGY = 0X2            /* One cluster of nodes per net id */
+  }E_TOPOLOGY_TYPE;
+
+  /**
+   * Movement of the nodes
+   */
+  typedef enum
+  {
+    STATIC_MOBILITY = 0X0,              /* Nodes never move */
+    RANDOM_WAYPOINT_MOBILITY = 0X1,     /* Nodes move to random targets at a random speed */
+    RANDOM_WALK_MOBILITY = 0X2          /* Nodes take a new random direction at every step */
+  }E_MOBILITY_TYPE;
+
+  /**
+   * Scenario of an emulation
+   */
+  typedef struct
+  {
+    E_TOPOLOGY_TYPE topology;           /* Placement of the nodes */
+    T_UINT32 node_count;                /* Number of nodes */
+    T_UINT32 cluster_count;             /* Number of nets of a clustered topology */
+    double area_size;                   /* Side of the square area, in meters */
+    double radio_range;                 /* Distance up to which two nodes are linked, in meters */
+    Time link_delay;                    /* Propagation delay of the links */
+    float loss_ratio;                   /* Packet loss of the links */
+    T_UINT32 bandwidth;                 /* Bits per second of the links, 0 for no limit */
+    E_MOBILITY_TYPE mobility;           /* Movement of the nodes */
+    double max_speed;                   /* Highest speed, in meters per second */
+    Time mobility_step;                 /* Position update period */
+    Time sample_interval;               /* Convergence check period */
+    Time duration;                      /* Length of the emulation */
+    T_UINT32 worker_count;              /* Worker threads of the parallel host */
+    T_UINT32 seed;                      /* Seed of the placement and mobility */
+  }T_EMULATOR_CONFIG;
+
+  /**
+   * Time taken by both ends of the links added or removed by the
+   * mobility to reflect the change, measured to the sample interval
+   */
+  typedef struct
+  {
+    T_UINT32 detected;                  /* Changes reflected by both ends */
+    T_UINT32 undetected;                /* Changes reverted or still not reflected at the end */
+    double mean_latency;                /* Mean time to the detection, in milli seconds */
+    Time percentile_latency;            /* M_EMULATOR_LATENCY_PERCENT percentile of the time to the detection */
+  }T_DETECTION_REPORT;
+
+  /**
+   * Results of an emulation
+   */
+  typedef struct
+  {
+    Time convergence_time;              /* First time every node had sensed all its neighbors, -1 if never */
+    double converged_ratio;             /* Share of the checks at which the nodes were converged */
+    T_UINT32 link_changes;              /* Links added or removed by the mobility */
+    T_DETECTION_REPORT link_add_detection;   /* Time until both ends sense an added link as symmetric */
+    T_DETECTION_REPORT link_loss_detection;  /* Time until neither end senses a removed link as symmetric */
+    double control_bytes_per_node_sec;  /* Control bytes sent per node and per second */
+    double control_packets_per_node_sec;/* Control packets sent per node and per second */
+    T_HOST_COUNTERS counters;           /* Counters of the host */
+    T_MEMORY_REPORT memory;             /* Tuple memory of the nodes at the end */
+  }T_EMULATOR_REPORT;
+
+  /**
+   * Places OLSR instances in a square area, links every pair of nodes
+   * of the same net within the radio range through a virtual link and
+   * moves them during the run. The nodes have converged when the
+   * symmetric links of every node match the links of the topology.
+   * Under mobility they seldom all match at once, so each link change
+   * is also followed until both of its ends reflect it.
+   */
+  class C_OLSR_EMULATOR
+  {
+
+  public:
+    C_OLSR_EMULATOR(const T_EMULATOR_CONFIG& config);
+
+    ~C_OLSR_EMULATOR();
+
+    static T_EMULATOR_CONFIG get_default_config(void);     /* Returns a static 10 x 10 grid */
+
+    T_EMULATOR_REPORT run(void);        /* Runs the scenario and returns its results */
+
+    static void print_report(const T_EMULATOR_CONFIG& config, const T_EMULATOR_REPORT& report);
+
+    C_OLSR_PARALLEL_HOST&
+    get_host ()
+    {
+      return m_host;
+    }
+
+  private:
+
+    /**
+     * Position and movement of a node
+     */
+    typedef struct
+    {
+      double pos_x;                     /* Position, in meters */
+      double pos_y;
+      double target_x;                  /* Way point or direction end */
+      double target_y;
+      double speed;                     /* Meters per second */
+    }T_NODE_POSITION;
+
+    /**
+     * Link added or removed by the mobility, until both ends reflect it
+     */
+    typedef struct
+    {
+      T_UINT32 node_a;                  /* Lower end */
+      T_UINT32 node_b;                  /* Higher end */
+      T_BOOL added;                     /* True if added, false if removed */
+      Time change_time;                 /* Time of the change */
+    }T_LINK_CHANGE;
+
+    T_EMULATOR_CONFIG m_config;
+
+    C_OLSR_PARALLEL_HOST m_host;        /* Instances and virtual links */
+
+    std::mt19937 m_rng;                 /* Random source of the placement and mobility */
+
+    std::vector<T_NODE_POSITION> m_positions;
+
+    std::vector<T_UINT8> m_net_ids;     /* Net id of each node */
+
+    std::vector<std::vector<T_UINT32> > m_neighbors;       /* Current links of each node, sorted */
+
+    std::vector<T_LINK_CHANGE> m_pending_changes;          /* Link changes not reflected yet */
+
+    std::vector<Time> m_add_latencies;  /* Detection times of the added links */
+
+    std::vector<Time> m_loss_latencies; /* Detection times of the removed links */
+
+    T_UINT32 m_reverted_adds;           /* Added links removed before their detection */
+
+    T_UINT32 m_reverted_losses;         /* Removed links added back before their detection */
+
+    void place_nodes(void);             /* Creates the instances and their positions */
+
+    void pick_target(T_NODE_POSITION& position);
+
+    void move_nodes(double elapsed_sec);
+
+    T_UINT32 update_links(T_BOOL follow_changes);      /* Links the nodes in range, returns the number of changes */
+
+    void get_sensed_links(T_UINT32 node_idx, std::vector<T_UINT32>& sensed);   /* Nodes sensed as symmetric, sorted */
+
+    T_BOOL check_convergence(void);     /* Compares the symmetric links of every node to m_neighbors */
+
+    void follow_link_change(T_UINT32 node_a, T_UINT32 node_b, T_BOOL added);
+
+    void check_link_changes(void);      /* Records the detection of the pending link changes */
+
+    static void fill_detection_report(std::vector<Time>& latencies, T_UINT32 undetected, T_DETECTION_REPORT& detection);
+  };
+
+}
+
+#endif /* OLSR_EMULATOR_HPP_ */
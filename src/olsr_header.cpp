@@ -19,11 +19,101 @@
  *
  */
 
+#include <algorithm>
 #include "olsr_header.hpp"
 
 namespace ns_olsr2_0
 {
 
+  /********************************************************************
+   * @function  write_u16
+   * @brief     Writes a 16 bit value in network byte order.
+   * @param     p_buf, value.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  static inline void write_u16(T_UINT8* p_buf, T_UINT16 value)
+  {
+    p_buf[0] = (T_UINT8)(value >> 8);
+    p_buf[1] = (T_UINT8)(value & 0xFF);
+  }
+
+  /********************************************************************
+   * @function  read_u16
+   * @brief     Reads a 16 bit value stored in network byte order.
+   * @param     p_buf.
+   * @return    value.
+   * @note      None.
+  ********************************************************************/
+  static inline T_UINT16 read_u16(const T_UINT8* p_buf)
+  {
+    return (T_UINT16)((p_buf[0] << 8) | p_buf[1]);
+  }
+
+  /********************************************************************
+   * @function  encode_metric
+   * @brief     Converts a link metric to its 8.8 fixed point form.
+   * @param     metric.
+   * @return    encoded metric.
+   * @note      Negative metrics are sent as zero.
+  ********************************************************************/
+  static inline T_UINT16 encode_metric(float metric)
+  {
+    float scaled = metric * M_METRIC_FIXED_POINT_SCALE + 0.5f;
+
+    if(scaled <= 0)
+      {
+        return 0;
+      }
+    if(scaled >= 0xFFFF)
+      {
+        return 0xFFFF;
+      }
+    return (T_UINT16)scaled;
+  }
+
+  /********************************************************************
+   * @function  decode_metric
+   * @brief     Converts an 8.8 fixed point metric to a float.
+   * @param     encoded metric.
+   * @return    metric.
+   * @note      None.
+  ********************************************************************/
+  static inline float decode_metric(T_UINT16 metric)
+  {
+    return ((float)metric / M_METRIC_FIXED_POINT_SCALE);
+  }
+
+  /********************************************************************
+   * @function  write_addr_block
+   * @brief     Writes one address block entry to the buffer.
+   * @param     p_buf, addr_block.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  static inline void write_addr_block(T_UINT8* p_buf, const C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK& addr_block)
+  {
+    p_buf[0] = addr_block.unique_id;
+    p_buf[1] = addr_block.common_field.link_state.type;
+    write_u16(&p_buf[2], encode_metric(addr_block.metric[0]));
+    write_u16(&p_buf[4], encode_metric(addr_block.metric[1]));
+  }
+
+  /********************************************************************
+   * @function  read_addr_block
+   * @brief     Reads one address block entry from the buffer.
+   * @param     p_buf, addr_block.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  static inline void read_addr_block(const T_UINT8* p_buf, C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK& addr_block)
+  {
+    addr_block.unique_id = p_buf[0];
+    addr_block.common_field.link_state.type = p_buf[1];
+    addr_block.metric[0] = decode_metric(read_u16(&p_buf[2]));
+    addr_block.metric[1] = decode_metric(read_u16(&p_buf[4]));
+  }
+
   /********************************************************************
    * @function  C_PACKET_HEADER
    * @brief     This function is the constructor of C_PACKET_HEADER.
@@ -33,7 +123,8 @@ namespace ns_olsr2_0
   ********************************************************************/
   C_PACKET_HEADER::C_PACKET_HEADER ()
   {
-
+    m_packet_length = 0;
+    m_packet_type = 0;
   }
 
   /********************************************************************
@@ -96,31 +187,72 @@ namespace ns_olsr2_0
       return m_packet_type;
   }
 
-#ifdef COMMENT_SECTION
   /********************************************************************
-   * @function  C_MESSAGE_HEADER
-   * @brief     This function is the constructor of C_MESSAGE_HEADER.
-   * @param     length.
-   * @return    None.
+   * @function  get_buffer
+   * @brief     This function returns the serialised packet content.
+   * @param     None.
+   * @return    serialised_buffer.
+   * @note      Only the first m_packet_length bytes are valid.
+  ********************************************************************/
+  const T_UINT8* C_PACKET_HEADER::get_buffer () const
+  {
+      return serialised_buffer.data();
+  }
+
+  /********************************************************************
+   * @function  get_buffer
+   * @brief     This function returns the serialised packet content
+   *            for writing.
+   * @param     None.
+   * @return    serialised_buffer.
    * @note      None.
   ********************************************************************/
-  C_MESSAGE_HEADER::C_MESSAGE_HEADER ()
+  T_UINT8* C_PACKET_HEADER::get_buffer ()
+  {
+      return serialised_buffer.data();
+  }
+
+  /********************************************************************
+   * @function  append_message
+   * @brief     This function serialises a message at the end of the
+   *            packet.
+   * @param     message.
+   * @return    false if the message does not fit in the packet.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_PACKET_HEADER::append_message (const C_MESSAGE_HEADER& message)
   {
+      T_UINT16 msg_len = message.serialize(&serialised_buffer[m_packet_length], serialised_buffer.size() - m_packet_length);
 
+      if(msg_len == 0)
+        {
+          return false;
+        }
+
+      m_packet_length += msg_len;
+      return true;
   }
 
   /********************************************************************
-   * @function  ~C_MESSAGE_HEADER
-   * @brief     This function is the destructor of C_MESSAGE_HEADER.
+   * @function  C_MESSAGE_HEADER
+   * @brief     This function is the constructor of C_MESSAGE_HEADER.
    * @param     None.
    * @return    None.
-   * @note      None.
+   * @note      The body stays empty until get_hello or get_tc is
+   *            called, or the message is deserialized.
   ********************************************************************/
-  C_MESSAGE_HEADER::~C_MESSAGE_HEADER ()
+  C_MESSAGE_HEADER::C_MESSAGE_HEADER ()
   {
-
+    m_message_type = (E_OLSR_MSG_TYPE)0;
+    m_msg_len = 0;
+    m_originator_address.net_id = 0;
+    m_originator_address.node_id = 0;
+    m_time_to_live = 0;
+    m_hop_count = 0;
+    m_message_sequence_number = 0;
+    m_validity_time = 0;
+    m_interval_time = 0;
   }
-#endif
 
   /********************************************************************
    * @function  set_message_type
@@ -159,7 +291,10 @@ namespace ns_olsr2_0
     m_validity_time = SecondsToEmf (time.GetSeconds ());
     #endif
 
-    m_validity_time = time;
+    /* Rounded up so that a sub second part never shortens the validity */
+    time = (time + M_MSEC_PER_SEC - 1) / M_MSEC_PER_SEC;
+
+    m_validity_time = (time > 0xFF) ? 0xFF : (T_UINT8)time;
   }
 
   /********************************************************************
@@ -175,7 +310,7 @@ namespace ns_olsr2_0
     return Seconds (EmfToSeconds (m_validity_time));
     #endif
 
-    return m_validity_time;
+    return ((Time)m_validity_time * M_MSEC_PER_SEC);
   }
 
   /********************************************************************
@@ -187,7 +322,9 @@ namespace ns_olsr2_0
   ********************************************************************/
   void C_MESSAGE_HEADER::set_interval_time (Time time)
   {
-    m_interval_time = time;
+    time = time / M_MSEC_PER_SEC;
+
+    m_interval_time = (time > 0xFF) ? 0xFF : (T_UINT8)time;
   }
 
   /********************************************************************
@@ -199,7 +336,7 @@ namespace ns_olsr2_0
   ********************************************************************/
   Time C_MESSAGE_HEADER::get_interval_time () const
   {
-    return m_interval_time;
+    return ((Time)m_interval_time * M_MSEC_PER_SEC);
   }
 
   /********************************************************************
@@ -332,10 +469,9 @@ namespace ns_olsr2_0
   ********************************************************************/
   const C_MESSAGE_HEADER::T_HELLO& C_MESSAGE_HEADER::get_hello (void) const
   {
-    if(m_message_type == HELLO_MESSAGE)
-      {
-        return m_message.hello;
-      }
+    OLSR_ASSERT(std::holds_alternative<T_HELLO>(m_body));
+
+    return std::get<T_HELLO>(m_body);
   }
 
   /********************************************************************
@@ -348,11 +484,9 @@ namespace ns_olsr2_0
   ********************************************************************/
   const C_MESSAGE_HEADER::T_TC& C_MESSAGE_HEADER::get_tc() const
   {
-   if (m_message_type == TC_MESSAGE)
-   {
-     return m_message.tc;
-   }
+   OLSR_ASSERT(std::holds_alternative<T_TC>(m_body));
 
+   return std::get<T_TC>(m_body);
   }
 
   /********************************************************************
@@ -372,7 +506,12 @@ namespace ns_olsr2_0
     {
         OLSR_ASSERT(m_message_type == HELLO_MESSAGE);
     }
-    return m_message.hello;
+
+    if(std::holds_alternative<T_HELLO>(m_body) == false)
+    {
+        m_body.emplace<T_HELLO>();
+    }
+    return std::get<T_HELLO>(m_body);
   }
 
   /********************************************************************
@@ -392,7 +531,12 @@ namespace ns_olsr2_0
    {
        OLSR_ASSERT(m_message_type == TC_MESSAGE);
    }
-   return m_message.tc;
+
+   if(std::holds_alternative<T_TC>(m_body) == false)
+   {
+       m_body.emplace<T_TC>();
+   }
+   return std::get<T_TC>(m_body);
 
   }
 
@@ -423,9 +567,16 @@ namespace ns_olsr2_0
 
     set_message_sequence_number(msg_seq_num);
 
-    set_validity_time(M_HELLO_MSG_VALID__TIME);
-
-    set_interval_time(M_HELLO_INTERVAL);
+    if(msg_type == E_OLSR_MSG_TYPE::HELLO_MESSAGE)
+      {
+        set_validity_time(M_HELLO_MSG_VALID__TIME * M_MSEC_PER_SEC);
+        set_interval_time(M_HELLO_INTERVAL * M_MSEC_PER_SEC);
+      }
+    else
+      {
+        set_validity_time(M_TC_MSG_VALID_TIME * M_MSEC_PER_SEC);
+        set_interval_time(M_TC_INTERVAL * M_MSEC_PER_SEC);
+      }
 
   }
 
@@ -439,7 +590,7 @@ namespace ns_olsr2_0
   T_UINT16 C_MESSAGE_HEADER::T_HELLO::get_hello_msg_size()
     {
       T_UINT16 size = this->neighbor_set.size();
-      return (size * 6);
+      return (size * M_ADDR_BLOCK_LEN);
 
     }
 
@@ -454,9 +605,9 @@ namespace ns_olsr2_0
     {
       T_UINT16 size = 0;
 
-      for(std::vector<T_TC_ADDRESS_BLOCK>::const_iterator it = this->tc_addr_set.begin(); it != tc_addr_set.end(); it++)
+      for(TcAddrBlockList::const_iterator it = this->tc_addr_set.begin(); it != tc_addr_set.end(); it++)
         {
-          size += ((it->network_info.size() * 6) + 3);
+          size += ((it->network_info.size() * M_ADDR_BLOCK_LEN) + M_TC_ADDR_BLOCK_HEADER_LEN);
         }
 
       return size;
@@ -478,11 +629,11 @@ namespace ns_olsr2_0
     switch(m_message_type)
     {
       case HELLO_MESSAGE:
-        size += (this->m_message.hello.get_hello_msg_size() + M_HELLO_MSG_HEADER_LEN);
+        size += (get_hello().get_hello_msg_size() + M_HELLO_MSG_HEADER_LEN);
         break;
 
       case TC_MESSAGE:
-        size += (this->m_message.tc.get_tc_msg_size() + M_TC_MSG_HEADER_LEN);
+        size += (get_tc().get_tc_msg_size() + M_TC_MSG_HEADER_LEN);
         break;
 
       default:
@@ -494,4 +645,257 @@ namespace ns_olsr2_0
 
 
 
+  /********************************************************************
+   * @function  serialize
+   * @brief     Writes the message header and its Hello/TC content to
+   *            the buffer in network byte order.
+   * @param     p_buf, p_buf_len.
+   * @return    Number of bytes written, 0 if the buffer is too small.
+   * @note      The message length field is taken from the content,
+   *            not from m_msg_len.
+  ********************************************************************/
+  T_UINT16 C_MESSAGE_HEADER::serialize(T_UINT8* p_buf, T_UINT16 p_buf_len) const
+  {
+    T_UINT16 msg_len = 0;
+
+    if(std::holds_alternative<T_HELLO>(m_body) == true)
+      {
+        msg_len = M_HELLO_MSG_HEADER_LEN + (get_hello().neighbor_set.size() * M_ADDR_BLOCK_LEN);
+      }
+    else if(std::holds_alternative<T_TC>(m_body) == true)
+      {
+        msg_len = M_TC_MSG_HEADER_LEN;
+        for(TcAddrBlockList::const_iterator it = get_tc().tc_addr_set.begin(); it != get_tc().tc_addr_set.end(); it++)
+          {
+            msg_len += ((it->network_info.size() * M_ADDR_BLOCK_LEN) + M_TC_ADDR_BLOCK_HEADER_LEN);
+          }
+      }
+    else
+      {
+        return 0;
+      }
+
+    if(msg_len > p_buf_len)
+      {
+        return 0;
+      }
+
+    p_buf[M_MSG_TYPE_OFFSET] = (T_UINT8)m_message_type;
+    write_u16(&p_buf[M_MSG_LEN_OFFSET], msg_len);
+    p_buf[M_MSG_ORIG_OFFSET] = m_originator_address.net_id;
+    p_buf[M_MSG_ORIG_OFFSET + 1] = m_originator_address.node_id;
+    p_buf[M_MSG_TTL_OFFSET] = m_time_to_live;
+    p_buf[M_MSG_HOP_COUNT_OFFSET] = m_hop_count;
+    write_u16(&p_buf[M_MSG_SEQ_NUM_OFFSET], m_message_sequence_number);
+    p_buf[M_MSG_VTIME_OFFSET] = m_validity_time;
+    p_buf[M_MSG_ITIME_OFFSET] = m_interval_time;
+
+    T_UINT16 offset = M_MSG_HEADER_LEN;
+
+    if(m_message_type == HELLO_MESSAGE)
+      {
+        const T_HELLO& hello = get_hello();
+
+        p_buf[offset++] = hello.node_willingness.willingness;
+        p_buf[offset++] = hello.leader_info.is_leader;
+        p_buf[offset++] = hello.leader_info.leader_addr.net_id;
+        p_buf[offset++] = hello.leader_info.leader_addr.node_id;
+        p_buf[offset++] = (T_UINT8)hello.abf;
+        p_buf[offset++] = hello.common_id;
+
+        for(AddrBlockList::const_iterator it = hello.neighbor_set.begin(); it != hello.neighbor_set.end(); it++)
+          {
+            write_addr_block(&p_buf[offset], *it);
+            offset += M_ADDR_BLOCK_LEN;
+          }
+      }
+    else
+      {
+        const T_TC& tc = get_tc();
+
+        write_u16(&p_buf[offset], tc.ansn);
+        offset += 2;
+
+        for(TcAddrBlockList::const_iterator it = tc.tc_addr_set.begin(); it != tc.tc_addr_set.end(); it++)
+          {
+            p_buf[offset++] = (T_UINT8)it->tc_msg_type;
+            p_buf[offset++] = (T_UINT8)it->abf;
+            p_buf[offset++] = it->common_id;
+            p_buf[offset++] = (T_UINT8)it->network_info.size();
+
+            for(AddrBlockList::const_iterator addr_it = it->network_info.begin(); addr_it != it->network_info.end(); addr_it++)
+              {
+                write_addr_block(&p_buf[offset], *addr_it);
+                offset += M_ADDR_BLOCK_LEN;
+              }
+          }
+      }
+
+    return offset;
+  }
+
+  /********************************************************************
+   * @function  peek_header
+   * @brief     Reads the common message header fields without decoding
+   *            the address blocks.
+   * @param     p_buf, p_len, p_raw_header.
+   * @return    true if the header is complete and the message length
+   *            fits in the buffer.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_MESSAGE_HEADER::peek_header(const T_UINT8* p_buf, T_UINT16 p_len, T_RAW_MSG_HEADER& p_raw_header)
+  {
+    if(p_len < M_MSG_HEADER_LEN)
+      {
+        return false;
+      }
+
+    p_raw_header.msg_type = (E_OLSR_MSG_TYPE)p_buf[M_MSG_TYPE_OFFSET];
+    p_raw_header.msg_len = read_u16(&p_buf[M_MSG_LEN_OFFSET]);
+    p_raw_header.orig_addr.net_id = p_buf[M_MSG_ORIG_OFFSET];
+    p_raw_header.orig_addr.node_id = p_buf[M_MSG_ORIG_OFFSET + 1];
+    p_raw_header.time_to_live = p_buf[M_MSG_TTL_OFFSET];
+    p_raw_header.seq_num = read_u16(&p_buf[M_MSG_SEQ_NUM_OFFSET]);
+    p_raw_header.validity_time = p_buf[M_MSG_VTIME_OFFSET];
+
+    return ((p_raw_header.msg_len >= M_MSG_HEADER_LEN) and (p_raw_header.msg_len <= p_len));
+  }
+
+  /********************************************************************
+   * @function  peek_tc_ansn
+   * @brief     Reads the ANSN of a serialised TC message without
+   *            decoding its address blocks.
+   * @param     p_buf, p_raw_header, p_ansn.
+   * @return    true if the message is a TC long enough to carry it.
+   * @note      p_raw_header must be filled by peek_header.
+  ********************************************************************/
+  T_BOOL C_MESSAGE_HEADER::peek_tc_ansn(const T_UINT8* p_buf, const T_RAW_MSG_HEADER& p_raw_header, T_UINT16& p_ansn)
+  {
+    if((p_raw_header.msg_type != TC_MESSAGE) or (p_raw_header.msg_len < M_TC_MSG_HEADER_LEN))
+      {
+        return false;
+      }
+
+    p_ansn = read_u16(&p_buf[M_MSG_HEADER_LEN]);
+    return true;
+  }
+
+  /********************************************************************
+   * @function  write_seq_num
+   * @brief     Writes the sequence number of a serialised message
+   *            without encoding it again.
+   * @param     p_buf, p_seq_num.
+   * @return    None.
+   * @note      The message must be checked by peek_header.
+  ********************************************************************/
+  void C_MESSAGE_HEADER::write_seq_num(T_UINT8* p_buf, T_UINT16 p_seq_num)
+  {
+    write_u16(&p_buf[M_MSG_SEQ_NUM_OFFSET], p_seq_num);
+  }
+
+  /********************************************************************
+   * @function  deserialize
+   * @brief     Decodes the message header and its Hello/TC content
+   *            from the buffer.
+   * @param     p_buf, p_len.
+   * @return    true if the message is well formed.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_MESSAGE_HEADER::deserialize(const T_UINT8* p_buf, T_UINT16 p_len)
+  {
+    T_RAW_MSG_HEADER raw_header;
+
+    if(peek_header(p_buf, p_len, raw_header) == false)
+      {
+        return false;
+      }
+
+    m_message_type = raw_header.msg_type;
+    m_msg_len = raw_header.msg_len;
+    m_originator_address = raw_header.orig_addr;
+    m_time_to_live = raw_header.time_to_live;
+    m_hop_count = p_buf[M_MSG_HOP_COUNT_OFFSET];
+    m_message_sequence_number = raw_header.seq_num;
+    m_validity_time = raw_header.validity_time;
+    m_interval_time = p_buf[M_MSG_ITIME_OFFSET];
+
+    T_UINT16 offset = M_MSG_HEADER_LEN;
+    T_UINT16 msg_len = raw_header.msg_len;
+
+    if(m_message_type == HELLO_MESSAGE)
+      {
+        if(msg_len < M_HELLO_MSG_HEADER_LEN)
+          {
+            return false;
+          }
+
+        T_HELLO& hello = (std::holds_alternative<T_HELLO>(m_body) == true) ? std::get<T_HELLO>(m_body) : m_body.emplace<T_HELLO>();
+
+        hello.node_willingness.willingness = p_buf[offset++];
+        hello.leader_info.is_leader = (p_buf[offset++] != 0);
+        hello.leader_info.leader_addr.net_id = p_buf[offset++];
+        hello.leader_info.leader_addr.node_id = p_buf[offset++];
+        hello.abf = (E_ADDRESS_BLOCK_FLAGS)p_buf[offset++];
+        hello.common_id = p_buf[offset++];
+
+        hello.neighbor_set.clear();
+        hello.neighbor_set.reserve(std::min<std::size_t>((msg_len - offset) / M_ADDR_BLOCK_LEN, hello.neighbor_set.max_size()));
+
+        while((offset + M_ADDR_BLOCK_LEN) <= msg_len)
+          {
+            if(hello.neighbor_set.size() == hello.neighbor_set.max_size())
+              {
+                return false;
+              }
+            read_addr_block(&p_buf[offset], hello.neighbor_set.emplace_back());
+            offset += M_ADDR_BLOCK_LEN;
+          }
+      }
+    else if(m_message_type == TC_MESSAGE)
+      {
+        if(msg_len < M_TC_MSG_HEADER_LEN)
+          {
+            return false;
+          }
+
+        T_TC& tc = (std::holds_alternative<T_TC>(m_body) == true) ? std::get<T_TC>(m_body) : m_body.emplace<T_TC>();
+
+        tc.ansn = read_u16(&p_buf[offset]);
+        offset += 2;
+
+        tc.tc_addr_set.clear();
+
+        while((offset + M_TC_ADDR_BLOCK_HEADER_LEN) <= msg_len)
+          {
+            if(tc.tc_addr_set.size() == tc.tc_addr_set.max_size())
+              {
+                return false;
+              }
+            T_TC_ADDRESS_BLOCK& tc_block = tc.tc_addr_set.emplace_back();
+            tc_block.tc_msg_type = (E_TC_ADDRESS_TYPE)p_buf[offset++];
+            tc_block.abf = (E_ADDRESS_BLOCK_FLAGS)p_buf[offset++];
+            tc_block.common_id = p_buf[offset++];
+            T_UINT8 addr_count = p_buf[offset++];
+
+            if(((offset + (addr_count * M_ADDR_BLOCK_LEN)) > msg_len) or (addr_count > tc_block.network_info.max_size()))
+              {
+                return false;
+              }
+
+            tc_block.network_info.resize(addr_count);
+            for(T_UINT8 idx = 0; idx < addr_count; idx++)
+              {
+                read_addr_block(&p_buf[offset], tc_block.network_info[idx]);
+                offset += M_ADDR_BLOCK_LEN;
+              }
+          }
+      }
+    else
+      {
+        return false;
+      }
+
+    return true;
+  }
+
 }
@@ -23,12 +23,42 @@
 #ifndef OLSR_HEADER_HPP_
 #define OLSR_HEADER_HPP_
 
+#include <variant>
 #include "olsr_types.hpp"
+#include "olsr_small_vector.hpp"     /* Include file for the inline address block lists */
+#include "olsr_static_memory.hpp"    /* Include file for the static build switch */
 
 namespace ns_olsr2_0
 {
-#define M_HELLO_MSG_HEADER_LEN    14
-#define M_TC_MSG_HEADER_LEN       10
+#define M_MSG_HEADER_LEN          11                          /* Length of the common message header on the wire */
+#define M_HELLO_MSG_HEADER_LEN    (M_MSG_HEADER_LEN + 6)      /* Common header + willingness, leader info, abf, common id */
+#define M_TC_MSG_HEADER_LEN       (M_MSG_HEADER_LEN + 2)      /* Common header + ansn */
+#define M_TC_ADDR_BLOCK_HEADER_LEN 4                          /* Address type, abf, common id, address count */
+#define M_ADDR_BLOCK_LEN          6                           /* Unique id, common field, out metric, in metric */
+
+/* Offsets of the common message header fields in the serialised buffer */
+#define M_MSG_TYPE_OFFSET         0
+#define M_MSG_LEN_OFFSET          1
+#define M_MSG_ORIG_OFFSET         3
+#define M_MSG_TTL_OFFSET          5
+#define M_MSG_HOP_COUNT_OFFSET    6
+#define M_MSG_SEQ_NUM_OFFSET      7
+#define M_MSG_VTIME_OFFSET        9
+#define M_MSG_ITIME_OFFSET        10
+
+#define M_METRIC_FIXED_POINT_SCALE 256                        /* Metrics are carried as 8.8 fixed point values */
+
+#ifdef M_STATIC_MEMORY
+#define M_INLINE_ADDR_BLOCKS      ((MAX_OLSR_BUF_SIZE - M_HELLO_MSG_HEADER_LEN) / M_ADDR_BLOCK_LEN)   /* Most address blocks a message can carry */
+#define M_INLINE_TC_BLOCKS        M_STATIC_MAX_TC_BLOCKS
+#define M_FIXED_MSG_LISTS         true                        /* Address block lists never allocate */
+#else
+#define M_INLINE_ADDR_BLOCKS      8                           /* Address blocks of a list kept without allocation */
+#define M_INLINE_TC_BLOCKS        1                           /* TC address blocks kept without allocation, one per net */
+#define M_FIXED_MSG_LISTS         false                       /* Address block lists grow on the heap past the inline blocks */
+#endif
+
+class C_MESSAGE_HEADER;
 
 class C_PACKET_HEADER
 {
@@ -53,11 +83,20 @@ public:
   /* Get the packet type. */
   T_UINT16 get_packet_type () const;
 
+  /* Gets the serialised packet content */
+  const T_UINT8* get_buffer () const;
+
+  /* Gets the serialised packet content for writing */
+  T_UINT8* get_buffer ();
+
+  /* Appends a serialised message to the packet */
+  T_BOOL append_message (const C_MESSAGE_HEADER& message);
+
 private:
   T_UINT16 m_packet_length;           /* The packet length */
   T_UINT16 m_packet_type;  /* The packet type */
 
-  std::array<T_UINT8, 512> serialised_buffer;
+  std::array<T_UINT8, MAX_OLSR_BUF_SIZE> serialised_buffer;
 
 };
 
@@ -65,14 +104,7 @@ class C_MESSAGE_HEADER
 {
 	public:
 
-#ifdef COMMENT_SECTION
-	C_MESSAGE_HEADER ();              /* Constructor */
-	#ifdef M_NS3_SIM
-		virtual ~C_MESSAGE_HEADER (); /* Destructor */
-	#else
-		~C_MESSAGE_HEADER ();         /* Destructor */
-	#endif
-#endif
+	C_MESSAGE_HEADER ();              /* Constructor, no destructor is declared so that messages keep their moves */
 
 	/* Sets the message type. */
     void set_message_type (E_OLSR_MSG_TYPE message_type);
@@ -154,6 +186,8 @@ class C_MESSAGE_HEADER
 			std::array<float,2> metric;        /* metric[1] - In link metric and metric[0] - out link metric */
 		}T_GENERIC_ADDR_BLOCK;
 
+		typedef C_SMALL_VECTOR<T_GENERIC_ADDR_BLOCK, M_INLINE_ADDR_BLOCKS, M_FIXED_MSG_LISTS> AddrBlockList;   /* Address TLVs, inline up to M_INLINE_ADDR_BLOCKS */
+
 		/*------------------------------------------------------------------
 		 Hello Message
 		------------------------------------------------------------------*/
@@ -167,7 +201,7 @@ class C_MESSAGE_HEADER
 		    T_LEADER_TUPLE leader_info;                              /* Info about Leader of the network */
 		    E_ADDRESS_BLOCK_FLAGS abf;                               /* Address block Flags */
             T_UINT8 common_id;                                       /* Orthogonal network address/ Node address */
-            std::vector<T_GENERIC_ADDR_BLOCK> neighbor_set;          /* Address TLVs of Hello message */
+            AddrBlockList neighbor_set;                              /* Address TLVs of Hello message */
 
             /* Finds  the size of the hello message */
             T_UINT16 get_hello_msg_size();
@@ -182,9 +216,11 @@ class C_MESSAGE_HEADER
 		  E_TC_ADDRESS_TYPE tc_msg_type;
 		  E_ADDRESS_BLOCK_FLAGS abf;                                  /* Address block Flags */
           T_UINT8 common_id;                                          /* Orthogonal network address/ Node address */
-          std::vector<T_GENERIC_ADDR_BLOCK> network_info;             /* Address TLVs of TC message */
+          AddrBlockList network_info;                                 /* Address TLVs of TC message */
 		}T_TC_ADDRESS_BLOCK;
 
+		typedef C_SMALL_VECTOR<T_TC_ADDRESS_BLOCK, M_INLINE_TC_BLOCKS, M_FIXED_MSG_LISTS> TcAddrBlockList;    /* TC address blocks, inline up to M_INLINE_TC_BLOCKS */
+
 
 		/**
 		 * It stores complete TC message
@@ -192,32 +228,35 @@ class C_MESSAGE_HEADER
 		typedef struct
 		{
 		    T_UINT16 ansn;                                             /* Advertised neighbor sequence number*/
-		    std::vector<T_TC_ADDRESS_BLOCK> tc_addr_set;
+		    TcAddrBlockList tc_addr_set;
 
 		    /* Finds  the size of the tc message */
 		    T_UINT16 get_tc_msg_size();
 		}T_TC;
 
 		/**
-		 * Holds Hello and TC messages
+		 * Common header fields read straight from the serialised buffer,
+		 * used to drop a message before its address blocks are decoded
 		 */
 		typedef struct
 		{
-		    E_OLSR_MSG_TYPE m_message_type;         /* Message type of current OLSR instance */
-		    T_UINT16 m_msg_len;                     /* Message address length of current OLSR instance */
-		    T_NODE_ADDRESS m_originator_address;    /* Message originator address of current OLSR instance */
-            T_UINT8 m_time_to_live;                 /* Time to live of a message of current OLSR instance */
-            T_UINT8 m_hop_count;                    /* Hop count of a message of current OLSR instance */
-            T_UINT16 m_message_sequence_number;     /* Sequence number of a message of current OLSR instance */
-            T_UINT8 m_validity_time;                   /* Validity time of a message of current OLSR instance */
-            T_UINT8 m_interval_time;                   /* Interval time of a message of current OLSR instance */
-			T_HELLO hello;      /* Hello message */
-			T_TC tc;            /* Topology control message */
-		}T_MESSAGE;
+		    E_OLSR_MSG_TYPE msg_type;               /* Message type */
+		    T_UINT16 msg_len;                       /* Length of the whole message */
+		    T_NODE_ADDRESS orig_addr;               /* Originator address */
+		    T_UINT8 time_to_live;                   /* Time to live */
+		    T_UINT16 seq_num;                       /* Message sequence number */
+		    T_UINT8 validity_time;                  /* Validity time */
+		}T_RAW_MSG_HEADER;
+
+		/**
+		 * Body of a message, empty until the message type is set. The
+		 * header fields are only kept in the class.
+		 */
+		typedef std::variant<std::monostate, T_HELLO, T_TC> T_MESSAGE_BODY;
 
 	private:
 
-		T_MESSAGE m_message;
+		T_MESSAGE_BODY m_body;
 
 
 	public:
@@ -240,6 +279,21 @@ class C_MESSAGE_HEADER
 
       /* sets the common attributes like message type, hop count etc of OLSR message */
       void set_message_attributes(T_NODE_ADDRESS node_address, E_OLSR_MSG_TYPE msg_type, T_UINT16 msg_seq_num);
+
+      /* Writes the message to the buffer and returns the number of bytes written */
+      T_UINT16 serialize(T_UINT8* p_buf, T_UINT16 p_buf_len) const;
+
+      /* Decodes the complete message from the buffer */
+      T_BOOL deserialize(const T_UINT8* p_buf, T_UINT16 p_len);
+
+      /* Reads only the common header fields from the buffer */
+      static T_BOOL peek_header(const T_UINT8* p_buf, T_UINT16 p_len, T_RAW_MSG_HEADER& p_raw_header);
+
+      /* Reads only the ANSN of a serialised TC message */
+      static T_BOOL peek_tc_ansn(const T_UINT8* p_buf, const T_RAW_MSG_HEADER& p_raw_header, T_UINT16& p_ansn);
+
+      /* Writes only the sequence number of a serialised message */
+      static void write_seq_num(T_UINT8* p_buf, T_UINT16 p_seq_num);
 };
 
 }
@@ -0,0 +1,262 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_histogram.cpp
+ *
+ * Description        :   Implements the latency histograms of the protocol phases .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <iostream>
+#include <cmath>
+#include "olsr_histogram.hpp"
+
+using namespace std;
+
+namespace ns_olsr2_0
+{
+
+  std::atomic<C_PHASE_HISTOGRAMS::T_PHASE_SLOT*> C_PHASE_HISTOGRAMS::s_slots(NULL);
+
+  /********************************************************************
+   * @function  register_slot
+   * @brief     This function gives the calling thread the slot of an
+   *            exited thread, or links a new slot to the slot list.
+   * @param     None.
+   * @return    Slot.
+   * @note      Called once per thread, on its first record.
+  ********************************************************************/
+  C_PHASE_HISTOGRAMS::T_PHASE_SLOT* C_PHASE_HISTOGRAMS::register_slot(void)
+  {
+    static thread_local C_SLOT_OWNER t_owner;
+    T_PHASE_SLOT* slot;
+
+    for(slot = s_slots.load(std::memory_order_acquire); slot != NULL; slot = slot->next)
+      {
+        T_BOOL released = false;
+
+        if(slot->in_use.compare_exchange_strong(released, true, std::memory_order_acquire) == true)
+          {
+            t_owner.m_slot = slot;
+            return slot;
+          }
+      }
+
+    slot = new T_PHASE_SLOT();
+
+    for(T_UINT32 phase = 0; phase < MAX_PROTOCOL_PHASE; phase++)
+      {
+        for(T_UINT32 bucket = 0; bucket < M_HIST_BUCKET_COUNT; bucket++)
+          {
+            slot->buckets[phase][bucket].store(0, std::memory_order_relaxed);
+          }
+        slot->count[phase].store(0, std::memory_order_relaxed);
+        slot->sum[phase].store(0, std::memory_order_relaxed);
+        slot->max[phase].store(0, std::memory_order_relaxed);
+      }
+    slot->in_use.store(true, std::memory_order_relaxed);
+
+    slot->next = s_slots.load(std::memory_order_relaxed);
+
+    while(s_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed) == false)
+      {
+        ;
+      }
+
+    t_owner.m_slot = slot;
+
+    return slot;
+  }
+
+  /********************************************************************
+   * @function  get_bucket_value
+   * @brief     This function returns the highest value counted in a
+   *            bucket.
+   * @param     bucket.
+   * @return    Value in nano seconds.
+   * @note      None.
+  ********************************************************************/
+  T_UINT64 C_PHASE_HISTOGRAMS::get_bucket_value(T_UINT32 bucket)
+  {
+    if(bucket < M_HIST_SUB_BUCKETS)
+      {
+        return bucket;
+      }
+
+    T_UINT32 shift = (bucket >> M_HIST_SUB_BUCKET_BITS) - 1;
+    T_UINT64 sub_bucket = M_HIST_SUB_BUCKETS + (bucket & (M_HIST_SUB_BUCKETS - 1));
+
+    return ((sub_bucket + 1) << shift) - 1;
+  }
+
+  /********************************************************************
+   * @function  get_percentile
+   * @brief     This function returns the latency below which the given
+   *            percentage of the samples fall.
+   * @param     histogram, percentile.
+   * @return    Value in nano seconds, 0 if the histogram is empty.
+   * @note      The value is the top of its bucket, capped by the max.
+  ********************************************************************/
+  T_UINT64 C_PHASE_HISTOGRAMS::get_percentile(const T_LATENCY_HISTOGRAM& histogram, double percentile)
+  {
+    T_UINT64 rank = (T_UINT64)std::ceil((histogram.count * percentile) / 100);
+    T_UINT64 seen = 0;
+
+    if(histogram.count == 0)
+      {
+        return 0;
+      }
+
+    for(T_UINT32 bucket = 0; bucket < M_HIST_BUCKET_COUNT; bucket++)
+      {
+        seen += histogram.buckets[bucket];
+
+        if((seen >= rank) and (seen != 0))
+          {
+            return std::min(get_bucket_value(bucket), histogram.max);
+          }
+      }
+
+    return histogram.max;
+  }
+
+  /********************************************************************
+   * @function  snapshot
+   * @brief     This function merges the histograms of all the threads.
+   * @param     histograms.
+   * @return    None.
+   * @note      Lock free, the threads keep recording.
+  ********************************************************************/
+  void C_PHASE_HISTOGRAMS::snapshot(std::array<T_LATENCY_HISTOGRAM, MAX_PROTOCOL_PHASE>& histograms)
+  {
+    for(T_UINT32 phase = 0; phase < MAX_PROTOCOL_PHASE; phase++)
+      {
+        histograms[phase].buckets.fill(0);
+        histograms[phase].count = 0;
+        histograms[phase].sum = 0;
+        histograms[phase].max = 0;
+      }
+
+    for(const T_PHASE_SLOT* slot = s_slots.load(std::memory_order_acquire); slot != NULL; slot = slot->next)
+      {
+        for(T_UINT32 phase = 0; phase < MAX_PROTOCOL_PHASE; phase++)
+          {
+            T_LATENCY_HISTOGRAM& histogram = histograms[phase];
+
+            for(T_UINT32 bucket = 0; bucket < M_HIST_BUCKET_COUNT; bucket++)
+              {
+                histogram.buckets[bucket] += slot->buckets[phase][bucket].load(std::memory_order_relaxed);
+              }
+            histogram.count += slot->count[phase].load(std::memory_order_relaxed);
+            histogram.sum += slot->sum[phase].load(std::memory_order_relaxed);
+            histogram.max = std::max(histogram.max, slot->max[phase].load(std::memory_order_relaxed));
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  get_phase_name
+   * @brief     This function returns the name of a phase.
+   * @param     phase.
+   * @return    Name.
+   * @note      None.
+  ********************************************************************/
+  const char* C_PHASE_HISTOGRAMS::get_phase_name(E_PROTOCOL_PHASE phase)
+  {
+    static const char* const phase_names[MAX_PROTOCOL_PHASE] =
+      {
+        "recv_olsr", "link_sensing", "populate_two_hop_set", "process_tc",
+        "mpr_computation", "routing_table_computation", "send_hello",
+        "send_tc"
+      };
+
+    return (phase < MAX_PROTOCOL_PHASE) ? phase_names[phase] : "unknown";
+  }
+
+  /********************************************************************
+   * @function  write_text
+   * @brief     This function writes one line of percentiles per phase.
+   * @param     out.
+   * @return    None.
+   * @note      Times are in nano seconds.
+  ********************************************************************/
+  void C_PHASE_HISTOGRAMS::write_text(std::ostream& out)
+  {
+    std::array<T_LATENCY_HISTOGRAM, MAX_PROTOCOL_PHASE> histograms;
+
+    snapshot(histograms);
+
+    for(T_UINT32 phase = 0; phase < MAX_PROTOCOL_PHASE; phase++)
+      {
+        const T_LATENCY_HISTOGRAM& histogram = histograms[phase];
+
+        out << get_phase_name((E_PROTOCOL_PHASE)phase)
+            << " count = " << histogram.count
+            << " mean = " << ((histogram.count != 0) ? (histogram.sum / histogram.count) : 0)
+            << " p50 = " << get_percentile(histogram, 50)
+            << " p90 = " << get_percentile(histogram, 90)
+            << " p99 = " << get_percentile(histogram, 99)
+            << " p99.9 = " << get_percentile(histogram, 99.9)
+            << " max = " << histogram.max << " ns" << endl;
+      }
+  }
+
+  /********************************************************************
+   * @function  write_json
+   * @brief     This function writes the percentiles and the non empty
+   *            buckets of each phase as a JSON document.
+   * @param     out.
+   * @return    None.
+   * @note      A bucket is written as [highest value, count].
+  ********************************************************************/
+  void C_PHASE_HISTOGRAMS::write_json(std::ostream& out)
+  {
+    std::array<T_LATENCY_HISTOGRAM, MAX_PROTOCOL_PHASE> histograms;
+
+    snapshot(histograms);
+
+    out << "{\"unit\": \"ns\", \"phases\": [" << endl;
+
+    for(T_UINT32 phase = 0; phase < MAX_PROTOCOL_PHASE; phase++)
+      {
+        const T_LATENCY_HISTOGRAM& histogram = histograms[phase];
+        T_BOOL first = true;
+
+        out << "  {\"name\": \"" << get_phase_name((E_PROTOCOL_PHASE)phase) << "\""
+            << ", \"count\": " << histogram.count
+            << ", \"sum\": " << histogram.sum
+            << ", \"p50\": " << get_percentile(histogram, 50)
+            << ", \"p90\": " << get_percentile(histogram, 90)
+            << ", \"p99\": " << get_percentile(histogram, 99)
+            << ", \"p999\": " << get_percentile(histogram, 99.9)
+            << ", \"max\": " << histogram.max
+            << ", \"buckets\": [";
+
+        for(T_UINT32 bucket = 0; bucket < M_HIST_BUCKET_COUNT; bucket++)
+          {
+            if(histogram.buckets[bucket] != 0)
+              {
+                out << (first ? "" : ", ") << "[" << get_bucket_value(bucket) << ", " << histogram.buckets[bucket] << "]";
+                first = false;
+              }
+          }
+
+        out << "]}" << (((phase + 1) < MAX_PROTOCOL_PHASE) ? "," : "") << endl;
+      }
+
+    out << "]}" << endl;
+  }
+
+}
@@ -0,0 +1,211 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_histogram.hpp
+ *
+ * Description        :   To store the latency histograms of the protocol phases .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_HISTOGRAM_HPP_
+#define OLSR_HISTOGRAM_HPP_
+
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <ostream>
+#include "olsr_metrics.hpp"  /* Include file for the cache line size */
+
+#ifndef M_NO_PHASE_HISTOGRAMS
+#define M_PHASE_HISTOGRAMS   /* Times the protocol phases, build with -DM_NO_PHASE_HISTOGRAMS to remove the timing */
+#endif
+
+namespace ns_olsr2_0
+{
+#define M_HIST_SUB_BUCKET_BITS  4       /* 16 linear sub buckets per power of two, values within 6.25 % */
+#define M_HIST_SUB_BUCKETS      (1 << M_HIST_SUB_BUCKET_BITS)
+#define M_HIST_MAX_BITS         40      /* Largest value recorded, about 18 minutes in nano seconds */
+#define M_HIST_BUCKET_COUNT     ((M_HIST_MAX_BITS - M_HIST_SUB_BUCKET_BITS + 2) * M_HIST_SUB_BUCKETS)
+
+  /**
+   * Protocol phases timed
+   */
+  typedef enum
+  {
+    RECV_OLSR_PHASE = 0X0,              /* Whole recv_olsr call */
+    LINK_SENSING_PHASE,
+    TWO_HOP_SET_PHASE,                  /* populate_two_hop_set */
+    PROCESS_TC_PHASE,
+    MPR_COMPUTATION_PHASE,
+    ROUTING_TABLE_PHASE,                /* routing_table_computation */
+    SEND_HELLO_PHASE,
+    SEND_TC_PHASE,
+    MAX_PROTOCOL_PHASE
+  }E_PROTOCOL_PHASE;
+
+  /**
+   * Merged latencies of one phase, in nano seconds
+   */
+  typedef struct
+  {
+    std::array<T_UINT64, M_HIST_BUCKET_COUNT> buckets;
+    T_UINT64 count;
+    T_UINT64 sum;
+    T_UINT64 max;
+  }T_LATENCY_HISTOGRAM;
+
+  /**
+   * Log linear (HDR style) latency histograms of the protocol phases.
+   * Like the metrics, each thread records into a slot of its own with
+   * relaxed load/store pairs and snapshot() merges the slots while the
+   * threads keep running.
+   */
+  class C_PHASE_HISTOGRAMS
+  {
+
+  public:
+
+    /* Returns the bucket of a value, the first 16 buckets are exact */
+    static T_UINT32
+    get_bucket (T_UINT64 value)
+    {
+      if(value < M_HIST_SUB_BUCKETS)
+        {
+          return value;
+        }
+
+      T_UINT32 shift = (63 - __builtin_clzl(value)) - M_HIST_SUB_BUCKET_BITS;
+      T_UINT32 bucket = ((shift + 1) << M_HIST_SUB_BUCKET_BITS) + ((value >> shift) & (M_HIST_SUB_BUCKETS - 1));
+
+      return (bucket < M_HIST_BUCKET_COUNT) ? bucket : (M_HIST_BUCKET_COUNT - 1);
+    }
+
+    /* Adds a latency of the calling thread to a phase */
+    static void
+    record (E_PROTOCOL_PHASE phase, T_UINT64 latency_ns)
+    {
+      T_PHASE_SLOT& slot = get_slot();
+
+      add(slot.buckets[phase][get_bucket(latency_ns)], 1);
+      add(slot.count[phase], 1);
+      add(slot.sum[phase], latency_ns);
+
+      if(latency_ns > slot.max[phase].load(std::memory_order_relaxed))
+        {
+          slot.max[phase].store(latency_ns, std::memory_order_relaxed);
+        }
+    }
+
+    static T_UINT64 get_bucket_value(T_UINT32 bucket);      /* Highest value counted in a bucket */
+
+    static T_UINT64 get_percentile(const T_LATENCY_HISTOGRAM& histogram, double percentile);
+
+    static void snapshot(std::array<T_LATENCY_HISTOGRAM, MAX_PROTOCOL_PHASE>& histograms);  /* Merges the threads */
+
+    static const char* get_phase_name(E_PROTOCOL_PHASE phase);
+
+    static void write_text(std::ostream& out);   /* One line of percentiles per phase */
+
+    static void write_json(std::ostream& out);   /* Percentiles and non empty buckets of each phase */
+
+  private:
+
+    /**
+     * Histograms of one thread, reused by the next thread once it exits
+     */
+    struct alignas(M_CACHE_LINE_SIZE) T_PHASE_SLOT
+    {
+      std::array<std::array<std::atomic<T_UINT64>, M_HIST_BUCKET_COUNT>, MAX_PROTOCOL_PHASE> buckets;
+      std::array<std::atomic<T_UINT64>, MAX_PROTOCOL_PHASE> count;
+      std::array<std::atomic<T_UINT64>, MAX_PROTOCOL_PHASE> sum;
+      std::array<std::atomic<T_UINT64>, MAX_PROTOCOL_PHASE> max;
+      std::atomic<T_BOOL> in_use;       /* True while a thread owns the slot */
+      T_PHASE_SLOT* next;               /* Slot registered before this one */
+    };
+
+    /**
+     * Releases the slot of a thread when the thread exits
+     */
+    class C_SLOT_OWNER
+    {
+
+    public:
+      C_SLOT_OWNER() : m_slot(NULL) {}
+
+      ~C_SLOT_OWNER()
+      {
+        if(m_slot != NULL)
+          {
+            m_slot->in_use.store(false, std::memory_order_release);
+          }
+      }
+
+      T_PHASE_SLOT* m_slot;             /* Slot of the thread */
+    };
+
+    static std::atomic<T_PHASE_SLOT*> s_slots;      /* Last registered slot */
+
+    static T_PHASE_SLOT* register_slot(void);       /* Takes over a released slot or links a new one */
+
+    static void
+    add (std::atomic<T_UINT64>& value, T_UINT64 delta)
+    {
+      value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static T_PHASE_SLOT&
+    get_slot ()
+    {
+      static thread_local T_PHASE_SLOT* t_slot = NULL;
+
+      if(t_slot == NULL)
+        {
+          t_slot = register_slot();
+        }
+      return *t_slot;
+    }
+  };
+
+  /**
+   * Times a scope and records it to a phase
+   */
+  class C_PHASE_TIMER
+  {
+
+  public:
+    C_PHASE_TIMER(E_PROTOCOL_PHASE phase) : m_phase(phase), m_start(std::chrono::steady_clock::now()) {}
+
+    ~C_PHASE_TIMER()
+    {
+      C_PHASE_HISTOGRAMS::record(m_phase,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+    }
+
+  private:
+
+    E_PROTOCOL_PHASE m_phase;
+
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+#ifdef M_PHASE_HISTOGRAMS
+#define M_PHASE_TIMER(phase)    C_PHASE_TIMER phase_timer(phase)    /* Times the rest of the scope */
+#else
+#define M_PHASE_TIMER(phase)
+#endif
+
+}
+
+#endif /* OLSR_HISTOGRAM_HPP_ */
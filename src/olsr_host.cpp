@@ -0,0 +1,326 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_host.cpp
+ *
+ * Description        :   Implements the host running many olsr instances in one process .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <algorithm>
+#include "olsr_host.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  delivery_later
+   * @brief     Orders the delivery heap, the earliest packet on top.
+   * @param     delivery_a, delivery_b.
+   * @return    true if delivery_a arrives after delivery_b.
+   * @note      None.
+  ********************************************************************/
+  static inline T_BOOL delivery_later(const T_HOST_DELIVERY& delivery_a, const T_HOST_DELIVERY& delivery_b)
+  {
+    if(delivery_a.deliver_time != delivery_b.deliver_time)
+      {
+        return (delivery_a.deliver_time > delivery_b.deliver_time);
+      }
+    if(delivery_a.sequence != delivery_b.sequence)
+      {
+        return (delivery_a.sequence > delivery_b.sequence);
+      }
+    return (delivery_a.receiver > delivery_b.receiver);
+  }
+
+  /********************************************************************
+   * @function  get_address_key
+   * @brief     Packs a node address into an index of m_node_index.
+   * @param     node_address.
+   * @return    key.
+   * @note      None.
+  ********************************************************************/
+  static inline T_UINT32 get_address_key(const T_NODE_ADDRESS& node_address)
+  {
+    return (((T_UINT32)node_address.net_id << 8) | node_address.node_id);
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_HOST
+   * @brief     This function is the constructor of C_OLSR_HOST.
+   * @param     start_time - virtual time of the first event.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_HOST::C_OLSR_HOST(Time start_time) : m_clock(start_time)
+  {
+    m_node_index.assign(M_HOST_ADDRESS_SPACE, M_HOST_INVALID_NODE);
+    m_delivery_sequence = 0;
+    m_counters = T_HOST_COUNTERS();
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_HOST
+   * @brief     This function is the destructor of C_OLSR_HOST.
+   * @param     None.
+   * @return    None.
+   * @note      The instances are destroyed before the scheduler and
+   *            the pool they use.
+  ********************************************************************/
+  C_OLSR_HOST::~C_OLSR_HOST()
+  {
+    m_nodes.clear();
+  }
+
+  /********************************************************************
+   * @function  add_node
+   * @brief     This function creates an instance on the host and
+   *            starts it at the current virtual time.
+   * @param     node_address, inst_type.
+   * @return    Index of the node, M_HOST_INVALID_NODE if the address
+   *            is already used.
+   * @note      A leader instance is indexed by the address it takes
+   *            during init.
+  ********************************************************************/
+  T_UINT32 C_OLSR_HOST::add_node(const T_NODE_ADDRESS& node_address, E_OLSR_INSTANCE inst_type)
+  {
+    if(find_node(node_address) != M_HOST_INVALID_NODE)
+      {
+        return M_HOST_INVALID_NODE;
+      }
+
+    T_UINT32 node_idx = m_nodes.size();
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+
+    m_nodes.emplace_back();
+    m_links.emplace_back();
+
+    C_OLSR& node = m_nodes.back();
+
+    node.set_node_addr(node_address);
+    node.set_scheduler(&m_scheduler);
+    node.set_transport(this);
+
+    set_olsr_clock(&m_clock);
+    node.init(inst_type);
+    set_olsr_clock(prev_clock);
+
+    m_node_index[get_address_key(node.get_node_addr())] = node_idx;
+
+    return node_idx;
+  }
+
+  /********************************************************************
+   * @function  find_node
+   * @brief     This function returns the index of a node address.
+   * @param     node_address.
+   * @return    Index, M_HOST_INVALID_NODE if unknown.
+   * @note      None.
+  ********************************************************************/
+  T_UINT32 C_OLSR_HOST::find_node(const T_NODE_ADDRESS& node_address) const
+  {
+    return m_node_index[get_address_key(node_address)];
+  }
+
+  /********************************************************************
+   * @function  add_link
+   * @brief     This function connects two nodes in both directions.
+   * @param     node_a, node_b, delay, l_in_metric, loss_ratio, bandwidth.
+   * @return    None.
+   * @note      An existing link between them is updated.
+  ********************************************************************/
+  void C_OLSR_HOST::add_link(T_UINT32 node_a, T_UINT32 node_b, Time delay, float l_in_metric,
+                             float loss_ratio, T_UINT32 bandwidth)
+  {
+    T_UINT32 ends[2][2] = {{node_a, node_b}, {node_b, node_a}};
+
+    for(T_UINT32 dir = 0; dir < 2; dir++)
+      {
+        std::vector<T_VIRTUAL_LINK>& links = m_links[ends[dir][0]];
+        std::vector<T_VIRTUAL_LINK>::iterator link_iter = links.begin();
+
+        while((link_iter != links.end()) and (link_iter->neighbor != ends[dir][1]))
+          {
+            link_iter++;
+          }
+
+        if(link_iter == links.end())
+          {
+            links.push_back(T_VIRTUAL_LINK());
+            link_iter = links.end() - 1;
+            link_iter->neighbor = ends[dir][1];
+            link_iter->busy_until = 0;
+          }
+
+        link_iter->delay = delay;
+        link_iter->l_in_metric = l_in_metric;
+        link_iter->loss_ratio = loss_ratio;
+        link_iter->bandwidth = bandwidth;
+      }
+  }
+
+  /********************************************************************
+   * @function  remove_link
+   * @brief     This function disconnects two nodes in both directions.
+   * @param     node_a, node_b.
+   * @return    None.
+   * @note      Packets already in flight are still delivered.
+  ********************************************************************/
+  void C_OLSR_HOST::remove_link(T_UINT32 node_a, T_UINT32 node_b)
+  {
+    T_UINT32 ends[2][2] = {{node_a, node_b}, {node_b, node_a}};
+
+    for(T_UINT32 dir = 0; dir < 2; dir++)
+      {
+        std::vector<T_VIRTUAL_LINK>& links = m_links[ends[dir][0]];
+
+        for(std::vector<T_VIRTUAL_LINK>::iterator link_iter = links.begin(); link_iter != links.end(); link_iter++)
+          {
+            if(link_iter->neighbor == ends[dir][1])
+              {
+                links.erase(link_iter);
+                break;
+              }
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  send_packet
+   * @brief     This function copies a packet once into the pool and
+   *            queues it for every neighbor of the sender, through the
+   *            loss, bandwidth and delay of each link.
+   * @param     sender_address, olsr_packet.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_HOST::send_packet(const T_NODE_ADDRESS& sender_address, const C_PACKET_HEADER& olsr_packet)
+  {
+    T_UINT32 sender = find_node(sender_address);
+
+    if((sender == M_HOST_INVALID_NODE) or (m_links[sender].empty() == true))
+      {
+        return;
+      }
+
+    std::vector<T_VIRTUAL_LINK>& links = m_links[sender];
+    T_POOLED_PACKET* pooled_packet = m_pool.acquire(olsr_packet, links.size());
+    Time cur_time = m_clock.now();
+    T_UINT64 sequence = m_delivery_sequence++;
+
+    for(std::vector<T_VIRTUAL_LINK>::iterator link_iter = links.begin(); link_iter != links.end(); link_iter++)
+      {
+        T_HOST_DELIVERY delivery;
+
+        delivery.deliver_time = get_link_deliver_time(*link_iter, sender, sequence, olsr_packet.get_packet_length(), cur_time);
+
+        if(delivery.deliver_time < 0)
+          {
+            m_pool.release(pooled_packet);
+            m_counters.packets_lost++;
+            continue;
+          }
+
+        delivery.sequence = sequence;
+        delivery.sender = sender;
+        delivery.receiver = link_iter->neighbor;
+        delivery.l_in_metric = link_iter->l_in_metric;
+        delivery.packet = pooled_packet;
+
+        m_deliveries.push_back(delivery);
+        std::push_heap(m_deliveries.begin(), m_deliveries.end(), delivery_later);
+      }
+
+    m_counters.packets_sent++;
+    m_counters.bytes_sent += olsr_packet.get_packet_length();
+  }
+
+  /********************************************************************
+   * @function  next_delivery_time
+   * @brief     This function returns the time of the next delivery.
+   * @param     None.
+   * @return    Time, M_TIME_INFINITE if no packet is in flight.
+   * @note      None.
+  ********************************************************************/
+  Time C_OLSR_HOST::next_delivery_time(void) const
+  {
+    return (m_deliveries.empty() == true) ? M_TIME_INFINITE : m_deliveries.front().deliver_time;
+  }
+
+  /********************************************************************
+   * @function  deliver_due
+   * @brief     This function hands the packets due at cur_time to
+   *            their receivers and sends what they forward.
+   * @param     cur_time.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_HOST::deliver_due(Time cur_time)
+  {
+    while((m_deliveries.empty() == false) and (m_deliveries.front().deliver_time <= cur_time))
+      {
+        T_HOST_DELIVERY delivery = m_deliveries.front();
+
+        std::pop_heap(m_deliveries.begin(), m_deliveries.end(), delivery_later);
+        m_deliveries.pop_back();
+
+        C_OLSR& receiver = m_nodes[delivery.receiver];
+
+        receiver.recv_olsr(delivery.packet->packet, m_nodes[delivery.sender].get_node_addr(),
+                           receiver.get_node_addr(), delivery.l_in_metric);
+        receiver.send_olsr_msg();
+
+        m_pool.release(delivery.packet);
+        m_counters.packets_delivered++;
+      }
+  }
+
+  /********************************************************************
+   * @function  run_until
+   * @brief     This function runs the timers and deliveries of all the
+   *            instances in time order up to end_time.
+   * @param     end_time.
+   * @return    None.
+   * @note      The virtual clock jumps from one event to the next, the
+   *            clock of the calling thread is restored on return.
+  ********************************************************************/
+  void C_OLSR_HOST::run_until(Time end_time)
+  {
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+
+    set_olsr_clock(&m_clock);
+
+    while(true)
+      {
+        Time next_event = std::min(m_scheduler.next_deadline(), next_delivery_time());
+
+        if(next_event > end_time)
+          {
+            break;
+          }
+
+        m_clock.advance_to(next_event);
+
+        /* Packets first, so that timers due at the same time see them */
+        deliver_due(next_event);
+        m_counters.timers_fired += m_scheduler.run_due(next_event);
+      }
+
+    m_clock.advance_to(end_time);
+
+    set_olsr_clock(prev_clock);
+  }
+
+}
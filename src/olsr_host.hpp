@@ -0,0 +1,206 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_host.hpp
+ *
+ * Description        :   To store the host running many olsr instances in one process .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_HOST_HPP_
+#define OLSR_HOST_HPP_
+
+#include <deque>
+#include "olsr.hpp"                  /* Include file for olsr instance */
+#include "olsr_packet_pool.hpp"      /* Include file for the pooled packet buffers */
+
+namespace ns_olsr2_0
+{
+#define M_HOST_INVALID_NODE         0xFFFFFFFF  /* Index of an unknown node address */
+#define M_HOST_DEFAULT_LINK_DELAY   1           /* Delay of a virtual link, in milli seconds */
+#define M_HOST_ADDRESS_SPACE        65536       /* Number of node addresses */
+
+  /**
+   * One direction of a virtual link
+   */
+  typedef struct
+  {
+    T_UINT32 neighbor;                  /* Index of the receiving node */
+    Time delay;                         /* Propagation delay */
+    float l_in_metric;                  /* In link metric seen by the receiver */
+    float loss_ratio;                   /* Share of the packets lost, 0 to 1 */
+    T_UINT32 bandwidth;                 /* Bits per second, 0 for no limit */
+    Time busy_until;                    /* End of the transmission of the previous packet */
+  }T_VIRTUAL_LINK;
+
+  /********************************************************************
+   * @function  get_link_deliver_time
+   * @brief     Applies the loss, bandwidth and delay of a virtual link
+   *            to a packet sent at cur_time.
+   * @param     link - link used, its transmission queue is updated.
+   *            sender, sequence - identify the packet, the loss draw is
+   *            a hash of them so that it does not depend on the order
+   *            in which the host handles the senders.
+   *            packet_len, cur_time.
+   * @return    Time at which the packet reaches the receiver, -1 if
+   *            it is lost.
+   * @note      Packets queue behind each other on a link with a limited
+   *            bandwidth, a lost packet still takes its transmission
+   *            time.
+  ********************************************************************/
+  static inline Time get_link_deliver_time(T_VIRTUAL_LINK& link, T_UINT32 sender, T_UINT64 sequence,
+                                           T_UINT16 packet_len, Time cur_time)
+  {
+    Time tx_start = cur_time;
+
+    if(link.bandwidth != 0)
+      {
+        Time tx_time = (((Time)packet_len * 8 * M_MSEC_PER_SEC) + link.bandwidth - 1) / link.bandwidth;
+
+        tx_start = (link.busy_until > cur_time) ? link.busy_until : cur_time;
+        link.busy_until = tx_start + tx_time;
+        tx_start = link.busy_until;
+      }
+
+    if(link.loss_ratio > 0)
+      {
+        /* splitmix64 of the packet identity gives a reproducible draw */
+        T_UINT64 draw = ((T_UINT64)sender << 40) ^ ((T_UINT64)link.neighbor << 20) ^ sequence;
+
+        draw += 0x9E3779B97F4A7C15ULL;
+        draw = (draw ^ (draw >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        draw = (draw ^ (draw >> 27)) * 0x94D049BB133111EBULL;
+        draw = draw ^ (draw >> 31);
+
+        if((double)(draw >> 11) * (1.0 / 9007199254740992.0) < link.loss_ratio)
+          {
+            return -1;
+          }
+      }
+
+    return tx_start + link.delay;
+  }
+
+  /**
+   * Packet in flight on a virtual link
+   */
+  typedef struct
+  {
+    Time deliver_time;                  /* Time at which the packet reaches the receiver */
+    T_UINT64 sequence;                  /* Send order, orders deliveries with equal times */
+    T_UINT32 sender;                    /* Index of the sending node */
+    T_UINT32 receiver;                  /* Index of the receiving node */
+    float l_in_metric;                  /* In link metric of the link */
+    T_POOLED_PACKET* packet;            /* Shared packet buffer */
+  }T_HOST_DELIVERY;
+
+  /**
+   * Counters of the host
+   */
+  typedef struct
+  {
+    T_UINT64 packets_sent;              /* Packets handed to the virtual links */
+    T_UINT64 bytes_sent;                /* Bytes of those packets */
+    T_UINT64 packets_delivered;         /* Packets received by an instance */
+    T_UINT64 packets_lost;              /* Packets dropped by the loss of a link */
+    T_UINT64 timers_fired;              /* Timer events run */
+  }T_HOST_COUNTERS;
+
+  /**
+   * Runs many OLSR instances in one process. The instances share one
+   * scheduler, one virtual clock and one pool of packet buffers, and
+   * the host is the transport of all of them: a sent packet is copied
+   * once and queued in memory for each neighbor on a virtual link.
+   */
+  class C_OLSR_HOST : public C_OLSR_TRANSPORT
+  {
+
+  public:
+    C_OLSR_HOST(Time start_time = 0);
+
+    ~C_OLSR_HOST();
+
+    T_UINT32 add_node(const T_NODE_ADDRESS& node_address, E_OLSR_INSTANCE inst_type);   /* Creates and starts an instance */
+
+    /* Connects two nodes both ways */
+    void add_link(T_UINT32 node_a, T_UINT32 node_b, Time delay = M_HOST_DEFAULT_LINK_DELAY, float l_in_metric = 1.0,
+                  float loss_ratio = 0, T_UINT32 bandwidth = 0);
+
+    void remove_link(T_UINT32 node_a, T_UINT32 node_b);     /* Disconnects two nodes both ways */
+
+    void run_until(Time end_time);      /* Runs the timers and deliveries up to end_time */
+
+    void send_packet(const T_NODE_ADDRESS& sender_address, const C_PACKET_HEADER& olsr_packet);
+
+    T_UINT32 find_node(const T_NODE_ADDRESS& node_address) const;  /* Returns the index of an address */
+
+    C_OLSR&
+    get_node (T_UINT32 node_idx)
+    {
+      return m_nodes[node_idx];
+    }
+
+    T_UINT32
+    get_node_count () const
+    {
+      return m_nodes.size();
+    }
+
+    Time
+    get_time () const
+    {
+      return m_clock.now();
+    }
+
+    const T_HOST_COUNTERS&
+    get_counters () const
+    {
+      return m_counters;
+    }
+
+    const C_PACKET_POOL&
+    get_packet_pool () const
+    {
+      return m_pool;
+    }
+
+  private:
+
+    C_VIRTUAL_CLOCK m_clock;            /* Clock of all the instances */
+
+    C_OLSR_SCHEDULER m_scheduler;       /* Timers of all the instances */
+
+    C_PACKET_POOL m_pool;               /* Buffers of the packets in flight */
+
+    std::deque<C_OLSR> m_nodes;         /* Instances, never moved once created */
+
+    std::vector<std::vector<T_VIRTUAL_LINK> > m_links;     /* Virtual links of each node */
+
+    std::vector<T_UINT32> m_node_index; /* Node index of each packed address */
+
+    std::vector<T_HOST_DELIVERY> m_deliveries;     /* Binary min heap of the packets in flight */
+
+    T_UINT64 m_delivery_sequence;       /* Sequence given to the next delivery */
+
+    T_HOST_COUNTERS m_counters;
+
+    Time next_delivery_time(void) const;
+
+    void deliver_due(Time cur_time);    /* Hands the packets due at cur_time to their receivers */
+  };
+
+}
+
+#endif /* OLSR_HOST_HPP_ */
@@ -0,0 +1,136 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_interval.cpp
+ *
+ * Description        :   Implements the adaptive interval controller of periodic messages .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include "olsr_interval.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  C_OLSR_INTERVAL_CONTROLLER
+   * @brief     This function is the constructor of
+   *            C_OLSR_INTERVAL_CONTROLLER, the interval is fixed to the
+   *            HELLO interval until set_config is called.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_INTERVAL_CONTROLLER::C_OLSR_INTERVAL_CONTROLLER()
+  {
+    T_INTERVAL_CONFIG config;
+
+    config.min_interval = M_HELLO_INTERVAL * M_MSEC_PER_SEC;
+    config.max_interval = M_HELLO_INTERVAL * M_MSEC_PER_SEC;
+    config.stretch_percent = M_INTERVAL_STRETCH_PERCENT;
+    config.stable_periods = M_INTERVAL_STABLE_PERIODS;
+
+    set_config(config);
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_INTERVAL_CONTROLLER
+   * @brief     This function is the destructor of
+   *            C_OLSR_INTERVAL_CONTROLLER.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_INTERVAL_CONTROLLER::~C_OLSR_INTERVAL_CONTROLLER()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  set_config
+   * @brief     This function sets the bounds and growth of the
+   *            interval.
+   * @param     config.
+   * @return    None.
+   * @note      A max_interval equal to min_interval gives a fixed
+   *            interval.
+  ********************************************************************/
+  void C_OLSR_INTERVAL_CONTROLLER::set_config(const T_INTERVAL_CONFIG& config)
+  {
+    m_config = config;
+
+    if(m_config.max_interval < m_config.min_interval)
+      {
+        m_config.max_interval = m_config.min_interval;
+      }
+
+    m_interval = m_config.min_interval;
+    m_stable_count = 0;
+    m_changed = false;
+  }
+
+  /********************************************************************
+   * @function  note_change
+   * @brief     This function records a link loss, a new neighbor or a
+   *            topology change and falls back to the minimum interval.
+   * @param     None.
+   * @return    true if the interval was longer than the minimum, so
+   *            the pending message has to be brought forward.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_INTERVAL_CONTROLLER::note_change(void)
+  {
+    T_BOOL shrank = (m_interval > m_config.min_interval);
+
+    m_changed = true;
+    m_stable_count = 0;
+    m_interval = m_config.min_interval;
+
+    return shrank;
+  }
+
+  /********************************************************************
+   * @function  next_interval
+   * @brief     This function returns the interval until the next
+   *            message, stretched after enough stable intervals.
+   * @param     None.
+   * @return    Interval in milli seconds.
+   * @note      Called once per message sent.
+  ********************************************************************/
+  Time C_OLSR_INTERVAL_CONTROLLER::next_interval(void)
+  {
+    if(m_changed == true)
+      {
+        m_changed = false;
+        return m_interval;
+      }
+
+    m_stable_count++;
+
+    if(m_stable_count >= m_config.stable_periods)
+      {
+        m_stable_count = 0;
+        m_interval = (m_interval * m_config.stretch_percent) / 100;
+
+        if(m_interval > m_config.max_interval)
+          {
+            m_interval = m_config.max_interval;
+          }
+      }
+
+    return m_interval;
+  }
+
+}
@@ -0,0 +1,88 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_interval.hpp
+ *
+ * Description        :   To store the adaptive interval controller of periodic messages .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_INTERVAL_HPP_
+#define OLSR_INTERVAL_HPP_
+
+#include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_HELLO_MAX_INTERVAL        30      /* Longest HELLO interval of a stable neighborhood, in seconds */
+#define M_TC_MAX_INTERVAL           60      /* Longest TC interval of a stable topology, in seconds */
+#define M_INTERVAL_STRETCH_PERCENT  150     /* Growth of the interval after each stable period */
+#define M_INTERVAL_STABLE_PERIODS   3       /* Stable intervals needed before the interval grows */
+
+  /**
+   * Bounds and growth of an adaptive interval
+   */
+  typedef struct
+  {
+    Time min_interval;                  /* Interval used while the neighborhood changes */
+    Time max_interval;                  /* Interval reached when it has been stable for long */
+    T_UINT16 stretch_percent;           /* Growth applied after each stable period */
+    T_UINT16 stable_periods;            /* Stable intervals needed before growing */
+  }T_INTERVAL_CONFIG;
+
+  /**
+   * Stretches a message interval while the sets it describes are
+   * stable and falls back to the minimum on the first change
+   */
+  class C_OLSR_INTERVAL_CONTROLLER
+  {
+
+  public:
+    C_OLSR_INTERVAL_CONTROLLER();
+
+    ~C_OLSR_INTERVAL_CONTROLLER();
+
+    void set_config(const T_INTERVAL_CONFIG& config);   /* Sets the bounds, the interval restarts from the minimum */
+
+    T_BOOL note_change(void);           /* Records a change, returns true if the interval shrank */
+
+    Time next_interval(void);           /* Returns the interval until the next message */
+
+    Time
+    get_interval () const
+    {
+      return m_interval;
+    }
+
+    const T_INTERVAL_CONFIG&
+    get_config () const
+    {
+      return m_config;
+    }
+
+  private:
+
+    T_INTERVAL_CONFIG m_config;         /* Bounds and growth */
+
+    Time m_interval;                    /* Current interval */
+
+    T_UINT16 m_stable_count;            /* Intervals elapsed without change */
+
+    T_BOOL m_changed;                   /* A change occurred during the current interval */
+  };
+
+}
+
+#endif /* OLSR_INTERVAL_HPP_ */
@@ -0,0 +1,383 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_introspection.cpp
+ *
+ * Description        :   Implements the state snapshots of an olsr instance .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <csignal>
+#include <chrono>
+#include <thread>
+#include "olsr_introspection.hpp"
+
+namespace ns_olsr2_0
+{
+
+  std::atomic<T_UINT32> C_OLSR_INTROSPECTION::s_signal_count(0);
+
+  /**
+   * Writes an address of a JSON object
+   */
+  static void
+  write_json_address (std::ostream& out, const char* name, const T_NODE_ADDRESS& address)
+  {
+    out << "\"" << name << "\": \"" << (T_UINT32)address.net_id << "." << (T_UINT32)address.node_id << "\"";
+  }
+
+  /**
+   * Writes a value of a binary snapshot in host byte order
+   */
+  template <typename T_VALUE>
+  static void
+  write_value (std::ostream& out, T_VALUE value)
+  {
+    out.write((const char*)&value, sizeof(value));
+  }
+
+  static void
+  write_value (std::ostream& out, const T_NODE_ADDRESS& address)
+  {
+    write_value(out, address.net_id);
+    write_value(out, address.node_id);
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_INTROSPECTION
+   * @brief     This function is the constructor of
+   *            C_OLSR_INTROSPECTION.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_INTROSPECTION::C_OLSR_INTROSPECTION() : m_requested(0), m_published(0)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_INTROSPECTION
+   * @brief     This function is the copy constructor of
+   *            C_OLSR_INTROSPECTION.
+   * @param     introspection.
+   * @return    None.
+   * @note      The copy belongs to another instance, so the requests
+   *            and the snapshot are not copied.
+  ********************************************************************/
+  C_OLSR_INTROSPECTION::C_OLSR_INTROSPECTION(const C_OLSR_INTROSPECTION& /* introspection */) : m_requested(0), m_published(0)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_INTROSPECTION
+   * @brief     This function is the destructor of
+   *            C_OLSR_INTROSPECTION.
+   * @param     None.
+   * @return    None.
+   * @note      Readers holding the snapshot keep it alive.
+  ********************************************************************/
+  C_OLSR_INTROSPECTION::~C_OLSR_INTROSPECTION()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  request
+   * @brief     This function asks the protocol thread for a snapshot.
+   * @param     None.
+   * @return    Sequence of the snapshot serving the request.
+   * @note      Requests raised before the protocol thread gets to them
+   *            are served by one snapshot.
+  ********************************************************************/
+  T_UINT32 C_OLSR_INTROSPECTION::request(void)
+  {
+    return m_requested.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  /********************************************************************
+   * @function  publish
+   * @brief     This function publishes a snapshot taken by the
+   *            protocol thread.
+   * @param     snapshot - Its sequence is set to the last request.
+   * @return    None.
+   * @note      The previous snapshot is freed by its last reader.
+  ********************************************************************/
+  void C_OLSR_INTROSPECTION::publish(const std::shared_ptr<T_STATE_SNAPSHOT>& snapshot)
+  {
+    T_UINT32 sequence = m_requested.load(std::memory_order_relaxed);
+
+    snapshot->sequence = sequence;
+    std::atomic_store_explicit(&m_snapshot, std::shared_ptr<const T_STATE_SNAPSHOT>(snapshot), std::memory_order_release);
+    m_published.store(sequence, std::memory_order_release);
+  }
+
+  /********************************************************************
+   * @function  get_snapshot
+   * @brief     This function returns the last published snapshot.
+   * @param     None.
+   * @return    Snapshot, empty if none was taken yet.
+   * @note      None.
+  ********************************************************************/
+  std::shared_ptr<const T_STATE_SNAPSHOT> C_OLSR_INTROSPECTION::get_snapshot(void) const
+  {
+    return std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+  }
+
+  /********************************************************************
+   * @function  wait_snapshot
+   * @brief     This function waits until the snapshot of a request is
+   *            published.
+   * @param     sequence - Returned by request().
+   *            timeout_ms.
+   * @return    Snapshot, empty if the protocol thread did not serve the
+   *            request in time.
+   * @note      The protocol thread serves requests after a received
+   *            packet or a timer, so an idle instance answers within a
+   *            HELLO interval.
+  ********************************************************************/
+  std::shared_ptr<const T_STATE_SNAPSHOT> C_OLSR_INTROSPECTION::wait_snapshot(T_UINT32 sequence, T_UINT32 timeout_ms) const
+  {
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    while((T_INT32)(m_published.load(std::memory_order_acquire) - sequence) < 0)
+      {
+        if(std::chrono::steady_clock::now() >= deadline)
+          {
+            return std::shared_ptr<const T_STATE_SNAPSHOT>();
+          }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+
+    return get_snapshot();
+  }
+
+  /********************************************************************
+   * @function  write_json
+   * @brief     This function writes a snapshot as a JSON object.
+   * @param     out, snapshot.
+   * @return    None.
+   * @note      Times are in milli seconds of the OLSR clock, the tuple
+   *            times are widened against the time of the snapshot.
+  ********************************************************************/
+  void C_OLSR_INTROSPECTION::write_json(std::ostream& out, const T_STATE_SNAPSHOT& snapshot)
+  {
+    const char* separator = "";
+
+    out << "{";
+    write_json_address(out, "node", snapshot.node_address);
+    out << ", \"time\": " << snapshot.time << ", \"ansn\": " << snapshot.ansn << ",\n \"links\": [";
+
+    for(const T_LINK_TUPLE& tuple : snapshot.link_set)
+      {
+        out << separator << "\n  {";
+        write_json_address(out, "neighbor", tuple.l_neighbor_iface_addr);
+        out << ", \"status\": " << (T_UINT32)tuple.l_status << ", \"in_metric\": " << tuple.l_in_metric
+            << ", \"out_metric\": " << tuple.l_out_metric << ", \"mpr_selector\": " << (tuple.l_mpr_selector ? "true" : "false")
+            << ", \"heard_time\": " << tuple.l_heard_time.to_time(snapshot.time) << ", \"sym_time\": " << tuple.l_sym_time.to_time(snapshot.time)
+            << ", \"time\": " << tuple.l_time.to_time(snapshot.time) << "}";
+        separator = ",";
+      }
+
+    separator = "";
+    out << "],\n \"neighbors\": [";
+
+    for(const T_NEIGHBOUR_TUPLE& tuple : snapshot.neighbour_set)
+      {
+        out << separator << "\n  {";
+        write_json_address(out, "neighbor", tuple.n_neighbor_addr);
+        out << ", \"in_metric\": " << tuple.n_in_metric << ", \"out_metric\": " << tuple.n_out_metric
+            << ", \"willingness\": " << (T_UINT32)tuple.n_willingness.willingness
+            << ", \"symmetric\": " << (tuple.n_symmetric ? "true" : "false")
+            << ", \"flooding_mpr\": " << (tuple.n_flooding_mpr ? "true" : "false")
+            << ", \"routing_mpr\": " << (tuple.n_routing_mpr ? "true" : "false")
+            << ", \"mpr_selector\": " << (tuple.n_mpr_selector ? "true" : "false")
+            << ", \"advertised\": " << (tuple.n_advertised ? "true" : "false") << "}";
+        separator = ",";
+      }
+
+    separator = "";
+    out << "],\n \"two_hop_neighbors\": [";
+
+    for(const T_TWO_HOP_NEIGHBOUR_TUPLE& tuple : snapshot.two_hop_neighbour_set)
+      {
+        out << separator << "\n  {";
+        write_json_address(out, "neighbor", tuple.n2_neighbor_iface_addr);
+        out << ", ";
+        write_json_address(out, "two_hop", tuple.n2_2hop_addr);
+        out << ", \"in_metric\": " << tuple.n2_in_metric << ", \"out_metric\": " << tuple.n2_out_metric
+            << ", \"time\": " << tuple.n2_time.to_time(snapshot.time) << "}";
+        separator = ",";
+      }
+
+    separator = "";
+    out << "],\n \"advertising_remote_routers\": [";
+
+    for(const T_ADVERTISING_REMOTE_ROUTER_TUPLE& tuple : snapshot.advertising_remote_router_set)
+      {
+        out << separator << "\n  {";
+        write_json_address(out, "originator", tuple.ar_orig_addr);
+        out << ", \"ansn\": " << tuple.ar_seq_number << ", \"time\": " << tuple.ar_time.to_time(snapshot.time) << "}";
+        separator = ",";
+      }
+
+    separator = "";
+    out << "],\n \"router_topology\": [";
+
+    for(const T_ROUTER_TOPOLOGY_TUPLE& tuple : snapshot.router_topology_set)
+      {
+        out << separator << "\n  {";
+        write_json_address(out, "from", tuple.tr_from_orig_addr);
+        out << ", ";
+        write_json_address(out, "to", tuple.tr_to_orig_addr);
+        out << ", \"ansn\": " << tuple.tr_seq_number << ", \"metric\": " << tuple.tr_metric
+            << ", \"time\": " << tuple.tr_time.to_time(snapshot.time) << "}";
+        separator = ",";
+      }
+
+    separator = "";
+    out << "],\n \"routes\": [";
+
+    for(const T_ROUTING_TABLE_ENTRY& entry : snapshot.routing_set)
+      {
+        out << separator << "\n  {";
+        write_json_address(out, "destination", entry.r_dest_addr);
+        out << ", ";
+        write_json_address(out, "next_hop", entry.r_next_iface_addr);
+        out << ", ";
+        write_json_address(out, "local", entry.r_local_iface_addr);
+        out << ", \"distance\": " << (T_UINT32)entry.r_dist << ", \"metric\": " << entry.r_metric << "}";
+        separator = ",";
+      }
+
+    out << "]}\n";
+  }
+
+  /********************************************************************
+   * @function  write_binary
+   * @brief     This function writes a snapshot in a compact binary
+   *            layout.
+   * @param     out, snapshot.
+   * @return    None.
+   * @note      Host byte order. Magic, version, node address, time and
+   *            ANSN, then each set as a 32 bit count followed by the
+   *            packed fields of its tuples in declaration order, in the
+   *            order of T_STATE_SNAPSHOT.
+  ********************************************************************/
+  void C_OLSR_INTROSPECTION::write_binary(std::ostream& out, const T_STATE_SNAPSHOT& snapshot)
+  {
+    write_value(out, (T_UINT32)M_SNAPSHOT_MAGIC);
+    write_value(out, (T_UINT16)M_SNAPSHOT_VERSION);
+    write_value(out, snapshot.node_address);
+    write_value(out, (T_INT64)snapshot.time);
+    write_value(out, snapshot.ansn);
+
+    write_value(out, (T_UINT32)snapshot.link_set.size());
+    for(const T_LINK_TUPLE& tuple : snapshot.link_set)
+      {
+        write_value(out, tuple.l_in_metric);
+        write_value(out, tuple.l_out_metric);
+        write_value(out, (T_UINT8)tuple.l_mpr_selector);
+        write_value(out, tuple.l_neighbor_iface_addr);
+        write_value(out, tuple.l_heard_time.to_time(snapshot.time));
+        write_value(out, tuple.l_sym_time.to_time(snapshot.time));
+        write_value(out, tuple.l_time.to_time(snapshot.time));
+        write_value(out, tuple.l_status);
+      }
+
+    write_value(out, (T_UINT32)snapshot.neighbour_set.size());
+    for(const T_NEIGHBOUR_TUPLE& tuple : snapshot.neighbour_set)
+      {
+        write_value(out, tuple.n_neighbor_addr);
+        write_value(out, tuple.n_in_metric);
+        write_value(out, tuple.n_out_metric);
+        write_value(out, tuple.n_willingness.willingness);
+        write_value(out, (T_UINT8)((tuple.n_symmetric << 0) | (tuple.n_flooding_mpr << 1) | (tuple.n_routing_mpr << 2)
+                                   | (tuple.n_mpr_selector << 3) | (tuple.n_advertised << 4)));
+      }
+
+    write_value(out, (T_UINT32)snapshot.two_hop_neighbour_set.size());
+    for(const T_TWO_HOP_NEIGHBOUR_TUPLE& tuple : snapshot.two_hop_neighbour_set)
+      {
+        write_value(out, tuple.n2_in_metric);
+        write_value(out, tuple.n2_out_metric);
+        write_value(out, tuple.n2_neighbor_iface_addr);
+        write_value(out, tuple.n2_2hop_addr);
+        write_value(out, tuple.n2_time.to_time(snapshot.time));
+      }
+
+    write_value(out, (T_UINT32)snapshot.advertising_remote_router_set.size());
+    for(const T_ADVERTISING_REMOTE_ROUTER_TUPLE& tuple : snapshot.advertising_remote_router_set)
+      {
+        write_value(out, tuple.ar_orig_addr);
+        write_value(out, tuple.ar_seq_number);
+        write_value(out, tuple.ar_time.to_time(snapshot.time));
+      }
+
+    write_value(out, (T_UINT32)snapshot.router_topology_set.size());
+    for(const T_ROUTER_TOPOLOGY_TUPLE& tuple : snapshot.router_topology_set)
+      {
+        write_value(out, tuple.tr_from_orig_addr);
+        write_value(out, tuple.tr_to_orig_addr);
+        write_value(out, tuple.tr_seq_number);
+        write_value(out, tuple.tr_metric);
+        write_value(out, tuple.tr_time.to_time(snapshot.time));
+      }
+
+    write_value(out, (T_UINT32)snapshot.routing_set.size());
+    for(const T_ROUTING_TABLE_ENTRY& entry : snapshot.routing_set)
+      {
+        write_value(out, entry.r_dest_addr);
+        write_value(out, entry.r_next_iface_addr);
+        write_value(out, entry.r_local_iface_addr);
+        write_value(out, entry.r_dist);
+        write_value(out, entry.r_metric);
+      }
+  }
+
+  /********************************************************************
+   * @function  install_signal_handler
+   * @brief     This function counts the signals of a number from now
+   *            on, a dump thread polls get_signal_count.
+   * @param     signal_number - e.g. SIGUSR1.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_INTROSPECTION::install_signal_handler(int signal_number)
+  {
+    struct sigaction action = {};
+
+    action.sa_handler = handle_signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+
+    sigaction(signal_number, &action, NULL);
+  }
+
+  /********************************************************************
+   * @function  handle_signal
+   * @brief     This function is the signal handler, it only increments
+   *            the lock free signal count.
+   * @param     signal_number.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_INTROSPECTION::handle_signal(int /* signal_number */)
+  {
+    s_signal_count.fetch_add(1, std::memory_order_relaxed);
+  }
+
+}
@@ -0,0 +1,111 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_introspection.hpp
+ *
+ * Description        :   To store the state snapshots of an olsr instance .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_INTROSPECTION_HPP_
+#define OLSR_INTROSPECTION_HPP_
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_SNAPSHOT_MAGIC        0X53534C4F  /* "OLSS" in little endian, first word of a binary snapshot */
+#define M_SNAPSHOT_VERSION      1           /* Layout of the binary snapshot */
+
+  /**
+   * Copy of the information bases of an instance at one point of time
+   */
+  typedef struct
+  {
+    T_UINT32 sequence;                                  /* Request served by this snapshot */
+    T_NODE_ADDRESS node_address;
+    Time time;                                          /* Time of the OLSR clock when taken */
+    T_UINT16 ansn;
+    LinkSet link_set;
+    NeighbourSet neighbour_set;
+    TwoHopNeighborSet two_hop_neighbour_set;
+    AdvertisingRemoteRouterSet advertising_remote_router_set;
+    RouterTopologySet router_topology_set;
+    RoutingSet routing_set;
+  }T_STATE_SNAPSHOT;
+
+  /**
+   * Hands state snapshots from the protocol thread of an instance to
+   * other threads. Other threads only raise a request; the protocol
+   * thread copies its sets between two messages and publishes the
+   * copy as an immutable shared snapshot, so serializing it never
+   * holds up the protocol.
+   */
+  class C_OLSR_INTROSPECTION
+  {
+
+  public:
+    C_OLSR_INTROSPECTION();
+
+    C_OLSR_INTROSPECTION(const C_OLSR_INTROSPECTION& introspection);  /* A copy starts without requests or snapshot */
+
+    ~C_OLSR_INTROSPECTION();
+
+    T_UINT32 request(void);             /* Any thread, returns the sequence of the snapshot to wait for */
+
+    /* Protocol thread, checks for a pending request */
+    T_BOOL
+    is_requested () const
+    {
+      return (m_requested.load(std::memory_order_relaxed) != m_published.load(std::memory_order_relaxed));
+    }
+
+    void publish(const std::shared_ptr<T_STATE_SNAPSHOT>& snapshot);  /* Protocol thread, serves the pending requests */
+
+    std::shared_ptr<const T_STATE_SNAPSHOT> get_snapshot(void) const;  /* Any thread, last published snapshot */
+
+    std::shared_ptr<const T_STATE_SNAPSHOT> wait_snapshot(T_UINT32 sequence, T_UINT32 timeout_ms) const;
+
+    static void write_json(std::ostream& out, const T_STATE_SNAPSHOT& snapshot);
+
+    static void write_binary(std::ostream& out, const T_STATE_SNAPSHOT& snapshot);
+
+    static void install_signal_handler(int signal_number);   /* Counts the signals received */
+
+    static T_UINT32
+    get_signal_count ()
+    {
+      return s_signal_count.load(std::memory_order_relaxed);
+    }
+
+  private:
+
+    std::atomic<T_UINT32> m_requested;  /* Sequence of the last request */
+
+    std::atomic<T_UINT32> m_published;  /* Sequence of the last published snapshot */
+
+    std::shared_ptr<const T_STATE_SNAPSHOT> m_snapshot;     /* Accessed with the atomic shared_ptr functions only */
+
+    static std::atomic<T_UINT32> s_signal_count;            /* Incremented by the signal handler */
+
+    static void handle_signal(int signal_number);
+  };
+
+}
+
+#endif /* OLSR_INTROSPECTION_HPP_ */
@@ -0,0 +1,156 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_key_index.cpp
+ *
+ * Description        :   Implements the packed key scans of the olsr tuple sets .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include "olsr_key_index.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ns_olsr2_0
+{
+
+#if defined(__AVX2__)
+#define M_KEY16_STEP    32      /* 16 bit keys compared by one step */
+#define M_KEY32_STEP    16      /* 32 bit keys compared by one step */
+#else
+#define M_KEY16_STEP    16
+#define M_KEY32_STEP    8
+#endif
+
+  /*
+   * The scans compare a full step of keys against the key, two vector
+   * registers at a time, and stop at the first step with an equal key.
+   * The keys left after the last full step are compared 128 bits at a
+   * time, and the last few one at a time, so that a small set does not
+   * fall back to the scalar loop.
+   */
+
+  std::size_t
+  find_key (const T_UINT16* keys, std::size_t count, T_UINT16 key)
+  {
+    std::size_t idx = 0;
+
+#if defined(__AVX2__)
+    __m256i wanted = _mm256_set1_epi16((short)key);
+
+    for(; (idx + M_KEY16_STEP) <= count; idx += M_KEY16_STEP)
+      {
+        /* Two bits per key, from the byte mask of the 16 bit compare */
+        T_UINT64 bits = (T_UINT32)_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(keys + idx)), wanted))
+            | ((T_UINT64)(T_UINT32)_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(keys + idx + 16)), wanted)) << 32);
+
+        if(bits != 0)
+          {
+            return idx + (__builtin_ctzll(bits) / 2);
+          }
+      }
+#elif defined(__SSE2__)
+    __m128i wanted = _mm_set1_epi16((short)key);
+
+    for(; (idx + M_KEY16_STEP) <= count; idx += M_KEY16_STEP)
+      {
+        T_UINT32 bits = (T_UINT32)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(keys + idx)), wanted))
+            | ((T_UINT32)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(keys + idx + 8)), wanted)) << 16);
+
+        if(bits != 0)
+          {
+            return idx + (__builtin_ctz(bits) / 2);
+          }
+      }
+#endif
+#if defined(__SSE2__)
+    for(; (idx + 8) <= count; idx += 8)
+      {
+        T_UINT32 bits = (T_UINT32)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(keys + idx)), _mm_set1_epi16((short)key)));
+
+        if(bits != 0)
+          {
+            return idx + (__builtin_ctz(bits) / 2);
+          }
+      }
+#endif
+    for(; idx < count; idx++)
+      {
+        if(keys[idx] == key)
+          {
+            return idx;
+          }
+      }
+    return count;
+  }
+
+  std::size_t
+  find_key (const T_UINT32* keys, std::size_t count, T_UINT32 key)
+  {
+    std::size_t idx = 0;
+
+#if defined(__AVX2__)
+    __m256i wanted = _mm256_set1_epi32((T_INT32)key);
+
+    for(; (idx + M_KEY32_STEP) <= count; idx += M_KEY32_STEP)
+      {
+        T_UINT32 bits = (T_UINT32)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + idx)), wanted)))
+            | ((T_UINT32)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + idx + 8)), wanted))) << 8);
+
+        if(bits != 0)
+          {
+            return idx + __builtin_ctz(bits);
+          }
+      }
+#elif defined(__SSE2__)
+    __m128i wanted = _mm_set1_epi32((T_INT32)key);
+
+    for(; (idx + M_KEY32_STEP) <= count; idx += M_KEY32_STEP)
+      {
+        T_UINT32 bits = (T_UINT32)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + idx)), wanted)))
+            | ((T_UINT32)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + idx + 4)), wanted))) << 4);
+
+        if(bits != 0)
+          {
+            return idx + __builtin_ctz(bits);
+          }
+      }
+#endif
+#if defined(__SSE2__)
+    for(; (idx + 4) <= count; idx += 4)
+      {
+        T_UINT32 bits = (T_UINT32)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(keys + idx)), _mm_set1_epi32((T_INT32)key))));
+
+        if(bits != 0)
+          {
+            return idx + __builtin_ctz(bits);
+          }
+      }
+#endif
+    for(; idx < count; idx++)
+      {
+        if(keys[idx] == key)
+          {
+            return idx;
+          }
+      }
+    return count;
+  }
+
+}
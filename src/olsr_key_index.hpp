@@ -0,0 +1,558 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_key_index.hpp
+ *
+ * Description        :   To store the packed key index of the olsr tuple sets .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_KEY_INDEX_HPP_
+#define OLSR_KEY_INDEX_HPP_
+
+#include "olsr_types.hpp"            /* Include file for OLSR types functionalities */
+#include "olsr_arena.hpp"            /* Include file for the tuple arena */
+#include "olsr_tuple_columns.hpp"    /* Include file for the match masks */
+
+#include <array>
+
+namespace ns_olsr2_0
+{
+#define M_KEY_HASH_THRESHOLD    128     /* Keys above which a lookup probes the hash table instead of scanning */
+#define M_KEY_HASH_EMPTY        0       /* Free slot of the hash table, the slots hold the row plus one */
+#define M_KEY_HASH_MULTIPLIER   0x9E3779B1u     /* Fibonacci hashing, spreads the dense node ids over the slots */
+#define M_KEY_ROW_ERASED        0xFFFFFFFFu     /* New row of an erased row */
+#define M_ADDRESS_COUNT         65536   /* Packed addresses, one bit each in an address bitmap */
+#define M_ADDRESS_PAGE_BITS     256     /* Bits of an address bitmap page, the node ids of one net id */
+#define M_ADDRESS_NO_PAGE       0       /* Net id without a page, the pages are numbered from one */
+
+  /* Key of a tuple keyed by an address and a message sequence number */
+  static inline T_UINT32
+  get_sequence_key (const T_NODE_ADDRESS& address, T_UINT16 seq_number)
+  {
+    return ((T_UINT32)get_packed_address(address) << 16) | seq_number;
+  }
+
+  /* Key of a tuple keyed by two addresses */
+  static inline T_UINT32
+  get_pair_key (const T_NODE_ADDRESS& first, const T_NODE_ADDRESS& second)
+  {
+    return ((T_UINT32)get_packed_address(first) << 16) | get_packed_address(second);
+  }
+
+  /* Keys of the tuples of each indexed set */
+  static inline T_UINT16
+  get_tuple_key (const T_LINK_TUPLE& tuple)
+  {
+    return get_packed_address(tuple.l_neighbor_iface_addr);
+  }
+
+  static inline T_UINT16
+  get_tuple_key (const T_NEIGHBOUR_TUPLE& tuple)
+  {
+    return get_packed_address(tuple.n_neighbor_addr);
+  }
+
+  static inline T_UINT16
+  get_tuple_key (const T_ADVERTISED_NEIGHBOUR_TUPLE& tuple)
+  {
+    return get_packed_address(tuple.a_neighbor_addr);
+  }
+
+  static inline T_UINT16
+  get_tuple_key (const T_ADVERTISING_REMOTE_ROUTER_TUPLE& tuple)
+  {
+    return get_packed_address(tuple.ar_orig_addr);
+  }
+
+  static inline T_UINT32
+  get_tuple_key (const T_TWO_HOP_NEIGHBOUR_TUPLE& tuple)
+  {
+    return get_pair_key(tuple.n2_neighbor_iface_addr, tuple.n2_2hop_addr);
+  }
+
+  static inline T_UINT32
+  get_tuple_key (const T_PROCESSED_MSG_TUPLE& tuple)
+  {
+    return get_sequence_key(tuple.p_orig_addr, tuple.p_seq_number);
+  }
+
+  static inline T_UINT32
+  get_tuple_key (const T_FORWARDED_MSG_TUPLE& tuple)
+  {
+    return get_sequence_key(tuple.f_orig_addr, tuple.f_seq_number);
+  }
+
+  /* Index of the first of count keys equal to key, count if none, 32 keys per step with AVX2 and 16 with SSE2 */
+  std::size_t find_key(const T_UINT16* keys, std::size_t count, T_UINT16 key);
+
+  /* Index of the first of count keys equal to key, count if none, 16 keys per step with AVX2 and 8 with SSE2 */
+  std::size_t find_key(const T_UINT32* keys, std::size_t count, T_UINT32 key);
+
+  /**
+   * Keys of the tuples of one set, row i holding the key of the i-th
+   * tuple. A lookup scans the packed keys with the SIMD kernels while
+   * the set is small, and probes an open addressing hash table of the
+   * rows once it holds more than M_KEY_HASH_THRESHOLD keys. The table
+   * is built when the set crosses the threshold. An ordered erasure
+   * removes the slots of the erased rows and renumbers the rows kept
+   * in their slots, so that the sweeps never hash the keys again, and
+   * an unordered one moves the last row into the erased one, changing
+   * one slot. The sets never hold two tuples of one key, an insert
+   * follows a failed find.
+   */
+  template <typename T_KEY>
+  class C_KEY_INDEX
+  {
+
+  public:
+    C_KEY_INDEX(std::pmr::memory_resource* resource) : m_keys(resource), m_slots(resource), m_rows(resource), m_slot_shift(0) {}
+
+    std::size_t
+    size () const
+    {
+      return m_keys.size();
+    }
+
+    /* Row of key, size() if absent */
+    std::size_t
+    find (T_KEY key) const
+    {
+      if(m_slots.empty() == true)
+        {
+          return find_key(m_keys.data(), m_keys.size(), key);
+        }
+
+      for(std::size_t slot = get_slot(key); m_slots[slot] != M_KEY_HASH_EMPTY; slot = (slot + 1) & (m_slots.size() - 1))
+        {
+          if(m_keys[m_slots[slot] - 1] == key)
+            {
+              return m_slots[slot] - 1;
+            }
+        }
+      return m_keys.size();
+    }
+
+    /* Adds the key of a tuple appended to the set */
+    void
+    push_back (T_KEY key)
+    {
+      m_keys.push_back(key);
+
+      if(m_slots.empty() == false)
+        {
+          if((m_keys.size() * 2) > m_slots.size())
+            {
+              rebuild();
+            }
+          else
+            {
+              add_slot(m_keys.size() - 1);
+            }
+        }
+      else if(m_keys.size() > M_KEY_HASH_THRESHOLD)
+        {
+          rebuild();
+        }
+    }
+
+    /* Rebuilds the keys of a set */
+    template <typename T_SET>
+    void
+    assign (const T_SET& set)
+    {
+      m_keys.clear();
+      for(typename T_SET::const_iterator iter = set.begin(); iter != set.end(); iter++)
+        {
+          m_keys.push_back(get_tuple_key(*iter));
+        }
+      rebuild();
+    }
+
+    /* Erases the rows for which erase(row) holds, in one pass, as the set erases the same tuples */
+    template <typename T_ERASE>
+    void
+    erase_rows (T_ERASE erase)
+    {
+      std::size_t first = 0;
+
+      while((first < m_keys.size()) and (erase(first) == false))
+        {
+          first++;
+        }
+
+      if(first == m_keys.size())
+        {
+          return;
+        }
+
+      std::size_t kept = first;
+
+      if(m_slots.empty() == true)
+        {
+          for(std::size_t row = first + 1; row < m_keys.size(); row++)
+            {
+              if(erase(row) == false)
+                {
+                  m_keys[kept++] = m_keys[row];
+                }
+            }
+          m_keys.resize(kept);
+          return;
+        }
+
+      /* New row of each row, the slots of the erased ones are removed while the keys are still in place */
+      m_rows.resize(m_keys.size());
+      m_rows[first] = M_KEY_ROW_ERASED;
+      for(std::size_t row = first + 1; row < m_keys.size(); row++)
+        {
+          m_rows[row] = (erase(row) == true) ? M_KEY_ROW_ERASED : kept++;
+        }
+
+      for(std::size_t row = first; row < m_keys.size(); row++)
+        {
+          if(m_rows[row] == M_KEY_ROW_ERASED)
+            {
+              remove_slot(row);
+            }
+        }
+
+      for(std::size_t row = first + 1; row < m_keys.size(); row++)
+        {
+          if(m_rows[row] != M_KEY_ROW_ERASED)
+            {
+              m_keys[m_rows[row]] = m_keys[row];
+            }
+        }
+      m_keys.resize(kept);
+
+      if(kept <= M_KEY_HASH_THRESHOLD)
+        {
+          m_slots.clear();
+          return;
+        }
+
+      for(std::size_t slot = 0; slot < m_slots.size(); slot++)
+        {
+          if((m_slots[slot] != M_KEY_HASH_EMPTY) and ((m_slots[slot] - 1) > first))
+            {
+              m_slots[slot] = m_rows[m_slots[slot] - 1] + 1;
+            }
+        }
+    }
+
+    /* Erases a row by moving the last row into it, as the set does with its tuples */
+    void
+    swap_erase (std::size_t row)
+    {
+      std::size_t last = m_keys.size() - 1;
+
+      if(m_slots.empty() == false)
+        {
+          remove_slot(row);
+
+          if(row != last)
+            {
+              std::size_t slot = get_slot(m_keys[last]);
+
+              while((m_slots[slot] - 1) != last)
+                {
+                  slot = (slot + 1) & (m_slots.size() - 1);
+                }
+              m_slots[slot] = row + 1;
+            }
+        }
+
+      m_keys[row] = m_keys[last];
+      m_keys.pop_back();
+
+      if(m_keys.size() <= M_KEY_HASH_THRESHOLD)
+        {
+          m_slots.clear();
+        }
+    }
+
+    /* Keeps the rows whose bit is set, in order */
+    void
+    compact (const T_MATCH_MASK& keep)
+    {
+      erase_rows([&](std::size_t row)
+        {
+          return (get_match(keep, row) == false);
+        });
+    }
+
+    void
+    clear ()
+    {
+      m_keys.clear();
+      m_slots.clear();
+    }
+
+    /* Empties the index and drops its buffers */
+    void
+    reset ()
+    {
+      std::pmr::vector<T_KEY>(m_keys.get_allocator()).swap(m_keys);
+      std::pmr::vector<T_UINT32>(m_slots.get_allocator()).swap(m_slots);
+      std::pmr::vector<T_UINT32>(m_rows.get_allocator()).swap(m_rows);
+    }
+
+    /* Takes the buffers of capacity keys, so that the index never grows afterwards */
+    void
+    reserve (std::size_t capacity)
+    {
+      m_keys.reserve(capacity);
+      if(capacity > M_KEY_HASH_THRESHOLD)
+        {
+          m_slots.reserve(get_slot_count(capacity));
+          m_rows.reserve(capacity);
+        }
+    }
+
+    /* Arena bytes of the index of capacity keys, to size a fixed buffer */
+    static constexpr std::size_t
+    get_reserved_bytes (std::size_t capacity)
+    {
+      return C_OLSR_ARENA::get_block_size(capacity * sizeof(T_KEY))
+          + ((capacity > M_KEY_HASH_THRESHOLD) ? (C_OLSR_ARENA::get_block_size(get_slot_count(capacity) * sizeof(T_UINT32))
+                                                  + C_OLSR_ARENA::get_block_size(capacity * sizeof(T_UINT32))) : 0);
+    }
+
+  private:
+
+    std::pmr::vector<T_KEY> m_keys;             /* Key of each row */
+    std::pmr::vector<T_UINT32> m_slots;         /* Hash table of the rows plus one, empty below the threshold */
+    std::pmr::vector<T_UINT32> m_rows;          /* New row of each row during an erasure */
+    T_UINT32 m_slot_shift;                      /* Shift taking the hash to a slot */
+
+    /* Power of two slots keeping the table at most half full */
+    static constexpr std::size_t
+    get_slot_count (std::size_t keys)
+    {
+      std::size_t slots = 1;
+
+      while(slots < (keys * 2))
+        {
+          slots <<= 1;
+        }
+      return slots;
+    }
+
+    std::size_t
+    get_slot (T_KEY key) const
+    {
+      return (std::size_t)(((T_UINT32)key * M_KEY_HASH_MULTIPLIER) >> m_slot_shift);
+    }
+
+    /* Adds a row, unless an earlier row has the same key */
+    void
+    add_slot (std::size_t row)
+    {
+      std::size_t slot = get_slot(m_keys[row]);
+
+      while(m_slots[slot] != M_KEY_HASH_EMPTY)
+        {
+          if(m_keys[m_slots[slot] - 1] == m_keys[row])
+            {
+              return;
+            }
+          slot = (slot + 1) & (m_slots.size() - 1);
+        }
+      m_slots[slot] = row + 1;
+    }
+
+    /* Removes the slot of a row, shifting back the slots probed after it so that no probe sequence is cut */
+    void
+    remove_slot (std::size_t row)
+    {
+      std::size_t mask = m_slots.size() - 1;
+      std::size_t hole = get_slot(m_keys[row]);
+
+      while((m_slots[hole] - 1) != row)
+        {
+          if(m_slots[hole] == M_KEY_HASH_EMPTY)
+            {
+              return;
+            }
+          hole = (hole + 1) & mask;
+        }
+
+      for(std::size_t next = (hole + 1) & mask; m_slots[next] != M_KEY_HASH_EMPTY; next = (next + 1) & mask)
+        {
+          /* The slot may move to the hole if its probe started at or before the hole */
+          if(((next - get_slot(m_keys[m_slots[next] - 1])) & mask) >= ((next - hole) & mask))
+            {
+              m_slots[hole] = m_slots[next];
+              hole = next;
+            }
+        }
+      m_slots[hole] = M_KEY_HASH_EMPTY;
+    }
+
+    /* Builds the table for the current keys, or drops it below the threshold */
+    void
+    rebuild ()
+    {
+      m_slots.clear();
+
+      if(m_keys.size() <= M_KEY_HASH_THRESHOLD)
+        {
+          return;
+        }
+
+      std::size_t slot_count = get_slot_count(m_keys.size());
+
+      m_slots.assign(slot_count, M_KEY_HASH_EMPTY);
+      m_slot_shift = 32 - __builtin_ctzll(slot_count);
+
+      for(std::size_t row = 0; row < m_keys.size(); row++)
+        {
+          add_slot(row);
+        }
+    }
+  };
+
+  /**
+   * One bit per packed address, for a flag of a set that is tested far
+   * more often than it changes. The owner sets the bit of a tuple with
+   * the flag and clears it when the flag or the tuple goes, so that a
+   * test does not look the tuple up. The bits are paged by net id, one
+   * page of 256 bits per net holding a set bit, taken from the arena on
+   * first use, so that an instance pays for the nets of its neighbors
+   * only. A test reads the page of the net and then the bit.
+   */
+  class C_ADDRESS_BITMAP
+  {
+
+  public:
+    C_ADDRESS_BITMAP(std::pmr::memory_resource* resource) : m_page_of_net(resource), m_pages(resource), m_page_nets(resource) {}
+
+    void
+    set (T_UINT16 key, T_BOOL value)
+    {
+      T_UINT16 page = (m_page_of_net.empty() == true) ? M_ADDRESS_NO_PAGE : m_page_of_net[key >> 8];
+      T_UINT64 bit = (T_UINT64)1 << (key % M_MASK_WORD_BITS);
+
+      if(page == M_ADDRESS_NO_PAGE)
+        {
+          if(value == false)
+            {
+              return;
+            }
+          page = add_page(key >> 8);
+        }
+
+      if(value == true)
+        {
+          m_pages[page - 1][(key & 0xFF) / M_MASK_WORD_BITS] |= bit;
+        }
+      else
+        {
+          m_pages[page - 1][(key & 0xFF) / M_MASK_WORD_BITS] &= ~bit;
+        }
+    }
+
+    T_BOOL
+    test (T_UINT16 key) const
+    {
+      if(m_page_of_net.empty() == true)
+        {
+          return false;
+        }
+
+      T_UINT16 page = m_page_of_net[key >> 8];
+
+      return ((page != M_ADDRESS_NO_PAGE)
+              and (((m_pages[page - 1][(key & 0xFF) / M_MASK_WORD_BITS] >> (key % M_MASK_WORD_BITS)) & 1) != 0));
+    }
+
+    /* Clears the bits, the cost follows the pages in use and the buffers are kept */
+    void
+    clear (void)
+    {
+      for(T_UINT8 net_id : m_page_nets)
+        {
+          m_page_of_net[net_id] = M_ADDRESS_NO_PAGE;
+        }
+      m_pages.clear();
+      m_page_nets.clear();
+    }
+
+    /* Clears the bits and drops the buffers */
+    void
+    reset (void)
+    {
+      std::pmr::vector<T_UINT16>(m_page_of_net.get_allocator()).swap(m_page_of_net);
+      std::pmr::vector<T_ADDRESS_PAGE>(m_pages.get_allocator()).swap(m_pages);
+      std::pmr::vector<T_UINT8>(m_page_nets.get_allocator()).swap(m_page_nets);
+    }
+
+    /* Takes the buffers of the pages of capacity keys, so that the bitmap never grows afterwards */
+    void
+    reserve (std::size_t capacity)
+    {
+      m_page_of_net.assign(M_ADDRESS_COUNT / M_ADDRESS_PAGE_BITS, M_ADDRESS_NO_PAGE);
+      m_pages.reserve(get_page_count(capacity));
+      m_page_nets.reserve(get_page_count(capacity));
+    }
+
+    /* Arena bytes of the bitmap of capacity keys, to size a fixed buffer */
+    static constexpr std::size_t
+    get_reserved_bytes (std::size_t capacity)
+    {
+      return C_OLSR_ARENA::get_block_size((M_ADDRESS_COUNT / M_ADDRESS_PAGE_BITS) * sizeof(T_UINT16))
+          + C_OLSR_ARENA::get_block_size(get_page_count(capacity) * sizeof(T_ADDRESS_PAGE))
+          + C_OLSR_ARENA::get_block_size(get_page_count(capacity) * sizeof(T_UINT8));
+    }
+
+  private:
+
+    typedef std::array<T_UINT64, M_ADDRESS_PAGE_BITS / M_MASK_WORD_BITS> T_ADDRESS_PAGE;
+
+    std::pmr::vector<T_UINT16> m_page_of_net;   /* Page of each net id plus one, M_ADDRESS_NO_PAGE if none, empty until a bit is set */
+
+    std::pmr::vector<T_ADDRESS_PAGE> m_pages;   /* Bits of the nets in use */
+
+    std::pmr::vector<T_UINT8> m_page_nets;      /* Net id of each page, so that clear() visits the pages only */
+
+    /* Pages of capacity keys, one per key at most */
+    static constexpr std::size_t
+    get_page_count (std::size_t capacity)
+    {
+      return (capacity < (M_ADDRESS_COUNT / M_ADDRESS_PAGE_BITS)) ? capacity : (M_ADDRESS_COUNT / M_ADDRESS_PAGE_BITS);
+    }
+
+    /* Takes a cleared page for a net and returns it plus one */
+    T_UINT16
+    add_page (T_UINT8 net_id)
+    {
+      if(m_page_of_net.empty() == true)
+        {
+          m_page_of_net.assign(M_ADDRESS_COUNT / M_ADDRESS_PAGE_BITS, M_ADDRESS_NO_PAGE);
+        }
+
+      m_pages.emplace_back();
+      m_pages.back().fill(0);
+      m_page_nets.push_back(net_id);
+      m_page_of_net[net_id] = m_pages.size();
+
+      return m_pages.size();
+    }
+  };
+
+}
+
+#endif /* OLSR_KEY_INDEX_HPP_ */
@@ -0,0 +1,496 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_load_generator.cpp
+ *
+ * Description        :   Implements the synthetic control traffic generator of the receive path .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include "olsr_load_generator.hpp"
+
+using namespace std;
+
+#ifdef M_LOAD_COUNT_ALLOCATIONS
+
+/* Zero initialised, so reading them never runs a thread local constructor */
+static thread_local ns_olsr2_0::T_ALLOC_COUNTERS g_alloc_counters;
+
+/********************************************************************
+ * @function  operator new
+ * @brief     This function allocates from the heap and counts the
+ *            allocation for the calling thread.
+ * @param     size.
+ * @return    Allocated memory.
+ * @note      The array and nothrow forms call this one.
+********************************************************************/
+void* operator new(std::size_t size)
+{
+  void* ptr = std::malloc((size != 0) ? size : 1);
+
+  if(ptr == NULL)
+    {
+      throw std::bad_alloc();
+    }
+
+  g_alloc_counters.allocations++;
+  g_alloc_counters.allocated_bytes += size;
+
+  return ptr;
+}
+
+/********************************************************************
+ * @function  operator new
+ * @brief     This function allocates over aligned memory from the
+ *            heap and counts the allocation for the calling thread.
+ * @param     size, alignment.
+ * @return    Allocated memory.
+ * @note      The aligned array and nothrow forms call this one.
+********************************************************************/
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  std::size_t align = (std::size_t)alignment;
+  void* ptr = std::aligned_alloc(align, ((size + align - 1) / align) * align);
+
+  if(ptr == NULL)
+    {
+      throw std::bad_alloc();
+    }
+
+  g_alloc_counters.allocations++;
+  g_alloc_counters.allocated_bytes += size;
+
+  return ptr;
+}
+
+/********************************************************************
+ * @function  operator delete
+ * @brief     This function releases memory of operator new.
+ * @param     ptr.
+ * @return    None.
+ * @note      None.
+********************************************************************/
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+/********************************************************************
+ * @function  operator delete
+ * @brief     This function releases memory of operator new.
+ * @param     ptr.
+ * @return    None.
+ * @note      The size is not needed by free.
+********************************************************************/
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+/********************************************************************
+ * @function  operator delete
+ * @brief     This function releases memory of the aligned operator new.
+ * @param     ptr.
+ * @return    None.
+ * @note      None.
+********************************************************************/
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+/********************************************************************
+ * @function  operator delete
+ * @brief     This function releases memory of the aligned operator new.
+ * @param     ptr.
+ * @return    None.
+ * @note      None.
+********************************************************************/
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+#endif
+
+namespace ns_olsr2_0
+{
+#define M_LOAD_NODES_PER_NET        254         /* Node ids of one orthogonal net */
+#define M_LOAD_NEIGHBOR_NET         1           /* Net of the instance and its 1-hop neighbors */
+#define M_LOAD_SELECTOR_STRIDE      2           /* Every second neighbor selects the instance as MPR */
+
+  /********************************************************************
+   * @function  get_alloc_counters
+   * @brief     This function returns the allocation counters of the
+   *            calling thread.
+   * @param     None.
+   * @return    Counters, zero if M_LOAD_COUNT_ALLOCATIONS is not set.
+   * @note      None.
+  ********************************************************************/
+  T_ALLOC_COUNTERS get_alloc_counters(void)
+  {
+#ifdef M_LOAD_COUNT_ALLOCATIONS
+    return g_alloc_counters;
+#else
+    T_ALLOC_COUNTERS counters = {0, 0};
+
+    return counters;
+#endif
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_LOAD_GENERATOR
+   * @brief     This function is the constructor of
+   *            C_OLSR_LOAD_GENERATOR, it starts the instance under load.
+   * @param     config.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_LOAD_GENERATOR::C_OLSR_LOAD_GENERATOR(const T_LOAD_CONFIG& config)
+    : m_config(config), m_rng(config.seed)
+  {
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+    T_NODE_ADDRESS node_addr;
+
+    m_config.neighbor_count = std::min(std::max(m_config.neighbor_count, (T_UINT32)1), (T_UINT32)M_LOAD_NODES_PER_NET);
+    m_config.topology_size = std::max(m_config.topology_size, (T_UINT32)1);
+    m_config.offered_rate = std::max(m_config.offered_rate, (T_UINT32)1);
+
+    m_hello_seq.resize(m_config.neighbor_count, 0);
+    m_tc_seq.resize(m_config.topology_size, 0);
+    m_tc_ansn.resize(m_config.topology_size, 0);
+
+    node_addr.net_id = M_LOAD_NEIGHBOR_NET;
+    node_addr.node_id = M_LOAD_NODES_PER_NET + 1;
+
+    set_olsr_clock(&m_clock);
+    m_node.set_node_addr(node_addr);
+    m_node.set_transport(&m_transport);
+    m_node.init(NORMAL_NODE_INSTANCE);
+    set_olsr_clock(prev_clock);
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_LOAD_GENERATOR
+   * @brief     This function is the destructor of C_OLSR_LOAD_GENERATOR.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_LOAD_GENERATOR::~C_OLSR_LOAD_GENERATOR()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  get_default_config
+   * @brief     This function returns a neighborhood of 32 nodes
+   *            relaying the TCs of 1000 originators.
+   * @param     None.
+   * @return    config.
+   * @note      None.
+  ********************************************************************/
+  T_LOAD_CONFIG C_OLSR_LOAD_GENERATOR::get_default_config(void)
+  {
+    T_LOAD_CONFIG config;
+
+    config.packet_count = 100000;
+    config.neighbor_count = 32;
+    config.topology_size = 1000;
+    config.tc_ratio = 0.8;
+    config.duplicate_ratio = 0.5;
+    config.offered_rate = 1000;
+    config.seed = 1;
+
+    return config;
+  }
+
+  /********************************************************************
+   * @function  get_neighbor_address
+   * @brief     This function returns the address of a 1-hop neighbor.
+   * @param     idx.
+   * @return    Node address.
+   * @note      None.
+  ********************************************************************/
+  T_NODE_ADDRESS C_OLSR_LOAD_GENERATOR::get_neighbor_address(T_UINT32 idx)
+  {
+    T_NODE_ADDRESS node_addr;
+
+    node_addr.net_id = M_LOAD_NEIGHBOR_NET;
+    node_addr.node_id = 1 + idx;
+
+    return node_addr;
+  }
+
+  /********************************************************************
+   * @function  get_originator_address
+   * @brief     This function returns the address of a TC originator,
+   *            the originators fill the nets after the neighbors' net.
+   * @param     idx.
+   * @return    Node address.
+   * @note      None.
+  ********************************************************************/
+  T_NODE_ADDRESS C_OLSR_LOAD_GENERATOR::get_originator_address(T_UINT32 idx)
+  {
+    T_NODE_ADDRESS node_addr;
+
+    node_addr.net_id = M_LOAD_NEIGHBOR_NET + 1 + (idx / M_LOAD_NODES_PER_NET);
+    node_addr.node_id = 1 + (idx % M_LOAD_NODES_PER_NET);
+
+    return node_addr;
+  }
+
+  /********************************************************************
+   * @function  make_hello
+   * @brief     This function fabricates the HELLO of a random neighbor,
+   *            listing the instance as symmetric and a few other
+   *            neighbors.
+   * @param     load_packet.
+   * @return    None.
+   * @note      One neighbor in M_LOAD_SELECTOR_STRIDE lists the
+   *            instance as its flooding and routing MPR, so that the
+   *            TCs of those neighbors are forwarded.
+  ********************************************************************/
+  void C_OLSR_LOAD_GENERATOR::make_hello(T_LOAD_PACKET& load_packet)
+  {
+    T_UINT32 nbr_idx = m_rng() % m_config.neighbor_count;
+    T_UINT32 listed_count = std::min((T_UINT32)M_LOAD_HELLO_ADDRESSES, m_config.neighbor_count - 1);
+    C_MESSAGE_HEADER msg;
+    C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK addr_block;
+
+    load_packet.sender_address = get_neighbor_address(nbr_idx);
+
+    msg.set_message_attributes(load_packet.sender_address, HELLO_MESSAGE, ++m_hello_seq[nbr_idx]);
+
+    C_MESSAGE_HEADER::T_HELLO& hello_msg = msg.get_hello();
+
+    hello_msg.node_willingness.fields.route_will = WILL_MEDIUM;
+    hello_msg.node_willingness.fields.flood_will = WILL_MEDIUM;
+    hello_msg.leader_info.is_leader = false;
+    hello_msg.leader_info.leader_addr = load_packet.sender_address;
+    hello_msg.abf = NET_ID_COMMON;
+    hello_msg.common_id = M_LOAD_NEIGHBOR_NET;
+
+    addr_block.unique_id = m_node.get_node_addr().node_id;
+    addr_block.common_field.link_state.type_fields.link_type = SYMMETRIC_LINK;
+    addr_block.common_field.link_state.type_fields.nbr_type = ((nbr_idx % M_LOAD_SELECTOR_STRIDE) == 0) ? MPR_FLOOD_ROUTE : SYMMETRIC_NEIGHBOR;
+    addr_block.metric[0] = 1.0;
+    addr_block.metric[1] = 1.0;
+    hello_msg.neighbor_set.push_back(addr_block);
+
+    addr_block.common_field.link_state.type_fields.nbr_type = SYMMETRIC_NEIGHBOR;
+
+    for(T_UINT32 idx = 1; idx <= listed_count; idx++)
+      {
+        addr_block.unique_id = get_neighbor_address((nbr_idx + idx) % m_config.neighbor_count).node_id;
+        hello_msg.neighbor_set.push_back(addr_block);
+      }
+
+    msg.set_message_length(msg.get_msg_size());
+
+    load_packet.packet.set_packet_length(0);
+    load_packet.packet.append_message(msg);
+  }
+
+  /********************************************************************
+   * @function  make_tc
+   * @brief     This function fabricates a TC with a new ANSN from a
+   *            random originator, relayed by a random neighbor.
+   * @param     load_packet.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_LOAD_GENERATOR::make_tc(T_LOAD_PACKET& load_packet)
+  {
+    T_UINT32 orig_idx = m_rng() % m_config.topology_size;
+    T_NODE_ADDRESS orig_addr = get_originator_address(orig_idx);
+    C_MESSAGE_HEADER msg;
+    C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK tc_addr_block;
+
+    load_packet.sender_address = get_neighbor_address(m_rng() % m_config.neighbor_count);
+
+    msg.set_message_attributes(orig_addr, TC_MESSAGE, ++m_tc_seq[orig_idx]);
+    msg.set_time_to_live(msg.get_time_to_live() - 1);
+    msg.set_hop_count(1);
+
+    C_MESSAGE_HEADER::T_TC& tc_msg = msg.get_tc();
+
+    tc_msg.ansn = ++m_tc_ansn[orig_idx];
+    tc_addr_block.tc_msg_type = ROUTABLE_ORIG;
+    tc_addr_block.abf = NET_ID_COMMON;
+    tc_addr_block.common_id = orig_addr.net_id;
+
+    for(T_UINT32 idx = 1; idx <= M_LOAD_TC_ADDRESSES; idx++)
+      {
+        C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK addr_block;
+
+        addr_block.unique_id = 1 + ((orig_addr.node_id + idx) % M_LOAD_NODES_PER_NET);
+        addr_block.common_field.hop_count = 0;
+        addr_block.metric[0] = 1.0;
+        addr_block.metric[1] = 1.0;
+        tc_addr_block.network_info.push_back(addr_block);
+      }
+
+    tc_msg.tc_addr_set.push_back(tc_addr_block);
+    msg.set_message_length(msg.get_msg_size());
+
+    load_packet.packet.set_packet_length(0);
+    load_packet.packet.append_message(msg);
+
+    m_tc_history.push_back(load_packet);
+    if(m_tc_history.size() > M_LOAD_TC_HISTORY)
+      {
+        m_tc_history.pop_front();
+      }
+  }
+
+  /********************************************************************
+   * @function  make_packet
+   * @brief     This function fabricates the next packet, a HELLO, a new
+   *            TC or a copy of a recent TC relayed by another neighbor.
+   * @param     load_packet.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_LOAD_GENERATOR::make_packet(T_LOAD_PACKET& load_packet)
+  {
+    std::uniform_real_distribution<float> ratio_dist(0, 1);
+
+    if(ratio_dist(m_rng) >= m_config.tc_ratio)
+      {
+        make_hello(load_packet);
+      }
+    else if((m_tc_history.empty() == false) and (ratio_dist(m_rng) < m_config.duplicate_ratio))
+      {
+        load_packet = m_tc_history[m_rng() % m_tc_history.size()];
+        load_packet.sender_address = get_neighbor_address(m_rng() % m_config.neighbor_count);
+      }
+    else
+      {
+        make_tc(load_packet);
+      }
+  }
+
+  /********************************************************************
+   * @function  run
+   * @brief     This function offers the traffic to the instance and
+   *            measures the receive path of each packet.
+   * @param     None.
+   * @return    report.
+   * @note      A packet is timed from recv_olsr to the end of
+   *            send_olsr_msg, which sends the forwarded TCs. The timers
+   *            due by the next arrival run afterwards and are counted
+   *            in the busy time only.
+  ********************************************************************/
+  T_LOAD_REPORT C_OLSR_LOAD_GENERATOR::run(void)
+  {
+    typedef std::chrono::steady_clock T_LOAD_CLOCK;
+
+    T_LOAD_REPORT report = T_LOAD_REPORT();
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+    std::vector<T_UINT64> latencies;
+    T_LOAD_PACKET load_packet;
+    T_NODE_ADDRESS node_addr = m_node.get_node_addr();
+    Time start_time = m_clock.now();
+
+    latencies.reserve(m_config.packet_count);
+
+    set_olsr_clock(&m_clock);
+
+    for(T_UINT32 idx = 0; idx < m_config.packet_count; idx++)
+      {
+        make_packet(load_packet);
+
+        T_ALLOC_COUNTERS alloc_start = get_alloc_counters();
+        T_LOAD_CLOCK::time_point rx_start = T_LOAD_CLOCK::now();
+
+        m_node.recv_olsr(load_packet.packet, load_packet.sender_address, node_addr, 1.0);
+        m_node.send_olsr_msg();
+
+        T_LOAD_CLOCK::time_point rx_end = T_LOAD_CLOCK::now();
+        T_ALLOC_COUNTERS alloc_end = get_alloc_counters();
+
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(rx_end - rx_start).count());
+        report.allocations += alloc_end.allocations - alloc_start.allocations;
+        report.allocated_bytes += alloc_end.allocated_bytes - alloc_start.allocated_bytes;
+
+        m_clock.advance_to(start_time + (((Time)(idx + 1) * M_MSEC_PER_SEC) / m_config.offered_rate));
+
+        T_LOAD_CLOCK::time_point timer_start = T_LOAD_CLOCK::now();
+
+        m_node.run();
+
+        report.timer_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(T_LOAD_CLOCK::now() - timer_start).count();
+      }
+
+    set_olsr_clock(prev_clock);
+
+    report.packets = latencies.size();
+    report.overload = m_node.get_overload_counters();
+
+    if(latencies.empty() == false)
+      {
+        for(std::vector<T_UINT64>::const_iterator lat_iter = latencies.begin(); lat_iter != latencies.end(); lat_iter++)
+          {
+            report.busy_ns += *lat_iter;
+          }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        report.latency_p50_ns = latencies[(latencies.size() * 50) / 100];
+        report.latency_p90_ns = latencies[(latencies.size() * 90) / 100];
+        report.latency_p99_ns = latencies[(latencies.size() * 99) / 100];
+        report.latency_p999_ns = latencies[(latencies.size() * 999) / 1000];
+        report.latency_max_ns = latencies.back();
+      }
+
+    report.busy_ns += report.timer_ns;
+    report.packets_per_sec = (report.busy_ns != 0) ? ((double)report.packets * 1e9 / report.busy_ns) : 0;
+
+    return report;
+  }
+
+  /********************************************************************
+   * @function  print_report
+   * @brief     This function prints the traffic and its results.
+   * @param     config, report.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_LOAD_GENERATOR::print_report(const T_LOAD_CONFIG& config, const T_LOAD_REPORT& report)
+  {
+    cout << "Offered packets = " << config.packet_count << " neighbors = " << config.neighbor_count
+         << " originators = " << config.topology_size << " tc ratio = " << config.tc_ratio
+         << " duplicate ratio = " << config.duplicate_ratio << endl;
+    cout << "Packets per second = " << report.packets_per_sec << endl;
+    cout << "Busy time = " << report.busy_ns << " ns, timers = " << report.timer_ns << " ns" << endl;
+    cout << "Latency p50 = " << report.latency_p50_ns << " p90 = " << report.latency_p90_ns
+         << " p99 = " << report.latency_p99_ns << " p99.9 = " << report.latency_p999_ns
+         << " max = " << report.latency_max_ns << " ns" << endl;
+#ifdef M_LOAD_COUNT_ALLOCATIONS
+    cout << "Allocations = " << report.allocations << " (" << report.allocated_bytes << " bytes), per packet = "
+         << ((report.packets != 0) ? ((double)report.allocations / report.packets) : 0) << endl;
+#else
+    cout << "Allocations = not counted, build with -DM_LOAD_COUNT_ALLOCATIONS" << endl;
+#endif
+    cout << "HELLOs admitted = " << report.overload.hello_admitted << " TCs admitted = " << report.overload.tc_admitted << endl;
+  }
+
+}
@@ -0,0 +1,157 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_load_generator.hpp
+ *
+ * Description        :   To store the synthetic control traffic generator of the receive path .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_LOAD_GENERATOR_HPP_
+#define OLSR_LOAD_GENERATOR_HPP_
+
+#include <random>
+#include <deque>
+#include "olsr.hpp"                  /* Include file for olsr instance */
+
+/* #define M_LOAD_COUNT_ALLOCATIONS */    /* Replaces operator new to count the heap allocations of each thread for the load report, define for a load or bench build only */
+
+namespace ns_olsr2_0
+{
+#define M_LOAD_TC_HISTORY           64          /* Recent TCs a duplicate is copied from */
+#define M_LOAD_TC_ADDRESSES         8           /* Advertised neighbors of a fabricated TC */
+#define M_LOAD_HELLO_ADDRESSES      16          /* Neighbors listed by a fabricated HELLO besides the receiver */
+
+  /**
+   * Traffic offered to the receive path
+   */
+  typedef struct
+  {
+    T_UINT32 packet_count;              /* Packets pushed through recv_olsr */
+    T_UINT32 neighbor_count;            /* 1-hop neighbors sending HELLOs and relaying TCs, at most 254 */
+    T_UINT32 topology_size;             /* Originators of the TCs */
+    float tc_ratio;                     /* Share of the packets carrying a TC */
+    float duplicate_ratio;              /* Share of the TCs which are copies relayed by another neighbor */
+    T_UINT32 offered_rate;              /* Packets per virtual second, paces the timers of the instance */
+    T_UINT32 seed;                      /* Seed of the traffic */
+  }T_LOAD_CONFIG;
+
+  /**
+   * Results of a load run
+   */
+  typedef struct
+  {
+    T_UINT64 packets;                   /* Packets processed */
+    T_UINT64 busy_ns;                   /* Time spent in the receive path and the timers */
+    T_UINT64 timer_ns;                  /* Part of busy_ns spent in the timers */
+    double packets_per_sec;             /* Packets absorbed per second of busy time */
+    T_UINT64 latency_p50_ns;            /* Receive latency percentiles of one packet */
+    T_UINT64 latency_p90_ns;
+    T_UINT64 latency_p99_ns;
+    T_UINT64 latency_p999_ns;
+    T_UINT64 latency_max_ns;
+    T_UINT64 allocations;               /* Heap allocations of the receive path */
+    T_UINT64 allocated_bytes;           /* Bytes requested by these allocations */
+    T_OVERLOAD_COUNTERS overload;       /* Counters of the overload controller */
+  }T_LOAD_REPORT;
+
+  /**
+   * Allocation counters of the calling thread
+   */
+  typedef struct
+  {
+    T_UINT64 allocations;               /* Calls to operator new */
+    T_UINT64 allocated_bytes;           /* Bytes requested */
+  }T_ALLOC_COUNTERS;
+
+  T_ALLOC_COUNTERS get_alloc_counters(void);   /* Returns the allocation counters of the calling thread */
+
+  /**
+   * Fabricates the HELLOs of the 1-hop neighbors and the TCs they relay
+   * and pushes them one packet at a time through recv_olsr of a single
+   * instance, timing each packet. The instance runs its timers on a
+   * virtual clock paced by the offered rate, outside the packet timing.
+   */
+  class C_OLSR_LOAD_GENERATOR
+  {
+
+  public:
+    C_OLSR_LOAD_GENERATOR(const T_LOAD_CONFIG& config);
+
+    ~C_OLSR_LOAD_GENERATOR();
+
+    static T_LOAD_CONFIG get_default_config(void);
+
+    T_LOAD_REPORT run(void);            /* Offers the traffic and returns its results */
+
+    static void print_report(const T_LOAD_CONFIG& config, const T_LOAD_REPORT& report);
+
+  private:
+
+    /**
+     * Transport dropping the packets of the instance
+     */
+    class C_NULL_TRANSPORT : public C_OLSR_TRANSPORT
+    {
+
+    public:
+      void
+      send_packet (const T_NODE_ADDRESS& /* sender_address */, const C_PACKET_HEADER& /* olsr_packet */)
+      {
+        ;
+      }
+    };
+
+    /**
+     * Fabricated packet and the neighbor relaying it
+     */
+    typedef struct
+    {
+      C_PACKET_HEADER packet;
+      T_NODE_ADDRESS sender_address;
+    }T_LOAD_PACKET;
+
+    T_LOAD_CONFIG m_config;
+
+    std::mt19937 m_rng;                 /* Random source of the traffic */
+
+    C_VIRTUAL_CLOCK m_clock;            /* Clock of the instance */
+
+    C_NULL_TRANSPORT m_transport;
+
+    C_OLSR m_node;                      /* Instance under load */
+
+    std::vector<T_UINT16> m_hello_seq;  /* Next message sequence number of each neighbor */
+
+    std::vector<T_UINT16> m_tc_seq;     /* Next message sequence number of each TC originator */
+
+    std::vector<T_UINT16> m_tc_ansn;    /* Current ANSN of each TC originator */
+
+    std::deque<T_LOAD_PACKET> m_tc_history;     /* Recent TCs, copied by the duplicates */
+
+    static T_NODE_ADDRESS get_neighbor_address(T_UINT32 idx);
+
+    static T_NODE_ADDRESS get_originator_address(T_UINT32 idx);
+
+    void make_hello(T_LOAD_PACKET& load_packet);
+
+    void make_tc(T_LOAD_PACKET& load_packet);
+
+    void make_packet(T_LOAD_PACKET& load_packet);   /* Fabricates the next packet of the traffic */
+  };
+
+}
+
+#endif /* OLSR_LOAD_GENERATOR_HPP_ */
@@ -0,0 +1,249 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_log.cpp
+ *
+ * Description        :   Implements the asynchronous leveled logger of the olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <chrono>
+#include "olsr_log.hpp"
+
+namespace ns_olsr2_0
+{
+  std::atomic<E_LOG_LEVEL> C_OLSR_LOGGER::s_level(LOG_OFF);
+  std::atomic<C_OLSR_LOGGER::T_LOG_RING*> C_OLSR_LOGGER::s_rings(NULL);
+  std::atomic<T_BOOL> C_OLSR_LOGGER::s_running(false);
+  std::thread C_OLSR_LOGGER::s_writer;
+  std::ostream* C_OLSR_LOGGER::s_out = NULL;
+
+  static const char* const g_level_names[] = {"TRACE", "DEBUG", "INFO", "WARN", "ERROR", "OFF"};
+
+  /********************************************************************
+   * @function  start
+   * @brief     This function starts the writer thread, statements
+   *            are buffered from then on.
+   * @param     out - Output of the formatted records.
+   * @return    None.
+   * @note      The level is raised to M_LOG_COMPILE_LEVEL if it is
+   *            still LOG_OFF.
+  ********************************************************************/
+  void C_OLSR_LOGGER::start(std::ostream& out)
+  {
+    if(s_running.load(std::memory_order_acquire) == true)
+      {
+        return;
+      }
+
+    s_out = &out;
+    s_running.store(true, std::memory_order_release);
+    s_writer = std::thread(run_writer);
+
+    if(s_level.load(std::memory_order_relaxed) == LOG_OFF)
+      {
+        set_level(M_LOG_COMPILE_LEVEL);
+      }
+  }
+
+  /********************************************************************
+   * @function  stop
+   * @brief     This function stops the writer thread after it wrote
+   *            the buffered records.
+   * @param     None.
+   * @return    None.
+   * @note      Statements made after stop are dropped silently.
+  ********************************************************************/
+  void C_OLSR_LOGGER::stop(void)
+  {
+    if(s_running.load(std::memory_order_acquire) == false)
+      {
+        return;
+      }
+
+    set_level(LOG_OFF);
+    s_running.store(false, std::memory_order_release);
+    s_writer.join();
+
+    drain();
+    s_out->flush();
+  }
+
+  /********************************************************************
+   * @function  get_dropped_count
+   * @brief     This function returns the records dropped because the
+   *            ring of their thread was full.
+   * @param     None.
+   * @return    Dropped records of all threads.
+   * @note      None.
+  ********************************************************************/
+  T_UINT64 C_OLSR_LOGGER::get_dropped_count(void)
+  {
+    T_UINT64 dropped = 0;
+
+    for(T_LOG_RING* ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+      }
+
+    return dropped;
+  }
+
+  /********************************************************************
+   * @function  register_ring
+   * @brief     This function gives the calling thread the ring of an
+   *            exited thread, or links a new ring to the ring list.
+   * @param     None.
+   * @return    Ring.
+   * @note      Called once per thread, on its first statement. A
+   *            reused ring may still hold records of its previous
+   *            thread, the writer drains them in order.
+  ********************************************************************/
+  C_OLSR_LOGGER::T_LOG_RING* C_OLSR_LOGGER::register_ring(void)
+  {
+    static thread_local C_RING_OWNER t_owner;
+    T_LOG_RING* ring;
+
+    for(ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        T_BOOL released = false;
+
+        if(ring->in_use.compare_exchange_strong(released, true, std::memory_order_acquire) == true)
+          {
+            t_owner.m_ring = ring;
+            return ring;
+          }
+      }
+
+    ring = new T_LOG_RING();
+
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->dropped.store(0, std::memory_order_relaxed);
+    ring->in_use.store(true, std::memory_order_relaxed);
+
+    ring->next = s_rings.load(std::memory_order_relaxed);
+
+    while(s_rings.compare_exchange_weak(ring->next, ring, std::memory_order_release, std::memory_order_relaxed) == false)
+      {
+        ;
+      }
+
+    t_owner.m_ring = ring;
+
+    return ring;
+  }
+
+  /********************************************************************
+   * @function  drain
+   * @brief     This function writes the buffered records of all rings.
+   * @param     None.
+   * @return    Records written.
+   * @note      Only called by the writer thread, or by stop once the
+   *            writer has exited. Records of different threads are not
+   *            merged by time.
+  ********************************************************************/
+  T_UINT32 C_OLSR_LOGGER::drain(void)
+  {
+    T_UINT32 written = 0;
+
+    for(T_LOG_RING* ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        T_UINT32 head = ring->head.load(std::memory_order_relaxed);
+        T_UINT32 tail = ring->tail.load(std::memory_order_acquire);
+
+        for(; head != tail; head++)
+          {
+            write_record(ring->records[head & (M_LOG_RING_SIZE - 1)]);
+            written++;
+          }
+
+        ring->head.store(head, std::memory_order_release);
+      }
+
+    return written;
+  }
+
+  /********************************************************************
+   * @function  write_record
+   * @brief     This function formats a record, each {} of the format is
+   *            replaced by the next argument.
+   * @param     record.
+   * @return    None.
+   * @note      Placeholders without an argument are written as is.
+  ********************************************************************/
+  void C_OLSR_LOGGER::write_record(const T_LOG_RECORD& record)
+  {
+    std::ostream& out = *s_out;
+    T_UINT8 arg_idx = 0;
+
+    out << "[" << record.timestamp << "] " << g_level_names[record.level] << " ";
+
+    for(const char* fmt = record.format; *fmt != '\0'; fmt++)
+      {
+        if((fmt[0] == '{') and (fmt[1] == '}') and (arg_idx < record.arg_count))
+          {
+            const T_LOG_ARG& arg = record.args[arg_idx++];
+
+            switch(arg.type)
+              {
+              case T_LOG_ARG::INT_ARG:
+                out << arg.int_value;
+                break;
+              case T_LOG_ARG::UINT_ARG:
+                out << arg.uint_value;
+                break;
+              case T_LOG_ARG::FLOAT_ARG:
+                out << arg.float_value;
+                break;
+              case T_LOG_ARG::STRING_ARG:
+                out << arg.string_value;
+                break;
+              }
+            fmt++;
+          }
+        else
+          {
+            out << *fmt;
+          }
+      }
+
+    out << '\n';
+  }
+
+  /********************************************************************
+   * @function  run_writer
+   * @brief     This function is the writer thread, it drains the rings
+   *            and flushes the output once per batch.
+   * @param     None.
+   * @return    None.
+   * @note      Sleeps M_LOG_DRAIN_PERIOD_MS when the rings are empty.
+  ********************************************************************/
+  void C_OLSR_LOGGER::run_writer(void)
+  {
+    while(s_running.load(std::memory_order_acquire) == true)
+      {
+        if(drain() > 0)
+          {
+            s_out->flush();
+          }
+        else
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(M_LOG_DRAIN_PERIOD_MS));
+          }
+      }
+  }
+
+}
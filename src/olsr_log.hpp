@@ -0,0 +1,268 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_log.hpp
+ *
+ * Description        :   To store the asynchronous leveled logger of the olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_LOG_HPP_
+#define OLSR_LOG_HPP_
+
+#include <atomic>
+#include <array>
+#include <thread>
+#include <ostream>
+#include <type_traits>
+#include "olsr_metrics.hpp"  /* Include file for the cache line size */
+
+namespace ns_olsr2_0
+{
+#define M_LOG_RING_SIZE         2048    /* Records buffered per thread, a power of two */
+#define M_LOG_MAX_ARGS          6       /* Arguments of one log statement */
+#define M_LOG_DRAIN_PERIOD_MS   10      /* Sleep of the writer thread when the rings are empty */
+
+  /**
+   * Log levels
+   */
+  typedef enum
+  {
+    LOG_TRACE = 0X0,                    /* Per tuple and per loop iteration events */
+    LOG_DEBUG = 0X1,                    /* Per message events */
+    LOG_INFO = 0X2,                     /* Instance life cycle */
+    LOG_WARN = 0X3,
+    LOG_ERROR = 0X4,
+    LOG_OFF = 0X5
+  }E_LOG_LEVEL;
+
+#define M_LOG_COMPILE_LEVEL     LOG_INFO    /* Statements below this level are removed from the build */
+
+  /**
+   * Argument of a log statement, kept in binary form until the writer
+   * thread formats it
+   */
+  typedef struct
+  {
+    enum
+    {
+      INT_ARG,
+      UINT_ARG,
+      FLOAT_ARG,
+      STRING_ARG
+    } type;
+    union
+    {
+      T_INT64 int_value;
+      T_UINT64 uint_value;
+      double float_value;
+      const char* string_value;         /* String literals only, the pointer is read later */
+    };
+  }T_LOG_ARG;
+
+  /**
+   * Buffered log statement
+   */
+  typedef struct
+  {
+    Time timestamp;                     /* Time of the OLSR clock of the logging thread */
+    const char* format;                 /* String literal, each {} is replaced by the next argument */
+    E_LOG_LEVEL level;
+    T_UINT8 arg_count;
+    std::array<T_LOG_ARG, M_LOG_MAX_ARGS> args;
+  }T_LOG_RECORD;
+
+  /**
+   * Logger of the OLSR instances. A log statement copies its format
+   * pointer and arguments into a ring of the calling thread and
+   * returns, a full ring drops the record. A writer thread drains the
+   * rings, formats the records and writes them to the output stream.
+   */
+  class C_OLSR_LOGGER
+  {
+
+  public:
+
+    static void start(std::ostream& out);       /* Starts the writer thread */
+
+    static void stop(void);                     /* Writes the buffered records and stops the writer thread */
+
+    static void
+    set_level (E_LOG_LEVEL level)
+    {
+      s_level.store(level, std::memory_order_relaxed);
+    }
+
+    /* Checks if a statement of this level is written */
+    static T_BOOL
+    is_enabled (E_LOG_LEVEL level)
+    {
+      return (level >= s_level.load(std::memory_order_relaxed));
+    }
+
+    /* Buffers a statement, never blocks */
+    template <typename... T_ARGS>
+    static void
+    log (E_LOG_LEVEL level, const char* format, T_ARGS... args)
+    {
+      static_assert(sizeof...(T_ARGS) <= M_LOG_MAX_ARGS, "Too many log arguments");
+
+      T_LOG_RING* ring = get_ring();
+      T_UINT32 tail = ring->tail.load(std::memory_order_relaxed);
+
+      if((tail - ring->head.load(std::memory_order_acquire)) >= M_LOG_RING_SIZE)
+        {
+          ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+          return;
+        }
+
+      T_LOG_RECORD& record = ring->records[tail & (M_LOG_RING_SIZE - 1)];
+
+      record.timestamp = get_cur_time();
+      record.format = format;
+      record.level = level;
+      record.arg_count = 0;
+      set_args(record, args...);
+
+      ring->tail.store(tail + 1, std::memory_order_release);
+    }
+
+    static T_UINT64 get_dropped_count(void);    /* Records dropped on full rings */
+
+  private:
+
+    /**
+     * Records of one thread, single producer and single consumer
+     */
+    struct alignas(M_CACHE_LINE_SIZE) T_LOG_RING
+    {
+      std::array<T_LOG_RECORD, M_LOG_RING_SIZE> records;
+      alignas(M_CACHE_LINE_SIZE) std::atomic<T_UINT32> tail;    /* Next record written by the thread */
+      std::atomic<T_UINT64> dropped;                            /* Records dropped on a full ring */
+      alignas(M_CACHE_LINE_SIZE) std::atomic<T_UINT32> head;    /* Next record read by the writer */
+      std::atomic<T_BOOL> in_use;                               /* True while a thread owns the ring */
+      T_LOG_RING* next;                                         /* Ring registered before this one */
+    };
+
+    /**
+     * Releases the ring of a thread when the thread exits
+     */
+    class C_RING_OWNER
+    {
+
+    public:
+      C_RING_OWNER() : m_ring(NULL) {}
+
+      ~C_RING_OWNER()
+      {
+        if(m_ring != NULL)
+          {
+            m_ring->in_use.store(false, std::memory_order_release);
+          }
+      }
+
+      T_LOG_RING* m_ring;               /* Ring of the thread */
+    };
+
+    static std::atomic<E_LOG_LEVEL> s_level;        /* Lowest level written, LOG_OFF until started */
+
+    static std::atomic<T_LOG_RING*> s_rings;        /* Last registered ring */
+
+    static std::atomic<T_BOOL> s_running;           /* True while the writer thread runs */
+
+    static std::thread s_writer;                    /* Writer thread */
+
+    static std::ostream* s_out;                     /* Output of the writer thread */
+
+    static T_LOG_RING* register_ring(void);         /* Takes over a released ring or links a new one */
+
+    static T_UINT32 drain(void);                    /* Writes the buffered records, returns their count */
+
+    static void write_record(const T_LOG_RECORD& record);
+
+    static void run_writer(void);
+
+    static T_LOG_RING*
+    get_ring ()
+    {
+      static thread_local T_LOG_RING* t_ring = NULL;
+
+      if(t_ring == NULL)
+        {
+          t_ring = register_ring();
+        }
+      return t_ring;
+    }
+
+    static void set_args (T_LOG_RECORD& /* record */) {}
+
+    template <typename T_ARG, typename... T_ARGS>
+    static void
+    set_args (T_LOG_RECORD& record, T_ARG arg, T_ARGS... args)
+    {
+      set_arg(record.args[record.arg_count++], arg);
+      set_args(record, args...);
+    }
+
+    template <typename T_ARG>
+    static typename std::enable_if<std::is_integral<T_ARG>::value or std::is_enum<T_ARG>::value>::type
+    set_arg (T_LOG_ARG& log_arg, T_ARG arg)
+    {
+      if(std::is_signed<T_ARG>::value or std::is_enum<T_ARG>::value)
+        {
+          log_arg.type = T_LOG_ARG::INT_ARG;
+          log_arg.int_value = (T_INT64)arg;
+        }
+      else
+        {
+          log_arg.type = T_LOG_ARG::UINT_ARG;
+          log_arg.uint_value = (T_UINT64)arg;
+        }
+    }
+
+    static void
+    set_arg (T_LOG_ARG& log_arg, double arg)
+    {
+      log_arg.type = T_LOG_ARG::FLOAT_ARG;
+      log_arg.float_value = arg;
+    }
+
+    static void
+    set_arg (T_LOG_ARG& log_arg, const char* arg)
+    {
+      log_arg.type = T_LOG_ARG::STRING_ARG;
+      log_arg.string_value = arg;
+    }
+  };
+
+/* Removed from the build below M_LOG_COMPILE_LEVEL, the arguments are not evaluated when disabled */
+#define M_LOG(level, ...)                                                                   \
+  do                                                                                        \
+    {                                                                                       \
+      if(((level) >= M_LOG_COMPILE_LEVEL) and (C_OLSR_LOGGER::is_enabled(level) == true))   \
+        {                                                                                   \
+          C_OLSR_LOGGER::log((level), __VA_ARGS__);                                         \
+        }                                                                                   \
+    } while(0)
+
+#define M_LOG_TRACE(...)    M_LOG(LOG_TRACE, __VA_ARGS__)
+#define M_LOG_DEBUG(...)    M_LOG(LOG_DEBUG, __VA_ARGS__)
+#define M_LOG_INFO(...)     M_LOG(LOG_INFO, __VA_ARGS__)
+#define M_LOG_WARN(...)     M_LOG(LOG_WARN, __VA_ARGS__)
+#define M_LOG_ERROR(...)    M_LOG(LOG_ERROR, __VA_ARGS__)
+
+}
+
+#endif /* OLSR_LOG_HPP_ */
@@ -0,0 +1,166 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_memory_report.cpp
+ *
+ * Description        :   Implements the tuple memory report of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include "olsr_memory_report.hpp"
+#include "olsr_metrics.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /* Tuple layouts before the 32 bit times and packed flags, only their sizes are used */
+
+  typedef struct
+  {
+    T_FLOAT l_in_metric;
+    T_FLOAT l_out_metric;
+    T_BOOL l_mpr_selector;
+    T_NODE_ADDRESS l_neighbor_iface_addr;
+    Time l_heard_time;
+    Time l_sym_time;
+    Time l_time;
+    T_UINT8 l_status;
+  }T_LEGACY_LINK_TUPLE;
+
+  typedef struct
+  {
+    T_FLOAT n2_in_metric;
+    T_FLOAT n2_out_metric;
+    T_NODE_ADDRESS n2_neighbor_iface_addr;
+    T_NODE_ADDRESS n2_2hop_addr;
+    Time n2_time;
+  }T_LEGACY_TWO_HOP_NEIGHBOUR_TUPLE;
+
+  typedef struct
+  {
+    T_NODE_ADDRESS n_neighbor_addr;
+    T_FLOAT n_in_metric;
+    T_FLOAT n_out_metric;
+    T_UINT32 n_willingness;
+    T_BOOL n_symmetric;
+    T_BOOL n_flooding_mpr;
+    T_BOOL n_routing_mpr;
+    T_BOOL n_mpr_selector;
+    T_BOOL n_advertised;
+  }T_LEGACY_NEIGHBOUR_TUPLE;
+
+  typedef struct
+  {
+    T_NODE_ADDRESS ar_orig_addr;
+    T_UINT16 ar_seq_number;
+    Time ar_time;
+  }T_LEGACY_ADVERTISING_REMOTE_ROUTER_TUPLE;
+
+  typedef struct
+  {
+    T_NODE_ADDRESS tr_from_orig_addr;
+    T_NODE_ADDRESS tr_to_orig_addr;
+    T_UINT16 tr_seq_number;
+    T_FLOAT tr_metric;
+    Time tr_time;
+  }T_LEGACY_ROUTER_TOPOLOGY_TUPLE;
+
+  typedef struct
+  {
+    E_OLSR_MSG_TYPE type;
+    T_NODE_ADDRESS orig_addr;
+    T_UINT16 seq_number;
+    Time time;
+  }T_LEGACY_MSG_TUPLE;
+
+  /********************************************************************
+   * @function  init_memory_report
+   * @brief     This function zeroes a report.
+   * @param     report.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void init_memory_report(T_MEMORY_REPORT& report)
+  {
+    report.node_count = 0;
+    report.tuple_count = 0;
+    report.tuple_bytes = 0;
+    report.legacy_tuple_bytes = 0;
+    report.scan_bytes = 0;
+    report.legacy_scan_bytes = 0;
+    report.arena_bytes = 0;
+  }
+
+  /********************************************************************
+   * @function  add_memory_report
+   * @brief     This function adds the tuples of one instance to a
+   *            report.
+   * @param     report, state.
+   * @return    None.
+   * @note      The scan bytes are those of the sets searched on every
+   *            HELLO.
+  ********************************************************************/
+  void add_memory_report(T_MEMORY_REPORT& report, const C_OLSR_STATE& state)
+  {
+    T_UINT64 links = state.get_links().size();
+    T_UINT64 neighbours = state.get_one_hop_neighbors().size();
+    T_UINT64 two_hops = state.get_two_hop_neighbours().size();
+    T_UINT64 routers = state.get_advertising_remote_router_set().size();
+    T_UINT64 topology = state.get_router_topology_count();
+    T_UINT64 processed = state.get_processed_msgs().size();
+    T_UINT64 forwarded = state.get_forwarded_msgs().size();
+    T_UINT64 scan_bytes = (links * sizeof(T_LINK_TUPLE)) + (neighbours * sizeof(T_NEIGHBOUR_TUPLE))
+        + (two_hops * sizeof(T_TWO_HOP_NEIGHBOUR_TUPLE));
+    T_UINT64 legacy_scan_bytes = (links * sizeof(T_LEGACY_LINK_TUPLE)) + (neighbours * sizeof(T_LEGACY_NEIGHBOUR_TUPLE))
+        + (two_hops * sizeof(T_LEGACY_TWO_HOP_NEIGHBOUR_TUPLE));
+
+    report.node_count++;
+    report.tuple_count += links + neighbours + two_hops + routers + topology + processed + forwarded;
+    report.scan_bytes += scan_bytes;
+    report.legacy_scan_bytes += legacy_scan_bytes;
+    report.tuple_bytes += scan_bytes + (routers * sizeof(T_ADVERTISING_REMOTE_ROUTER_TUPLE))
+        + (topology * sizeof(T_ROUTER_TOPOLOGY_TUPLE)) + (processed * sizeof(T_PROCESSED_MSG_TUPLE))
+        + (forwarded * sizeof(T_FORWARDED_MSG_TUPLE));
+    report.legacy_tuple_bytes += legacy_scan_bytes + (routers * sizeof(T_LEGACY_ADVERTISING_REMOTE_ROUTER_TUPLE))
+        + (topology * sizeof(T_LEGACY_ROUTER_TOPOLOGY_TUPLE)) + ((processed + forwarded) * sizeof(T_LEGACY_MSG_TUPLE));
+    report.arena_bytes += state.get_arena().get_bytes_in_use();
+  }
+
+  /********************************************************************
+   * @function  print_memory_report
+   * @brief     This function prints the tuple memory per node in both
+   *            layouts.
+   * @param     out, report.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void print_memory_report(std::ostream& out, const T_MEMORY_REPORT& report)
+  {
+    double nodes = (report.node_count != 0) ? report.node_count : 1;
+
+    out << "Tuple layout bytes link = " << sizeof(T_LINK_TUPLE) << " (was " << sizeof(T_LEGACY_LINK_TUPLE) << ")"
+        << " neighbor = " << sizeof(T_NEIGHBOUR_TUPLE) << " (was " << sizeof(T_LEGACY_NEIGHBOUR_TUPLE) << ")"
+        << " two hop = " << sizeof(T_TWO_HOP_NEIGHBOUR_TUPLE) << " (was " << sizeof(T_LEGACY_TWO_HOP_NEIGHBOUR_TUPLE) << ")"
+        << " topology = " << sizeof(T_ROUTER_TOPOLOGY_TUPLE) << " (was " << sizeof(T_LEGACY_ROUTER_TOPOLOGY_TUPLE) << ")"
+        << " processed = " << sizeof(T_PROCESSED_MSG_TUPLE) << " (was " << sizeof(T_LEGACY_MSG_TUPLE) << ")" << std::endl;
+    out << "Tuples per node = " << (report.tuple_count / nodes)
+        << " bytes per node = " << (report.tuple_bytes / nodes)
+        << " (was " << (report.legacy_tuple_bytes / nodes) << ")"
+        << " arena bytes per node = " << (report.arena_bytes / nodes) << std::endl;
+    out << "Cache lines per neighborhood scan = " << ((report.scan_bytes / nodes) / M_CACHE_LINE_SIZE)
+        << " (was " << ((report.legacy_scan_bytes / nodes) / M_CACHE_LINE_SIZE) << ")" << std::endl;
+  }
+
+}
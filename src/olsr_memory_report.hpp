@@ -0,0 +1,54 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_memory_report.hpp
+ *
+ * Description        :   To store the tuple memory report of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_MEMORY_REPORT_HPP_
+#define OLSR_MEMORY_REPORT_HPP_
+
+#include <ostream>
+#include "olsr_state.hpp"    /* Include file for the OLSR state */
+
+namespace ns_olsr2_0
+{
+
+  /**
+   * Tuple memory of a group of instances, with the tuples laid out as
+   * now and as before the compact layouts
+   */
+  typedef struct
+  {
+    T_UINT32 node_count;                /* Instances summed */
+    T_UINT64 tuple_count;               /* Tuples of all the sets */
+    T_UINT64 tuple_bytes;               /* Bytes of the tuples */
+    T_UINT64 legacy_tuple_bytes;        /* Bytes of the same tuples in the previous layouts */
+    T_UINT64 scan_bytes;                /* Bytes read by one pass over the link, neighbor and 2-hop sets */
+    T_UINT64 legacy_scan_bytes;         /* Same pass in the previous layouts */
+    T_UINT64 arena_bytes;               /* Bytes held by the arenas, with the unused capacity */
+  }T_MEMORY_REPORT;
+
+  void init_memory_report(T_MEMORY_REPORT& report);                             /* Zeroes a report */
+
+  void add_memory_report(T_MEMORY_REPORT& report, const C_OLSR_STATE& state);   /* Adds the tuples of one instance */
+
+  void print_memory_report(std::ostream& out, const T_MEMORY_REPORT& report);   /* Prints the averages per node */
+
+}
+
+#endif /* OLSR_MEMORY_REPORT_HPP_ */
@@ -0,0 +1,169 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_metrics.cpp
+ *
+ * Description        :   Implements the per thread protocol counters and gauges .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <iostream>
+#include "olsr_metrics.hpp"
+
+using namespace std;
+
+namespace ns_olsr2_0
+{
+
+  std::atomic<C_OLSR_METRICS::T_METRIC_SLOT*> C_OLSR_METRICS::s_slots(NULL);
+
+  /********************************************************************
+   * @function  register_slot
+   * @brief     This function gives the calling thread the slot of an
+   *            exited thread, or links a new slot to the slot list.
+   * @param     None.
+   * @return    Slot.
+   * @note      Called once per thread, on its first update. Slots
+   *            are never unlinked, so the list can be walked without
+   *            a lock.
+  ********************************************************************/
+  C_OLSR_METRICS::T_METRIC_SLOT* C_OLSR_METRICS::register_slot(void)
+  {
+    static thread_local C_SLOT_OWNER t_owner;
+    T_METRIC_SLOT* slot;
+
+    for(slot = s_slots.load(std::memory_order_acquire); slot != NULL; slot = slot->next)
+      {
+        T_BOOL released = false;
+
+        if(slot->in_use.compare_exchange_strong(released, true, std::memory_order_acquire) == true)
+          {
+            t_owner.m_slot = slot;
+            return slot;
+          }
+      }
+
+    slot = new T_METRIC_SLOT();
+
+    for(T_UINT32 idx = 0; idx < MAX_METRIC_COUNTER; idx++)
+      {
+        slot->counters[idx].store(0, std::memory_order_relaxed);
+      }
+    for(T_UINT32 idx = 0; idx < MAX_METRIC_GAUGE; idx++)
+      {
+        slot->gauges[idx].store(0, std::memory_order_relaxed);
+      }
+    slot->in_use.store(true, std::memory_order_relaxed);
+
+    slot->next = s_slots.load(std::memory_order_relaxed);
+
+    while(s_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed) == false)
+      {
+        ;
+      }
+
+    t_owner.m_slot = slot;
+
+    return slot;
+  }
+
+  /********************************************************************
+   * @function  snapshot
+   * @brief     This function sums the metrics of all the threads.
+   * @param     None.
+   * @return    snapshot.
+   * @note      Lock free, the threads keep updating their slots.
+  ********************************************************************/
+  T_METRICS_SNAPSHOT C_OLSR_METRICS::snapshot(void)
+  {
+    T_METRICS_SNAPSHOT snapshot;
+
+    snapshot.counters.fill(0);
+    snapshot.gauges.fill(0);
+    snapshot.slot_count = 0;
+
+    for(const T_METRIC_SLOT* slot = s_slots.load(std::memory_order_acquire); slot != NULL; slot = slot->next)
+      {
+        for(T_UINT32 idx = 0; idx < MAX_METRIC_COUNTER; idx++)
+          {
+            snapshot.counters[idx] += slot->counters[idx].load(std::memory_order_relaxed);
+          }
+        for(T_UINT32 idx = 0; idx < MAX_METRIC_GAUGE; idx++)
+          {
+            snapshot.gauges[idx] += slot->gauges[idx].load(std::memory_order_relaxed);
+          }
+        snapshot.slot_count++;
+      }
+
+    return snapshot;
+  }
+
+  /********************************************************************
+   * @function  get_counter_name
+   * @brief     This function returns the name of a counter.
+   * @param     counter.
+   * @return    Name.
+   * @note      None.
+  ********************************************************************/
+  const char* C_OLSR_METRICS::get_counter_name(E_METRIC_COUNTER counter)
+  {
+    static const char* const counter_names[MAX_METRIC_COUNTER] =
+      {
+        "rx_hello", "rx_tc", "tx_hello", "tx_tc", "duplicate_drop", "ttl_drop",
+        "tc_forward", "mpr_computation", "route_computation"
+      };
+
+    return (counter < MAX_METRIC_COUNTER) ? counter_names[counter] : "unknown";
+  }
+
+  /********************************************************************
+   * @function  get_gauge_name
+   * @brief     This function returns the name of a gauge.
+   * @param     gauge.
+   * @return    Name.
+   * @note      None.
+  ********************************************************************/
+  const char* C_OLSR_METRICS::get_gauge_name(E_METRIC_GAUGE gauge)
+  {
+    static const char* const gauge_names[MAX_METRIC_GAUGE] =
+      {
+        "link_set", "neighbour_set", "two_hop_set", "advertising_router_set",
+        "router_topology_set", "processed_msg_set", "forwarded_msg_set"
+      };
+
+    return (gauge < MAX_METRIC_GAUGE) ? gauge_names[gauge] : "unknown";
+  }
+
+  /********************************************************************
+   * @function  print_snapshot
+   * @brief     This function prints the metrics of a snapshot, one
+   *            per line.
+   * @param     snapshot.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_METRICS::print_snapshot(const T_METRICS_SNAPSHOT& snapshot)
+  {
+    for(T_UINT32 idx = 0; idx < MAX_METRIC_COUNTER; idx++)
+      {
+        cout << get_counter_name((E_METRIC_COUNTER)idx) << " = " << snapshot.counters[idx] << endl;
+      }
+    for(T_UINT32 idx = 0; idx < MAX_METRIC_GAUGE; idx++)
+      {
+        cout << get_gauge_name((E_METRIC_GAUGE)idx) << " = " << snapshot.gauges[idx] << endl;
+      }
+  }
+
+}
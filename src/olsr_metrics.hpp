@@ -0,0 +1,221 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_metrics.hpp
+ *
+ * Description        :   To store the per thread protocol counters and gauges .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_METRICS_HPP_
+#define OLSR_METRICS_HPP_
+
+#include <atomic>
+#include <array>
+#include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_CACHE_LINE_SIZE       64      /* Bytes of a cache line, the metrics of two threads never share one */
+
+  /**
+   * Protocol events counted
+   */
+  typedef enum
+  {
+    RX_HELLO_COUNTER = 0X0,             /* HELLOs received */
+    RX_TC_COUNTER,                      /* TCs received */
+    TX_HELLO_COUNTER,                   /* HELLOs sent */
+    TX_TC_COUNTER,                      /* TCs sent, forwarded ones included */
+    DUPLICATE_DROP_COUNTER,             /* Messages dropped as already processed */
+    TTL_DROP_COUNTER,                   /* Messages dropped with an expired TTL */
+    TC_FORWARD_COUNTER,                 /* TCs queued for forwarding */
+    MPR_COMPUTATION_COUNTER,            /* MPR recomputations */
+    ROUTE_COMPUTATION_COUNTER,          /* Routing table recomputations */
+    MAX_METRIC_COUNTER
+  }E_METRIC_COUNTER;
+
+  /**
+   * Sizes of the information bases, summed over the instances
+   */
+  typedef enum
+  {
+    LINK_SET_GAUGE = 0X0,
+    NEIGHBOUR_SET_GAUGE,
+    TWO_HOP_SET_GAUGE,
+    ADVERTISING_ROUTER_SET_GAUGE,
+    ROUTER_TOPOLOGY_SET_GAUGE,
+    PROCESSED_MSG_SET_GAUGE,
+    FORWARDED_MSG_SET_GAUGE,
+    MAX_METRIC_GAUGE
+  }E_METRIC_GAUGE;
+
+  /**
+   * Totals of all the threads at the time of a snapshot
+   */
+  typedef struct
+  {
+    std::array<T_UINT64, MAX_METRIC_COUNTER> counters;
+    std::array<T_INT64, MAX_METRIC_GAUGE> gauges;
+    T_UINT32 slot_count;                /* Slots summed, at most one per live thread plus the released ones */
+  }T_METRICS_SNAPSHOT;
+
+  /**
+   * Counters and gauges of the OLSR instances. Each thread updates a
+   * slot of its own, aligned to a cache line, with plain relaxed loads
+   * and stores as it is the only writer. snapshot() sums the slots with
+   * relaxed loads while the threads keep running, so a snapshot is not
+   * an atomic cut but never stops or slows the protocol threads.
+   */
+  class C_OLSR_METRICS
+  {
+
+  public:
+
+    /* Adds count to a counter of the calling thread */
+    static void
+    count (E_METRIC_COUNTER counter, T_UINT64 count = 1)
+    {
+      std::atomic<T_UINT64>& value = get_slot().counters[counter];
+
+      value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    /* Adds delta to a gauge of the calling thread, the gauges of all the threads are summed */
+    static void
+    add_gauge (E_METRIC_GAUGE gauge, T_INT64 delta)
+    {
+      std::atomic<T_INT64>& value = get_slot().gauges[gauge];
+
+      value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static T_METRICS_SNAPSHOT snapshot(void);   /* Sums the metrics of all the threads */
+
+    static const char* get_counter_name(E_METRIC_COUNTER counter);
+
+    static const char* get_gauge_name(E_METRIC_GAUGE gauge);
+
+    static void print_snapshot(const T_METRICS_SNAPSHOT& snapshot);     /* Prints one metric per line */
+
+  private:
+
+    /**
+     * Metrics of one thread, never freed so the counts of a thread
+     * outlive it. The slot of an exited thread is taken over by the
+     * next new thread, which keeps adding to its counts.
+     */
+    struct alignas(M_CACHE_LINE_SIZE) T_METRIC_SLOT
+    {
+      std::array<std::atomic<T_UINT64>, MAX_METRIC_COUNTER> counters;
+      std::array<std::atomic<T_INT64>, MAX_METRIC_GAUGE> gauges;
+      std::atomic<T_BOOL> in_use;       /* True while a thread owns the slot */
+      T_METRIC_SLOT* next;              /* Slot registered before this one */
+    };
+
+    /**
+     * Releases the slot of a thread when the thread exits
+     */
+    class C_SLOT_OWNER
+    {
+
+    public:
+      C_SLOT_OWNER() : m_slot(NULL) {}
+
+      ~C_SLOT_OWNER()
+      {
+        if(m_slot != NULL)
+          {
+            m_slot->in_use.store(false, std::memory_order_release);
+          }
+      }
+
+      T_METRIC_SLOT* m_slot;            /* Slot of the thread */
+    };
+
+    static std::atomic<T_METRIC_SLOT*> s_slots;     /* Last registered slot */
+
+    static T_METRIC_SLOT* register_slot(void);      /* Takes over a released slot or links a new one */
+
+    static T_METRIC_SLOT&
+    get_slot ()
+    {
+      static thread_local T_METRIC_SLOT* t_slot = NULL;
+
+      if(t_slot == NULL)
+        {
+          t_slot = register_slot();
+        }
+      return *t_slot;
+    }
+  };
+
+  /**
+   * Set sizes last published by one instance. A copy publishes its
+   * sizes again and the destructor withdraws them, so the gauges stay
+   * right when instances are copied or moved by a container.
+   */
+  class C_OLSR_GAUGE_SET
+  {
+
+  public:
+    C_OLSR_GAUGE_SET()
+    {
+      m_values.fill(0);
+    }
+
+    C_OLSR_GAUGE_SET(const C_OLSR_GAUGE_SET& other)
+    {
+      m_values.fill(0);
+      *this = other;
+    }
+
+    ~C_OLSR_GAUGE_SET()
+    {
+      for(T_UINT32 idx = 0; idx < MAX_METRIC_GAUGE; idx++)
+        {
+          set((E_METRIC_GAUGE)idx, 0);
+        }
+    }
+
+    C_OLSR_GAUGE_SET&
+    operator= (const C_OLSR_GAUGE_SET& other)
+    {
+      for(T_UINT32 idx = 0; idx < MAX_METRIC_GAUGE; idx++)
+        {
+          set((E_METRIC_GAUGE)idx, other.m_values[idx]);
+        }
+      return *this;
+    }
+
+    /* Publishes the new value of a gauge, only the change is added */
+    void
+    set (E_METRIC_GAUGE gauge, T_INT64 value)
+    {
+      if(value != m_values[gauge])
+        {
+          C_OLSR_METRICS::add_gauge(gauge, value - m_values[gauge]);
+          m_values[gauge] = value;
+        }
+    }
+
+  private:
+
+    std::array<T_INT64, MAX_METRIC_GAUGE> m_values;     /* Values last published */
+  };
+
+}
+
+#endif /* OLSR_METRICS_HPP_ */
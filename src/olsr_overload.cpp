@@ -0,0 +1,266 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_overload.cpp
+ *
+ * Description        :   Implements the overload controller of the receive path .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include "olsr_overload.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  C_OLSR_OVERLOAD_CONTROLLER
+   * @brief     This function is the constructor of
+   *            C_OLSR_OVERLOAD_CONTROLLER.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_OVERLOAD_CONTROLLER::C_OLSR_OVERLOAD_CONTROLLER()
+  {
+    m_config.max_rx_queue_depth = M_RX_QUEUE_MAX_DEPTH;
+    m_config.defer_queue_depth = M_RX_QUEUE_DEFER_DEPTH;
+    m_config.shed_queue_depth = M_RX_QUEUE_SHED_DEPTH;
+    m_config.tick_cpu_budget_us = M_RX_TICK_CPU_BUDGET_US;
+    m_config.max_deferred_msgs = M_MAX_DEFERRED_MSGS;
+    m_config.hello_queue_headroom = M_RX_QUEUE_HELLO_HEADROOM;
+
+    m_in_tick = false;
+    m_queue_depth = 0;
+    m_tick_overloaded = false;
+
+    reset_counters();
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_OVERLOAD_CONTROLLER
+   * @brief     This function is the destructor of
+   *            C_OLSR_OVERLOAD_CONTROLLER.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_OVERLOAD_CONTROLLER::~C_OLSR_OVERLOAD_CONTROLLER()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  reset_counters
+   * @brief     This function clears the overload counters.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_OVERLOAD_CONTROLLER::reset_counters(void)
+  {
+    m_counters = T_OVERLOAD_COUNTERS();
+  }
+
+  /********************************************************************
+   * @function  begin_tick
+   * @brief     This function starts a receive processing tick with the
+   *            depth of the receive queue at that moment.
+   * @param     queue_depth.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_OVERLOAD_CONTROLLER::begin_tick(T_UINT16 queue_depth)
+  {
+    m_in_tick = true;
+    m_queue_depth = queue_depth;
+    m_tick_overloaded = false;
+    m_tick_start = std::chrono::steady_clock::now();
+  }
+
+  /********************************************************************
+   * @function  end_tick
+   * @brief     This function ends the receive processing tick.
+   * @param     None.
+   * @return    None.
+   * @note      Outside a tick only the queue thresholds apply.
+  ********************************************************************/
+  void C_OLSR_OVERLOAD_CONTROLLER::end_tick(void)
+  {
+    m_in_tick = false;
+    m_queue_depth = 0;
+  }
+
+  /********************************************************************
+   * @function  is_budget_exhausted
+   * @brief     This function checks if the cpu budget of the running
+   *            tick is used.
+   * @param     None.
+   * @return    true if the budget is used.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_OVERLOAD_CONTROLLER::is_budget_exhausted(void) const
+  {
+    if(m_in_tick == false)
+      {
+        return false;
+      }
+
+    std::chrono::microseconds elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_tick_start);
+
+    return (elapsed.count() >= (long long)m_config.tick_cpu_budget_us);
+  }
+
+  /********************************************************************
+   * @function  is_overloaded
+   * @brief     This function checks if the queue depth or the cpu
+   *            budget threshold is crossed.
+   * @param     None.
+   * @return    true if overloaded.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_OVERLOAD_CONTROLLER::is_overloaded(void) const
+  {
+    return ((m_queue_depth > m_config.defer_queue_depth) or is_budget_exhausted());
+  }
+
+  /********************************************************************
+   * @function  admit
+   * @brief     This function classifies a received message by its type
+   *            and freshness and decides whether it is processed now,
+   *            deferred or shed.
+   * @param     raw_header, from_sym_neighbor, is_fresh, deferred_count.
+   * @return    Admission decision.
+   * @note      HELLOs from symmetric neighbors are always admitted as
+   *            they keep the links alive.
+  ********************************************************************/
+  C_OLSR_OVERLOAD_CONTROLLER::E_ADMISSION
+  C_OLSR_OVERLOAD_CONTROLLER::admit(const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header, T_BOOL from_sym_neighbor,
+                                    T_BOOL is_fresh, T_UINT16 deferred_count)
+  {
+    T_BOOL overloaded = is_overloaded();
+    T_BOOL shedding = (m_queue_depth > m_config.shed_queue_depth);
+
+    if((overloaded == true) and (m_tick_overloaded == false))
+      {
+        m_tick_overloaded = true;
+        m_counters.overloaded_ticks++;
+      }
+
+    if(raw_header.msg_type == HELLO_MESSAGE)
+      {
+        if((from_sym_neighbor == false) and (shedding == true))
+          {
+            m_counters.hello_shed++;
+            return SHED_MSG;
+          }
+        m_counters.hello_admitted++;
+        return ADMIT_MSG;
+      }
+
+    if(overloaded == false)
+      {
+        m_counters.tc_admitted++;
+        return ADMIT_MSG;
+      }
+
+    if(is_fresh == false)
+      {
+        m_counters.tc_stale_shed++;
+        return SHED_MSG;
+      }
+
+    if((shedding == true) or (deferred_count >= m_config.max_deferred_msgs))
+      {
+        m_counters.tc_shed++;
+        return SHED_MSG;
+      }
+
+    m_counters.tc_deferred++;
+    return DEFER_MSG;
+  }
+
+  /********************************************************************
+   * @function  allow_forward
+   * @brief     This function checks if a TC can be forwarded.
+   * @param     None.
+   * @return    false while overloaded.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_OVERLOAD_CONTROLLER::allow_forward(void)
+  {
+    if(is_overloaded() == true)
+      {
+        m_counters.tc_forward_shed++;
+        return false;
+      }
+    return true;
+  }
+
+  /********************************************************************
+   * @function  allow_enqueue
+   * @brief     This function checks if a packet can enter the receive
+   *            queue.
+   * @param     queue_depth, from_sym_neighbor.
+   * @return    ENQUEUE_PACKET, EVICT_PACKET or REFUSE_PACKET.
+   * @note      A packet carrying a HELLO of a symmetric neighbor is not
+   *            refused at the maximum depth, it takes the place of a
+   *            queued packet without one, or else of the headroom.
+  ********************************************************************/
+  C_OLSR_OVERLOAD_CONTROLLER::E_ENQUEUE
+  C_OLSR_OVERLOAD_CONTROLLER::allow_enqueue(T_UINT16 queue_depth, T_BOOL from_sym_neighbor)
+  {
+    if(queue_depth < m_config.max_rx_queue_depth)
+      {
+        return ENQUEUE_PACKET;
+      }
+
+    if((from_sym_neighbor == true)
+        and (queue_depth < (m_config.max_rx_queue_depth + m_config.hello_queue_headroom)))
+      {
+        return EVICT_PACKET;
+      }
+
+    m_counters.rx_queue_overflow++;
+    return REFUSE_PACKET;
+  }
+
+  /********************************************************************
+   * @function  count_evicted
+   * @brief     This function counts a queued packet dropped for a
+   *            HELLO of a symmetric neighbor.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_OVERLOAD_CONTROLLER::count_evicted(void)
+  {
+    m_counters.rx_queue_evicted++;
+  }
+
+  /********************************************************************
+   * @function  count_deferred_processed
+   * @brief     This function counts a deferred TC processed after the
+   *            overload.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_OVERLOAD_CONTROLLER::count_deferred_processed(void)
+  {
+    m_counters.tc_deferred_processed++;
+  }
+
+}
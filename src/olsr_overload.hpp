@@ -0,0 +1,154 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_overload.hpp
+ *
+ * Description        :   To store the overload controller of the receive path .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_OVERLOAD_HPP_
+#define OLSR_OVERLOAD_HPP_
+
+#include <chrono>
+#include "olsr_header.hpp"           /* Include file for hearder functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_RX_QUEUE_MAX_DEPTH       256     /* Packets held in the receive queue */
+#define M_RX_QUEUE_DEFER_DEPTH     64      /* Queue depth above which TC processing is deferred */
+#define M_RX_QUEUE_SHED_DEPTH      192     /* Queue depth above which TCs and unknown HELLOs are shed */
+#define M_RX_TICK_CPU_BUDGET_US    5000    /* Receive processing budget of one tick in micro seconds */
+#define M_MAX_DEFERRED_MSGS        128     /* TC messages held for processing after the overload */
+#define M_RX_QUEUE_HELLO_HEADROOM  64      /* Packets held above the maximum depth for HELLOs of symmetric neighbors */
+
+  /**
+   * Thresholds of the overload controller
+   */
+  typedef struct
+  {
+    T_UINT16 max_rx_queue_depth;        /* Packets held in the receive queue */
+    T_UINT16 defer_queue_depth;         /* Queue depth above which TC processing is deferred */
+    T_UINT16 shed_queue_depth;          /* Queue depth above which TCs and unknown HELLOs are shed */
+    T_UINT32 tick_cpu_budget_us;        /* Receive processing budget of one tick */
+    T_UINT16 max_deferred_msgs;         /* TC messages held for processing after the overload */
+    T_UINT16 hello_queue_headroom;      /* Packets held above the maximum depth for HELLOs of symmetric neighbors */
+  }T_OVERLOAD_CONFIG;
+
+  /**
+   * Counters of the overload controller, for operators
+   */
+  typedef struct
+  {
+    T_UINT32 rx_queue_overflow;         /* Packets refused because the receive queue was full */
+    T_UINT32 rx_queue_evicted;          /* Queued packets dropped for a HELLO of a symmetric neighbor */
+    T_UINT32 hello_admitted;            /* HELLOs processed */
+    T_UINT32 hello_shed;                /* HELLOs from non symmetric neighbors dropped */
+    T_UINT32 tc_admitted;               /* TCs processed on arrival */
+    T_UINT32 tc_deferred;               /* TCs held for processing after the overload */
+    T_UINT32 tc_deferred_processed;     /* Deferred TCs processed later */
+    T_UINT32 tc_shed;                   /* Fresh TCs dropped */
+    T_UINT32 tc_stale_shed;             /* TCs not newer than the known ANSN dropped */
+    T_UINT32 tc_forward_shed;           /* TCs not forwarded */
+    T_UINT32 overloaded_ticks;          /* Ticks which crossed a threshold */
+  }T_OVERLOAD_COUNTERS;
+
+  class C_OLSR_OVERLOAD_CONTROLLER
+  {
+
+  public:
+    C_OLSR_OVERLOAD_CONTROLLER();
+
+    ~C_OLSR_OVERLOAD_CONTROLLER();
+
+    /**
+     * Decision taken on a received message
+     */
+    typedef enum
+    {
+      ADMIT_MSG = 0X0,        /* Process the message now */
+      DEFER_MSG = 0X1,        /* Hold the message until the overload is over */
+      SHED_MSG = 0X2          /* Drop the message */
+    }E_ADMISSION;
+
+    /**
+     * Decision taken on a received packet
+     */
+    typedef enum
+    {
+      ENQUEUE_PACKET = 0X0,   /* Queue the packet */
+      EVICT_PACKET = 0X1,     /* Queue the packet in place of one without a HELLO of a symmetric neighbor */
+      REFUSE_PACKET = 0X2     /* Drop the packet */
+    }E_ENQUEUE;
+
+    void begin_tick(T_UINT16 queue_depth);      /* Starts a receive processing tick */
+
+    void end_tick(void);                        /* Ends the receive processing tick */
+
+    T_BOOL is_overloaded(void) const;           /* Checks if a queue or cpu threshold is crossed */
+
+    T_BOOL is_budget_exhausted(void) const;     /* Checks if the cpu budget of the tick is used */
+
+    /* Classifies a message by its type and freshness */
+    E_ADMISSION admit(const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header, T_BOOL from_sym_neighbor,
+                      T_BOOL is_fresh, T_UINT16 deferred_count);
+
+    T_BOOL allow_forward(void);                 /* Checks if a TC can be forwarded */
+
+    /* Classifies a packet by the queue depth and its HELLOs */
+    E_ENQUEUE allow_enqueue(T_UINT16 queue_depth, T_BOOL from_sym_neighbor);
+
+    void count_evicted(void);                   /* Counts a queued packet dropped for a HELLO */
+
+    void count_deferred_processed(void);        /* Counts a deferred TC processed after the overload */
+
+    const T_OVERLOAD_CONFIG&
+    get_config () const
+    {
+      return m_config;
+    }
+
+    void
+    set_config (const T_OVERLOAD_CONFIG& config)
+    {
+      m_config = config;
+    }
+
+    const T_OVERLOAD_COUNTERS&
+    get_counters () const
+    {
+      return m_counters;
+    }
+
+    void reset_counters(void);                  /* Clears the counters */
+
+  private:
+
+    T_OVERLOAD_CONFIG m_config;                 /* Thresholds */
+
+    T_OVERLOAD_COUNTERS m_counters;             /* Counters */
+
+    T_BOOL m_in_tick;                           /* True while a receive tick is running */
+
+    T_UINT16 m_queue_depth;                     /* Queue depth at the start of the tick */
+
+    T_BOOL m_tick_overloaded;                   /* True once the tick is counted as overloaded */
+
+    std::chrono::steady_clock::time_point m_tick_start;     /* Start of the tick */
+  };
+
+}
+
+#endif /* OLSR_OVERLOAD_HPP_ */
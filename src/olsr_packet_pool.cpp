@@ -0,0 +1,117 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_packet_pool.cpp
+ *
+ * Description        :   Implements the pool of packet buffers shared by olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <algorithm>
+#include "olsr_packet_pool.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  C_PACKET_POOL
+   * @brief     This function is the constructor of C_PACKET_POOL.
+   * @param     None.
+   * @return    None.
+   * @note      No buffer is allocated before the first packet.
+  ********************************************************************/
+  C_PACKET_POOL::C_PACKET_POOL()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  ~C_PACKET_POOL
+   * @brief     This function is the destructor of C_PACKET_POOL.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_PACKET_POOL::~C_PACKET_POOL()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  grow
+   * @brief     This function adds a chunk of buffers to the free list.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_PACKET_POOL::grow(void)
+  {
+    m_chunks.push_back(std::unique_ptr<T_POOLED_PACKET[]>(new T_POOLED_PACKET[M_PACKET_POOL_CHUNK_SIZE]));
+
+    T_POOLED_PACKET* chunk = m_chunks.back().get();
+
+    for(T_UINT32 idx = 0; idx < M_PACKET_POOL_CHUNK_SIZE; idx++)
+      {
+        m_free_list.push_back(&chunk[idx]);
+      }
+  }
+
+  /********************************************************************
+   * @function  acquire
+   * @brief     This function copies a packet into a free buffer.
+   * @param     olsr_packet - packet to copy.
+   *            ref_count - number of receivers of the packet.
+   * @return    Buffer holding the packet.
+   * @note      Only the used part of the packet is copied.
+  ********************************************************************/
+  T_POOLED_PACKET* C_PACKET_POOL::acquire(const C_PACKET_HEADER& olsr_packet, T_UINT32 ref_count)
+  {
+    if(m_free_list.empty() == true)
+      {
+        grow();
+      }
+
+    T_POOLED_PACKET* pooled_packet = m_free_list.back();
+    m_free_list.pop_back();
+
+    const T_UINT8* packet_buf = olsr_packet.get_buffer();
+
+    std::copy(packet_buf, packet_buf + olsr_packet.get_packet_length(), pooled_packet->packet.get_buffer());
+    pooled_packet->packet.set_packet_length(olsr_packet.get_packet_length());
+    pooled_packet->packet.set_packet_type(olsr_packet.get_packet_type());
+    pooled_packet->ref_count = ref_count;
+
+    return pooled_packet;
+  }
+
+  /********************************************************************
+   * @function  release
+   * @brief     This function drops one reference of a buffer and
+   *            returns it to the free list after the last one.
+   * @param     pooled_packet.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_PACKET_POOL::release(T_POOLED_PACKET* pooled_packet)
+  {
+    pooled_packet->ref_count--;
+
+    if(pooled_packet->ref_count == 0)
+      {
+        m_free_list.push_back(pooled_packet);
+      }
+  }
+
+}
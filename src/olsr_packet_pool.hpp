@@ -0,0 +1,80 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_packet_pool.hpp
+ *
+ * Description        :   To store the pool of packet buffers shared by olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_PACKET_POOL_HPP_
+#define OLSR_PACKET_POOL_HPP_
+
+#include <memory>
+#include "olsr_header.hpp"           /* Include file for hearder functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_PACKET_POOL_CHUNK_SIZE    256     /* Packet buffers allocated at once when the pool is empty */
+
+  /**
+   * Packet buffer of the pool, shared by all the receivers of a packet
+   */
+  typedef struct
+  {
+    C_PACKET_HEADER packet;             /* Serialised packet */
+    T_UINT32 ref_count;                 /* Receivers still holding the buffer */
+  }T_POOLED_PACKET;
+
+  /**
+   * Recycles packet buffers, memory is taken in chunks and never
+   * returned until the pool is destroyed
+   */
+  class C_PACKET_POOL
+  {
+
+  public:
+    C_PACKET_POOL();
+
+    ~C_PACKET_POOL();
+
+    T_POOLED_PACKET* acquire(const C_PACKET_HEADER& olsr_packet, T_UINT32 ref_count);  /* Copies a packet into a free buffer */
+
+    void release(T_POOLED_PACKET* pooled_packet);   /* Drops one reference, the last one frees the buffer */
+
+    size_t
+    get_allocated_count () const
+    {
+      return m_chunks.size() * M_PACKET_POOL_CHUNK_SIZE;
+    }
+
+    size_t
+    get_free_count () const
+    {
+      return m_free_list.size();
+    }
+
+  private:
+
+    std::vector<std::unique_ptr<T_POOLED_PACKET[]> > m_chunks;     /* Memory of the buffers */
+
+    std::vector<T_POOLED_PACKET*> m_free_list;                      /* Buffers ready for use */
+
+    void grow(void);                    /* Adds a chunk of buffers */
+  };
+
+}
+
+#endif /* OLSR_PACKET_POOL_HPP_ */
@@ -0,0 +1,700 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_parallel_host.cpp
+ *
+ * Description        :   Implements the parallel discrete event emulator of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <algorithm>
+#include <thread>
+#include "olsr_parallel_host.hpp"
+
+namespace ns_olsr2_0
+{
+#define M_FNV_OFFSET_BASIS      0xCBF29CE484222325ULL   /* FNV-1a start value */
+#define M_FNV_PRIME             0x100000001B3ULL        /* FNV-1a multiplier */
+
+  /********************************************************************
+   * @function  delivery_later
+   * @brief     Orders the delivery heap of a partition. Equal times are
+   *            ordered by sender, send order and receiver, which do not
+   *            depend on the partitioning.
+   * @param     delivery_a, delivery_b.
+   * @return    true if delivery_a is handled after delivery_b.
+   * @note      None.
+  ********************************************************************/
+  static inline T_BOOL delivery_later(const T_HOST_DELIVERY& delivery_a, const T_HOST_DELIVERY& delivery_b)
+  {
+    if(delivery_a.deliver_time != delivery_b.deliver_time)
+      {
+        return (delivery_a.deliver_time > delivery_b.deliver_time);
+      }
+    if(delivery_a.sender != delivery_b.sender)
+      {
+        return (delivery_a.sender > delivery_b.sender);
+      }
+    if(delivery_a.sequence != delivery_b.sequence)
+      {
+        return (delivery_a.sequence > delivery_b.sequence);
+      }
+    return (delivery_a.receiver > delivery_b.receiver);
+  }
+
+  /********************************************************************
+   * @function  hash_value
+   * @brief     Adds a value to an FNV-1a hash.
+   * @param     hash, value.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  static inline void hash_value(T_UINT64& hash, T_UINT64 value)
+  {
+    for(T_UINT32 idx = 0; idx < sizeof(value); idx++)
+      {
+        hash ^= (value >> (idx * 8)) & 0xFF;
+        hash *= M_FNV_PRIME;
+      }
+  }
+
+  /********************************************************************
+   * @function  C_SPIN_BARRIER
+   * @brief     This function is the constructor of C_SPIN_BARRIER.
+   * @param     count - number of workers.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_SPIN_BARRIER::C_SPIN_BARRIER(T_UINT32 count) : m_count(count), m_waiting(0), m_phase(0)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  wait
+   * @brief     This function blocks the worker until all the workers
+   *            have reached the barrier.
+   * @param     None.
+   * @return    None.
+   * @note      The acquire/release pair makes the writes of all the
+   *            workers before the barrier visible after it.
+  ********************************************************************/
+  void C_SPIN_BARRIER::wait(void)
+  {
+    T_UINT32 phase = m_phase.load(std::memory_order_relaxed);
+
+    if(m_waiting.fetch_add(1, std::memory_order_acq_rel) == (m_count - 1))
+      {
+        m_waiting.store(0, std::memory_order_relaxed);
+        m_phase.fetch_add(1, std::memory_order_acq_rel);
+        return;
+      }
+
+    while(m_phase.load(std::memory_order_acquire) == phase)
+      {
+        std::this_thread::yield();
+      }
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_PARTITION
+   * @brief     This function is the constructor of C_OLSR_PARTITION.
+   * @param     host, partition_id, start_time.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_PARTITION::C_OLSR_PARTITION(C_OLSR_PARALLEL_HOST* host, T_UINT32 partition_id, Time start_time)
+    : m_host(host), m_partition_id(partition_id), m_clock(start_time)
+  {
+    m_counters = T_HOST_COUNTERS();
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_PARTITION
+   * @brief     This function is the destructor of C_OLSR_PARTITION.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_PARTITION::~C_OLSR_PARTITION()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  push_delivery
+   * @brief     This function adds a packet to the local heap.
+   * @param     delivery.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_PARTITION::push_delivery(const T_HOST_DELIVERY& delivery)
+  {
+    m_deliveries.push_back(delivery);
+    std::push_heap(m_deliveries.begin(), m_deliveries.end(), delivery_later);
+  }
+
+  /********************************************************************
+   * @function  send_packet
+   * @brief     This function queues a packet for every neighbor of the
+   *            sender, locally or towards the neighbor's partition.
+   * @param     sender_address, olsr_packet.
+   * @return    None.
+   * @note      Runs on the worker thread of the sender.
+  ********************************************************************/
+  void C_OLSR_PARTITION::send_packet(const T_NODE_ADDRESS& sender_address, const C_PACKET_HEADER& olsr_packet)
+  {
+    T_UINT32 sender = m_host->find_node(sender_address);
+
+    if((sender == M_HOST_INVALID_NODE) or (m_host->m_links[sender].empty() == true))
+      {
+        return;
+      }
+
+    std::vector<T_VIRTUAL_LINK>& links = m_host->m_links[sender];
+    T_UINT64 sequence = m_host->m_send_sequence[sender]++;
+    Time cur_time = m_clock.now();
+    T_POOLED_PACKET* pooled_packet = NULL;
+
+    for(std::vector<T_VIRTUAL_LINK>::iterator link_iter = links.begin(); link_iter != links.end(); link_iter++)
+      {
+        T_UINT32 dst = m_host->m_node_partition[link_iter->neighbor];
+        Time deliver_time = get_link_deliver_time(*link_iter, sender, sequence, olsr_packet.get_packet_length(), cur_time);
+
+        if(deliver_time < 0)
+          {
+            m_counters.packets_lost++;
+          }
+        else if(dst == m_partition_id)
+          {
+            T_HOST_DELIVERY delivery;
+
+            /* The local receivers share one pooled copy */
+            if(pooled_packet == NULL)
+              {
+                pooled_packet = m_pool.acquire(olsr_packet, 1);
+              }
+            else
+              {
+                pooled_packet->ref_count++;
+              }
+
+            delivery.deliver_time = deliver_time;
+            delivery.sequence = sequence;
+            delivery.sender = sender;
+            delivery.receiver = link_iter->neighbor;
+            delivery.l_in_metric = link_iter->l_in_metric;
+            delivery.packet = pooled_packet;
+
+            push_delivery(delivery);
+          }
+        else
+          {
+            T_REMOTE_DELIVERY remote;
+
+            remote.deliver_time = deliver_time;
+            remote.sequence = sequence;
+            remote.sender = sender;
+            remote.receiver = link_iter->neighbor;
+            remote.l_in_metric = link_iter->l_in_metric;
+            remote.packet = olsr_packet;
+
+            m_host->get_queue(m_partition_id, dst).push(remote);
+          }
+      }
+
+    m_counters.packets_sent++;
+    m_counters.bytes_sent += olsr_packet.get_packet_length();
+  }
+
+  /********************************************************************
+   * @function  drain_incoming
+   * @brief     This function moves the packets sent by the other
+   *            partitions into the local heap.
+   * @param     None.
+   * @return    None.
+   * @note      Called between barriers, when no partition sends.
+  ********************************************************************/
+  void C_OLSR_PARTITION::drain_incoming(void)
+  {
+    T_REMOTE_DELIVERY remote;
+
+    for(T_UINT32 src = 0; src < m_host->m_worker_count; src++)
+      {
+        if(src == m_partition_id)
+          {
+            continue;
+          }
+
+        C_SPSC_QUEUE<T_REMOTE_DELIVERY>& queue = m_host->get_queue(src, m_partition_id);
+
+        while(queue.pop(remote) == true)
+          {
+            T_HOST_DELIVERY delivery;
+
+            delivery.deliver_time = remote.deliver_time;
+            delivery.sequence = remote.sequence;
+            delivery.sender = remote.sender;
+            delivery.receiver = remote.receiver;
+            delivery.l_in_metric = remote.l_in_metric;
+            delivery.packet = m_pool.acquire(remote.packet, 1);
+
+            push_delivery(delivery);
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  get_next_time
+   * @brief     This function returns the time of the next local timer
+   *            or packet.
+   * @param     None.
+   * @return    Time, M_TIME_INFINITE if nothing is pending.
+   * @note      None.
+  ********************************************************************/
+  Time C_OLSR_PARTITION::get_next_time(void)
+  {
+    Time next_delivery = (m_deliveries.empty() == true) ? M_TIME_INFINITE : m_deliveries.front().deliver_time;
+
+    return std::min(m_scheduler.next_deadline(), next_delivery);
+  }
+
+  /********************************************************************
+   * @function  deliver_due
+   * @brief     This function hands the packets due at cur_time to
+   *            their receivers and sends what they forward.
+   * @param     cur_time.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_PARTITION::deliver_due(Time cur_time)
+  {
+    while((m_deliveries.empty() == false) and (m_deliveries.front().deliver_time <= cur_time))
+      {
+        T_HOST_DELIVERY delivery = m_deliveries.front();
+
+        std::pop_heap(m_deliveries.begin(), m_deliveries.end(), delivery_later);
+        m_deliveries.pop_back();
+
+        C_OLSR& receiver = m_host->m_nodes[delivery.receiver];
+
+        receiver.recv_olsr(delivery.packet->packet, m_host->m_nodes[delivery.sender].get_node_addr(),
+                           receiver.get_node_addr(), delivery.l_in_metric);
+        receiver.send_olsr_msg();
+
+        m_pool.release(delivery.packet);
+        m_counters.packets_delivered++;
+      }
+  }
+
+  /********************************************************************
+   * @function  run_window
+   * @brief     This function runs the local events in time order up to
+   *            but excluding window_end.
+   * @param     window_end.
+   * @return    None.
+   * @note      Packets go before timers of the same time, as in
+   *            C_OLSR_HOST.
+  ********************************************************************/
+  void C_OLSR_PARTITION::run_window(Time window_end)
+  {
+    while(true)
+      {
+        Time next_event = get_next_time();
+
+        if(next_event >= window_end)
+          {
+            break;
+          }
+
+        m_clock.advance_to(next_event);
+
+        deliver_due(next_event);
+        m_counters.timers_fired += m_scheduler.run_due(next_event);
+      }
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_PARALLEL_HOST
+   * @brief     This function is the constructor of C_OLSR_PARALLEL_HOST.
+   * @param     worker_count - number of partitions and threads.
+   *            start_time - virtual time of the first event.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_PARALLEL_HOST::C_OLSR_PARALLEL_HOST(T_UINT32 worker_count, Time start_time)
+  {
+    m_worker_count = (worker_count == 0) ? 1 : worker_count;
+    m_cur_time = start_time;
+    m_started = false;
+    m_node_index.assign(M_HOST_ADDRESS_SPACE, M_HOST_INVALID_NODE);
+    m_next_time.assign(m_worker_count, M_TIME_INFINITE);
+
+    for(T_UINT32 idx = 0; idx < m_worker_count; idx++)
+      {
+        m_partitions.push_back(std::unique_ptr<C_OLSR_PARTITION>(new C_OLSR_PARTITION(this, idx, start_time)));
+      }
+
+    for(T_UINT32 idx = 0; idx < (m_worker_count * m_worker_count); idx++)
+      {
+        m_queues.push_back(std::unique_ptr<C_SPSC_QUEUE<T_REMOTE_DELIVERY> >(new C_SPSC_QUEUE<T_REMOTE_DELIVERY>()));
+      }
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_PARALLEL_HOST
+   * @brief     This function is the destructor of C_OLSR_PARALLEL_HOST.
+   * @param     None.
+   * @return    None.
+   * @note      The instances are destroyed before the partitions.
+  ********************************************************************/
+  C_OLSR_PARALLEL_HOST::~C_OLSR_PARALLEL_HOST()
+  {
+    m_nodes.clear();
+  }
+
+  /********************************************************************
+   * @function  add_node
+   * @brief     This function creates an instance, it is initialized by
+   *            the first run.
+   * @param     node_address, inst_type.
+   * @return    Index of the node, M_HOST_INVALID_NODE if the address
+   *            is already used or the emulation has started.
+   * @note      None.
+  ********************************************************************/
+  T_UINT32 C_OLSR_PARALLEL_HOST::add_node(const T_NODE_ADDRESS& node_address, E_OLSR_INSTANCE inst_type)
+  {
+    T_UINT32 key = ((T_UINT32)node_address.net_id << 8) | node_address.node_id;
+
+    if((m_started == true) or (m_node_index[key] != M_HOST_INVALID_NODE))
+      {
+        return M_HOST_INVALID_NODE;
+      }
+
+    T_UINT32 node_idx = m_nodes.size();
+
+    m_nodes.emplace_back();
+    m_nodes.back().set_node_addr(node_address);
+    m_node_instance.push_back(inst_type);
+    m_links.emplace_back();
+    m_send_sequence.push_back(0);
+    m_node_index[key] = node_idx;
+
+    return node_idx;
+  }
+
+  /********************************************************************
+   * @function  find_node
+   * @brief     This function returns the index of a node address.
+   * @param     node_address.
+   * @return    Index, M_HOST_INVALID_NODE if unknown.
+   * @note      None.
+  ********************************************************************/
+  T_UINT32 C_OLSR_PARALLEL_HOST::find_node(const T_NODE_ADDRESS& node_address) const
+  {
+    return m_node_index[((T_UINT32)node_address.net_id << 8) | node_address.node_id];
+  }
+
+  /********************************************************************
+   * @function  add_link
+   * @brief     This function connects two nodes in both directions.
+   * @param     node_a, node_b, delay, l_in_metric, loss_ratio, bandwidth.
+   * @return    None.
+   * @note      The delay is at least one milli second, it bounds the
+   *            length of the synchronization windows.
+  ********************************************************************/
+  void C_OLSR_PARALLEL_HOST::add_link(T_UINT32 node_a, T_UINT32 node_b, Time delay, float l_in_metric,
+                             float loss_ratio, T_UINT32 bandwidth)
+  {
+    T_UINT32 ends[2][2] = {{node_a, node_b}, {node_b, node_a}};
+
+    for(T_UINT32 dir = 0; dir < 2; dir++)
+      {
+        std::vector<T_VIRTUAL_LINK>& links = m_links[ends[dir][0]];
+        std::vector<T_VIRTUAL_LINK>::iterator link_iter = links.begin();
+
+        while((link_iter != links.end()) and (link_iter->neighbor != ends[dir][1]))
+          {
+            link_iter++;
+          }
+
+        if(link_iter == links.end())
+          {
+            links.push_back(T_VIRTUAL_LINK());
+            link_iter = links.end() - 1;
+            link_iter->neighbor = ends[dir][1];
+            link_iter->busy_until = 0;
+          }
+
+        link_iter->delay = (delay < 1) ? 1 : delay;
+        link_iter->l_in_metric = l_in_metric;
+        link_iter->loss_ratio = loss_ratio;
+        link_iter->bandwidth = bandwidth;
+      }
+  }
+
+  /********************************************************************
+   * @function  remove_link
+   * @brief     This function disconnects two nodes in both directions.
+   * @param     node_a, node_b.
+   * @return    None.
+   * @note      Packets already in flight are still delivered.
+  ********************************************************************/
+  void C_OLSR_PARALLEL_HOST::remove_link(T_UINT32 node_a, T_UINT32 node_b)
+  {
+    T_UINT32 ends[2][2] = {{node_a, node_b}, {node_b, node_a}};
+
+    for(T_UINT32 dir = 0; dir < 2; dir++)
+      {
+        std::vector<T_VIRTUAL_LINK>& links = m_links[ends[dir][0]];
+
+        for(std::vector<T_VIRTUAL_LINK>::iterator link_iter = links.begin(); link_iter != links.end(); link_iter++)
+          {
+            if(link_iter->neighbor == ends[dir][1])
+              {
+                links.erase(link_iter);
+                break;
+              }
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  has_link
+   * @brief     This function tells whether node_a reaches node_b.
+   * @param     node_a, node_b.
+   * @return    true if a link joins them.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_PARALLEL_HOST::has_link(T_UINT32 node_a, T_UINT32 node_b) const
+  {
+    for(std::vector<T_VIRTUAL_LINK>::const_iterator link_iter = m_links[node_a].begin();
+        link_iter != m_links[node_a].end(); link_iter++)
+      {
+        if(link_iter->neighbor == node_b)
+          {
+            return true;
+          }
+      }
+    return false;
+  }
+
+  /********************************************************************
+   * @function  start
+   * @brief     This function splits the nodes in contiguous blocks,
+   *            one per partition, and initializes them on the clock and
+   *            scheduler of their partition.
+   * @param     None.
+   * @return    None.
+   * @note      A leader instance is indexed by the address it takes
+   *            during init.
+  ********************************************************************/
+  void C_OLSR_PARALLEL_HOST::start(void)
+  {
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+    T_UINT32 node_count = m_nodes.size();
+
+    m_node_partition.resize(node_count);
+
+    for(T_UINT32 node_idx = 0; node_idx < node_count; node_idx++)
+      {
+        T_UINT32 partition_id = ((T_UINT64)node_idx * m_worker_count) / node_count;
+        C_OLSR_PARTITION& partition = *m_partitions[partition_id];
+        C_OLSR& node = m_nodes[node_idx];
+        T_NODE_ADDRESS node_address = node.get_node_addr();
+
+        m_node_partition[node_idx] = partition_id;
+
+        node.set_scheduler(&partition.get_scheduler());
+        node.set_transport(&partition);
+
+        set_olsr_clock(&partition.get_clock());
+        node.init(m_node_instance[node_idx]);
+
+        m_node_index[((T_UINT32)node_address.net_id << 8) | node_address.node_id] = M_HOST_INVALID_NODE;
+        m_node_index[((T_UINT32)node.get_node_addr().net_id << 8) | node.get_node_addr().node_id] = node_idx;
+      }
+
+    set_olsr_clock(prev_clock);
+    m_started = true;
+  }
+
+  /********************************************************************
+   * @function  get_lookahead
+   * @brief     This function returns the smallest delay of the links
+   *            joining two partitions.
+   * @param     None.
+   * @return    Lookahead, M_TIME_INFINITE without such link.
+   * @note      None.
+  ********************************************************************/
+  Time C_OLSR_PARALLEL_HOST::get_lookahead(void) const
+  {
+    Time lookahead = M_TIME_INFINITE;
+
+    for(T_UINT32 node_idx = 0; node_idx < m_links.size(); node_idx++)
+      {
+        for(std::vector<T_VIRTUAL_LINK>::const_iterator link_iter = m_links[node_idx].begin();
+            link_iter != m_links[node_idx].end(); link_iter++)
+          {
+            if(m_node_partition[node_idx] != m_node_partition[link_iter->neighbor])
+              {
+                lookahead = std::min(lookahead, link_iter->delay);
+              }
+          }
+      }
+
+    return lookahead;
+  }
+
+  /********************************************************************
+   * @function  run_worker
+   * @brief     This function is the loop of a worker thread. Every
+   *            window starts at the earliest event of all partitions
+   *            and lasts the lookahead.
+   * @param     partition_id, end_time, lookahead, barrier.
+   * @return    None.
+   * @note      All the workers compute the same windows from the
+   *            published next times, so they leave the loop together.
+  ********************************************************************/
+  void C_OLSR_PARALLEL_HOST::run_worker(T_UINT32 partition_id, Time end_time, Time lookahead, C_SPIN_BARRIER* barrier)
+  {
+    C_OLSR_PARTITION& partition = *m_partitions[partition_id];
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+
+    set_olsr_clock(&partition.get_clock());
+
+    while(true)
+      {
+        partition.drain_incoming();
+        m_next_time[partition_id] = partition.get_next_time();
+
+        barrier->wait();
+
+        Time window_start = *std::min_element(m_next_time.begin(), m_next_time.end());
+
+        if(window_start > end_time)
+          {
+            break;
+          }
+
+        Time window_end = (lookahead > (end_time - window_start)) ? (end_time + 1) : (window_start + lookahead);
+
+        partition.run_window(window_end);
+
+        barrier->wait();
+      }
+
+    partition.get_clock().advance_to(end_time);
+
+    set_olsr_clock(prev_clock);
+  }
+
+  /********************************************************************
+   * @function  run_until
+   * @brief     This function runs all the partitions in parallel up to
+   *            end_time.
+   * @param     end_time.
+   * @return    None.
+   * @note      Links may be changed between two runs.
+  ********************************************************************/
+  void C_OLSR_PARALLEL_HOST::run_until(Time end_time)
+  {
+    if(m_started == false)
+      {
+        start();
+      }
+
+    if(end_time <= m_cur_time)
+      {
+        return;
+      }
+
+    Time lookahead = get_lookahead();
+    C_SPIN_BARRIER barrier(m_worker_count);
+    std::vector<std::thread> workers;
+
+    for(T_UINT32 partition_id = 1; partition_id < m_worker_count; partition_id++)
+      {
+        workers.emplace_back(&C_OLSR_PARALLEL_HOST::run_worker, this, partition_id, end_time, lookahead, &barrier);
+      }
+
+    run_worker(0, end_time, lookahead, &barrier);
+
+    for(std::vector<std::thread>::iterator worker_iter = workers.begin(); worker_iter != workers.end(); worker_iter++)
+      {
+        worker_iter->join();
+      }
+
+    m_cur_time = end_time;
+  }
+
+  /********************************************************************
+   * @function  get_counters
+   * @brief     This function sums the counters of the partitions.
+   * @param     None.
+   * @return    Counters.
+   * @note      Not to be called during a run.
+  ********************************************************************/
+  T_HOST_COUNTERS C_OLSR_PARALLEL_HOST::get_counters(void) const
+  {
+    T_HOST_COUNTERS counters = T_HOST_COUNTERS();
+
+    for(T_UINT32 idx = 0; idx < m_worker_count; idx++)
+      {
+        const T_HOST_COUNTERS& part_counters = m_partitions[idx]->get_counters();
+
+        counters.packets_sent += part_counters.packets_sent;
+        counters.bytes_sent += part_counters.bytes_sent;
+        counters.packets_delivered += part_counters.packets_delivered;
+        counters.packets_lost += part_counters.packets_lost;
+        counters.timers_fired += part_counters.timers_fired;
+      }
+
+    return counters;
+  }
+
+  /********************************************************************
+   * @function  get_state_digest
+   * @brief     This function hashes the link set and the send count of
+   *            every node, in node order.
+   * @param     None.
+   * @return    Digest.
+   * @note      Two runs of the same scenario give the same digest
+   *            whatever their worker count.
+  ********************************************************************/
+  T_UINT64 C_OLSR_PARALLEL_HOST::get_state_digest(void) const
+  {
+    T_UINT64 hash = M_FNV_OFFSET_BASIS;
+
+    for(T_UINT32 node_idx = 0; node_idx < m_nodes.size(); node_idx++)
+      {
+        const LinkSet& links = m_nodes[node_idx].getState().get_links();
+
+        hash_value(hash, m_send_sequence[node_idx]);
+        hash_value(hash, links.size());
+
+        for(LinkSet::const_iterator link_iter = links.begin(); link_iter != links.end(); link_iter++)
+          {
+            hash_value(hash, ((T_UINT64)link_iter->l_neighbor_iface_addr.net_id << 8) | link_iter->l_neighbor_iface_addr.node_id);
+            hash_value(hash, link_iter->l_status);
+            hash_value(hash, link_iter->l_time.get_raw());
+            hash_value(hash, link_iter->l_sym_time.get_raw());
+          }
+      }
+
+    return hash;
+  }
+
+}
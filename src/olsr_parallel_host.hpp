@@ -0,0 +1,229 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_parallel_host.hpp
+ *
+ * Description        :   To store the parallel discrete event emulator of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_PARALLEL_HOST_HPP_
+#define OLSR_PARALLEL_HOST_HPP_
+
+#include <memory>
+#include "olsr_host.hpp"             /* Include file for the virtual links */
+#include "olsr_spsc_queue.hpp"       /* Include file for the cross partition queues */
+
+namespace ns_olsr2_0
+{
+  class C_OLSR_PARALLEL_HOST;
+
+  /**
+   * Packet crossing from one partition to another, carried by value
+   * as the pools are owned by their partition
+   */
+  typedef struct
+  {
+    Time deliver_time;                  /* Time at which the packet reaches the receiver */
+    T_UINT64 sequence;                  /* Send order of the sender */
+    T_UINT32 sender;                    /* Index of the sending node */
+    T_UINT32 receiver;                  /* Index of the receiving node */
+    float l_in_metric;                  /* In link metric of the link */
+    C_PACKET_HEADER packet;             /* Serialised packet */
+  }T_REMOTE_DELIVERY;
+
+  /**
+   * Sense reversing barrier, the workers spin instead of sleeping as
+   * the windows are short
+   */
+  class C_SPIN_BARRIER
+  {
+
+  public:
+    C_SPIN_BARRIER(T_UINT32 count);
+
+    void wait(void);                    /* Returns once all the workers have called it */
+
+  private:
+
+    T_UINT32 m_count;                   /* Workers taking part */
+
+    std::atomic<T_UINT32> m_waiting;    /* Workers arrived in the current phase */
+
+    std::atomic<T_UINT32> m_phase;      /* Incremented when the last worker arrives */
+  };
+
+  /**
+   * Nodes run by one worker thread, with their own clock, scheduler,
+   * packet pool and queue of packets in flight
+   */
+  class C_OLSR_PARTITION : public C_OLSR_TRANSPORT
+  {
+
+  public:
+    C_OLSR_PARTITION(C_OLSR_PARALLEL_HOST* host, T_UINT32 partition_id, Time start_time);
+
+    ~C_OLSR_PARTITION();
+
+    void send_packet(const T_NODE_ADDRESS& sender_address, const C_PACKET_HEADER& olsr_packet);
+
+    void drain_incoming(void);          /* Moves the packets sent by the other partitions to the local queue */
+
+    Time get_next_time(void);           /* Returns the time of the next local event */
+
+    void run_window(Time window_end);   /* Runs the local events before window_end */
+
+    C_VIRTUAL_CLOCK&
+    get_clock ()
+    {
+      return m_clock;
+    }
+
+    C_OLSR_SCHEDULER&
+    get_scheduler ()
+    {
+      return m_scheduler;
+    }
+
+    const T_HOST_COUNTERS&
+    get_counters () const
+    {
+      return m_counters;
+    }
+
+  private:
+
+    C_OLSR_PARALLEL_HOST* m_host;       /* Emulator owning the partition */
+
+    T_UINT32 m_partition_id;            /* Index of the partition */
+
+    C_VIRTUAL_CLOCK m_clock;            /* Clock of the partition nodes */
+
+    C_OLSR_SCHEDULER m_scheduler;       /* Timers of the partition nodes */
+
+    C_PACKET_POOL m_pool;               /* Buffers of the local packets in flight */
+
+    std::vector<T_HOST_DELIVERY> m_deliveries;     /* Binary min heap of the local packets in flight */
+
+    T_HOST_COUNTERS m_counters;
+
+    void push_delivery(const T_HOST_DELIVERY& delivery);
+
+    void deliver_due(Time cur_time);    /* Hands the packets due at cur_time to their receivers */
+  };
+
+  /**
+   * Parallel discrete event emulator. Nodes are split in contiguous
+   * blocks across worker threads which advance in windows as long as
+   * the smallest link delay between partitions, so that no packet sent
+   * in a window is due in the same window. Packets between partitions
+   * go through lock free queues and events with equal times are ordered
+   * by node and send order, so a run gives the same result for any
+   * number of workers.
+   */
+  class C_OLSR_PARALLEL_HOST
+  {
+
+  public:
+    C_OLSR_PARALLEL_HOST(T_UINT32 worker_count, Time start_time = 0);
+
+    ~C_OLSR_PARALLEL_HOST();
+
+    T_UINT32 add_node(const T_NODE_ADDRESS& node_address, E_OLSR_INSTANCE inst_type);   /* Creates an instance, before the first run */
+
+    /* Connects two nodes both ways */
+    void add_link(T_UINT32 node_a, T_UINT32 node_b, Time delay = M_HOST_DEFAULT_LINK_DELAY, float l_in_metric = 1.0,
+                  float loss_ratio = 0, T_UINT32 bandwidth = 0);
+
+    T_BOOL has_link(T_UINT32 node_a, T_UINT32 node_b) const;   /* Tells whether node_a reaches node_b */
+
+    void remove_link(T_UINT32 node_a, T_UINT32 node_b);     /* Disconnects two nodes both ways */
+
+    void run_until(Time end_time);      /* Runs all the partitions up to end_time */
+
+    T_UINT32 find_node(const T_NODE_ADDRESS& node_address) const;  /* Returns the index of an address */
+
+    T_HOST_COUNTERS get_counters(void) const;     /* Sums the counters of the partitions */
+
+    T_UINT64 get_state_digest(void) const;        /* Hash of the link sets, equal for runs with any worker count */
+
+    C_OLSR&
+    get_node (T_UINT32 node_idx)
+    {
+      return m_nodes[node_idx];
+    }
+
+    T_UINT32
+    get_node_count () const
+    {
+      return m_nodes.size();
+    }
+
+    T_UINT32
+    get_worker_count () const
+    {
+      return m_worker_count;
+    }
+
+    Time
+    get_time () const
+    {
+      return m_cur_time;
+    }
+
+  private:
+
+    friend class C_OLSR_PARTITION;
+
+    T_UINT32 m_worker_count;            /* Worker threads, one per partition */
+
+    Time m_cur_time;                    /* Time reached by the last run */
+
+    T_BOOL m_started;                   /* Instances initialized and partitioned */
+
+    std::deque<C_OLSR> m_nodes;         /* Instances, never moved once created */
+
+    std::vector<E_OLSR_INSTANCE> m_node_instance;  /* Instance type given to init */
+
+    std::vector<std::vector<T_VIRTUAL_LINK> > m_links;     /* Virtual links of each node */
+
+    std::vector<T_UINT32> m_node_index; /* Node index of each packed address */
+
+    std::vector<T_UINT32> m_node_partition;        /* Partition of each node */
+
+    std::vector<T_UINT64> m_send_sequence;         /* Packets sent by each node, written by its partition only */
+
+    std::vector<std::unique_ptr<C_OLSR_PARTITION> > m_partitions;
+
+    std::vector<std::unique_ptr<C_SPSC_QUEUE<T_REMOTE_DELIVERY> > > m_queues;  /* Queue from partition src to dst at src * count + dst */
+
+    std::vector<Time> m_next_time;      /* Next event of each partition, published between barriers */
+
+    void start(void);                   /* Partitions and initializes the instances */
+
+    Time get_lookahead(void) const;     /* Smallest delay of a link between partitions */
+
+    void run_worker(T_UINT32 partition_id, Time end_time, Time lookahead, C_SPIN_BARRIER* barrier);
+
+    C_SPSC_QUEUE<T_REMOTE_DELIVERY>&
+    get_queue (T_UINT32 src, T_UINT32 dst)
+    {
+      return *m_queues[(src * m_worker_count) + dst];
+    }
+  };
+
+}
+
+#endif /* OLSR_PARALLEL_HOST_HPP_ */
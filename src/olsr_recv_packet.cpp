@@ -6,6 +6,7 @@
  */
 
 #include <iostream>
+#include <algorithm>
 
 #include "olsr.hpp"
 
@@ -23,106 +24,377 @@ namespace ns_olsr2_0
    * @note      None.
    ********************************************************************/
   void
-  C_OLSR::recv_olsr (const C_PACKET_HEADER olsr_packet, T_NODE_ADDRESS& sender_address,
-                     T_NODE_ADDRESS& receiver_address, float l_in_metric)
+  C_OLSR::recv_olsr (const C_PACKET_HEADER& olsr_packet, const T_NODE_ADDRESS& sender_address,
+                     const T_NODE_ADDRESS& receiver_address, float l_in_metric)
   {
-    /* TBD Deserializarion */
+    M_PHASE_TIMER (RECV_OLSR_PHASE);
 
     if (receiver_address == m_node_address)
       {
-        const C_MESSAGE_HEADER::OlsrMsgList olsr_msg_list;
-        for (C_MESSAGE_HEADER::OlsrMsgList::const_iterator list_iter = olsr_msg_list.begin ();
-            list_iter != olsr_msg_list.end (); list_iter++)
+        const T_UINT8* packet_buf = olsr_packet.get_buffer ();
+        T_UINT16 packet_len = olsr_packet.get_packet_length ();
+        T_UINT16 offset = 0;
+
+        while (offset < packet_len)
           {
-            const C_MESSAGE_HEADER &message_header = *list_iter;
+            const T_UINT8* msg_buf = packet_buf + offset;
+            C_MESSAGE_HEADER::T_RAW_MSG_HEADER raw_header;
+
+            if (C_MESSAGE_HEADER::peek_header (msg_buf, packet_len - offset, raw_header) == false)
+              {
+                break;
+              }
+            offset += raw_header.msg_len;
 
-            if(check_message_validity(message_header) == true)
+            C_OLSR_METRICS::count ((raw_header.msg_type == TC_MESSAGE) ? RX_TC_COUNTER : RX_HELLO_COUNTER);
+            M_TRACE_INSTANT ((raw_header.msg_type == TC_MESSAGE) ? "tc_rx" : "hello_rx", m_node_address, raw_header.orig_addr);
+
+            /* Duplicates, own messages and expired TTLs are dropped before the address blocks are decoded */
+            if (check_message_validity (raw_header) == true)
               {
                 continue;
               }
 
-            T_PROCESSED_MSG_TUPLE* processed_tuple = this->m_state.find_processed_msg_tuple (
-                message_header.get_originator_address (), message_header.get_message_sequence_number ());
+            T_BOOL from_sym_neighbor = ((raw_header.msg_type == HELLO_MESSAGE)
+                and (m_state.find_sym_neighbour_tuple (raw_header.orig_addr) != NULL));
 
-            //T_FORWARDED_MSG_TUPLE *forwarded_tuple = this->m_state.find_forwarded_msg_tuple (
-            //message_header.get_originator_address (), message_header.get_message_sequence_number ());
+            T_BOOL is_fresh = ((raw_header.msg_type != TC_MESSAGE) or (check_tc_freshness (msg_buf, raw_header) == true));
 
-            if (processed_tuple == NULL)
+            switch (m_overload.admit (raw_header, from_sym_neighbor, is_fresh, m_deferred_msgs.size ()))
               {
-                switch (message_header.get_message_type ())
-                  {
-                  case HELLO_MESSAGE:
-                    this->process_hello (message_header, sender_address, l_in_metric);
-                    break;
+              case C_OLSR_OVERLOAD_CONTROLLER::ADMIT_MSG:
+                process_raw_message (msg_buf, raw_header, sender_address, l_in_metric);
+                break;
 
-                  case TC_MESSAGE:
-                    this->process_tc (message_header, sender_address);
-                    forward_default (message_header);
-                    break;
+              case C_OLSR_OVERLOAD_CONTROLLER::DEFER_MSG:
+                defer_raw_message (msg_buf, raw_header, sender_address, l_in_metric);
+                break;
 
-                  default:
-                    break;
+              default:
+                break;
+              }
 
-                  }
-                T_PROCESSED_MSG_TUPLE new_processed_msg_tuple = create_processed_msg_tuple(message_header);
+          }
 
-                m_state.insert_processed_msg_tuple(new_processed_msg_tuple);
+        schedule_expiry_timer ();
 
-              }
-            else
-            {
-                processed_tuple->p_time = get_cur_time() + message_header.get_validity_time();
+        publish_set_sizes ();
 
-            }
+        serve_state_snapshot ();
+      }
+  }
 
+  /********************************************************************
+   * @function  process_raw_message
+   * @brief     This function decodes a received message and processes
+   *            it according to its type.
+   * @param     msg_buf, raw_header, sender_address, l_in_metric.
+   * @return    None.
+   * @note      A recomputation is requested only for a message which
+   *            changed the neighborhood or the topology.
+   ********************************************************************/
+  void
+  C_OLSR::process_raw_message (const T_UINT8* msg_buf, const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header,
+                               const T_NODE_ADDRESS& sender_address, float l_in_metric)
+  {
+    C_MESSAGE_HEADER message_header;
+
+    if (message_header.deserialize (msg_buf, raw_header.msg_len) == false)
+      {
+        return;
+      }
+
+    switch (message_header.get_message_type ())
+      {
+      case HELLO_MESSAGE:
+        if (this->process_hello (message_header, sender_address, l_in_metric) == true)
+          {
+            request_recomputation (true, true);
           }
 
-        routing_table_computation ();
+        /* A new selector or a change of its metrics is advertised by the next TC */
+        note_advertised_churn ();
+        break;
+
+      case TC_MESSAGE:
+        if (this->process_tc (message_header, sender_address) == true)
+          {
+            request_recomputation (false, true);
+            note_churn (false, true);
+          }
+        forward_default (message_header, sender_address);
+        break;
+
+      default:
+        break;
 
       }
+    T_PROCESSED_MSG_TUPLE new_processed_msg_tuple = create_processed_msg_tuple(message_header);
+
+    m_state.insert_processed_msg_tuple(new_processed_msg_tuple);
   }
 
   /********************************************************************
-   * @function  process_hello
-   * @brief     This function processes OLSR hello message
-   *            received from neighbor nodes.
+   * @function  check_tc_freshness
+   * @brief     This function checks if a received TC carries an ANSN
+   *            newer than the one known for its originator.
+   * @param     msg_buf, raw_header.
+   * @return    true if the TC is fresh.
+   * @note      Only the ANSN is read from the buffer.
+   ********************************************************************/
+  T_BOOL
+  C_OLSR::check_tc_freshness (const T_UINT8* msg_buf, const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header)
+  {
+    T_UINT16 ansn;
+
+    if (C_MESSAGE_HEADER::peek_tc_ansn (msg_buf, raw_header, ansn) == false)
+      {
+        return false;
+      }
+
+    const T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab = m_state.find_advertising_remote_router_tuple (raw_header.orig_addr);
+
+    return ((slab == NULL) or (is_seq_num_newer (ansn, slab->ar_seq_number) == true));
+  }
+
+  /********************************************************************
+   * @function  check_sym_neighbor_hello
+   * @brief     This function checks if a packet carries a HELLO of a
+   *            symmetric neighbor.
+   * @param     olsr_packet.
+   * @return    true if one of its messages is such a HELLO.
+   * @note      Only the message headers are peeked, as in recv_olsr.
+   ********************************************************************/
+  T_BOOL
+  C_OLSR::check_sym_neighbor_hello (const C_PACKET_HEADER& olsr_packet)
+  {
+    const T_UINT8* packet_buf = olsr_packet.get_buffer ();
+    T_UINT16 packet_len = olsr_packet.get_packet_length ();
+    T_UINT16 offset = 0;
+
+    while (offset < packet_len)
+      {
+        C_MESSAGE_HEADER::T_RAW_MSG_HEADER raw_header;
+
+        if (C_MESSAGE_HEADER::peek_header (packet_buf + offset, packet_len - offset, raw_header) == false)
+          {
+            break;
+          }
+        offset += raw_header.msg_len;
+
+        if ((raw_header.msg_type == HELLO_MESSAGE)
+            and (m_state.find_sym_neighbour_tuple (raw_header.orig_addr) != NULL))
+          {
+            return true;
+          }
+      }
+    return false;
+  }
+
+  /********************************************************************
+   * @function  evict_rx_packet
+   * @brief     This function drops the newest queued packet without a
+   *            HELLO of a symmetric neighbor.
    * @param     None.
+   * @return    false if every queued packet carries such a HELLO.
+   * @note      None.
+   ********************************************************************/
+  T_BOOL
+  C_OLSR::evict_rx_packet (void)
+  {
+    for (size_t idx = m_rx_queue.size (); idx > 0; idx--)
+      {
+        if (check_sym_neighbor_hello (m_rx_queue[idx - 1].packet) == false)
+          {
+            m_rx_queue.erase (m_rx_queue.begin () + (idx - 1));
+            m_overload.count_evicted ();
+            return true;
+          }
+      }
+    return false;
+  }
+
+  /********************************************************************
+   * @function  enqueue_olsr_packet
+   * @brief     This function queues a received packet for the next
+   *            receive tick.
+   * @param     olsr_packet, sender_address, receiver_address, l_in_metric.
+   * @return    false if the receive queue is full.
+   * @note      The packet is classified before it is queued, so that
+   *            the HELLOs of the symmetric neighbors survive a full
+   *            queue.
+   ********************************************************************/
+  T_BOOL
+  C_OLSR::enqueue_olsr_packet (const C_PACKET_HEADER& olsr_packet, const T_NODE_ADDRESS& sender_address,
+                               const T_NODE_ADDRESS& receiver_address, float l_in_metric)
+  {
+    switch (m_overload.allow_enqueue (m_rx_queue.size (), check_sym_neighbor_hello (olsr_packet)))
+      {
+      case C_OLSR_OVERLOAD_CONTROLLER::ENQUEUE_PACKET:
+        break;
+
+      case C_OLSR_OVERLOAD_CONTROLLER::EVICT_PACKET:
+        /* Without a packet to evict the HELLO takes the headroom */
+        evict_rx_packet ();
+        break;
+
+      default:
+        return false;
+      }
+
+    m_rx_queue.push_back (T_RX_PACKET ());
+
+    T_RX_PACKET &rx_packet = m_rx_queue.back ();
+    rx_packet.packet = olsr_packet;
+    rx_packet.sender_address = sender_address;
+    rx_packet.receiver_address = receiver_address;
+    rx_packet.l_in_metric = l_in_metric;
+
+    return true;
+  }
+
+  /********************************************************************
+   * @function  process_rx_queue
+   * @brief     This function processes the queued packets and then the
+   *            deferred TCs, within the overload thresholds.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+   ********************************************************************/
+  void
+  C_OLSR::process_rx_queue (void)
+  {
+    m_overload.begin_tick (m_rx_queue.size ());
+
+    for (size_t idx = 0; idx < m_rx_queue.size (); idx++)
+      {
+        T_RX_PACKET &rx_packet = m_rx_queue[idx];
+
+        recv_olsr (rx_packet.packet, rx_packet.sender_address, rx_packet.receiver_address, rx_packet.l_in_metric);
+      }
+
+    m_rx_queue.clear ();
+
+    process_deferred_msgs ();
+
+    m_overload.end_tick ();
+
+    /* Forwarded messages leave in as few packets as possible */
+    send_olsr_msg ();
+  }
+
+  /********************************************************************
+   * @function  defer_raw_message
+   * @brief     This function holds a TC until the overload is over.
+   * @param     msg_buf, raw_header, sender_address, l_in_metric.
    * @return    None.
    * @note      None.
    ********************************************************************/
   void
+  C_OLSR::defer_raw_message (const T_UINT8* msg_buf, const C_MESSAGE_HEADER::T_RAW_MSG_HEADER& raw_header,
+                             const T_NODE_ADDRESS& sender_address, float l_in_metric)
+  {
+    m_deferred_msgs.push_back (T_RX_PACKET ());
+
+    T_RX_PACKET &deferred_msg = m_deferred_msgs.back ();
+    std::copy (msg_buf, msg_buf + raw_header.msg_len, deferred_msg.packet.get_buffer ());
+    deferred_msg.packet.set_packet_length (raw_header.msg_len);
+    deferred_msg.sender_address = sender_address;
+    deferred_msg.receiver_address = m_node_address;
+    deferred_msg.l_in_metric = l_in_metric;
+  }
+
+  /********************************************************************
+   * @function  process_deferred_msgs
+   * @brief     This function processes the deferred TCs while the cpu
+   *            budget of the tick allows it.
+   * @param     None.
+   * @return    None.
+   * @note      A deferred TC is checked again as a copy of it may have
+   *            been processed meanwhile.
+   ********************************************************************/
+  void
+  C_OLSR::process_deferred_msgs (void)
+  {
+    T_BOOL processed = false;
+    size_t idx = 0;
+
+    for (; (idx < m_deferred_msgs.size ()) and (m_overload.is_budget_exhausted () == false); idx++)
+      {
+        T_RX_PACKET &deferred_msg = m_deferred_msgs[idx];
+        const T_UINT8* msg_buf = deferred_msg.packet.get_buffer ();
+        C_MESSAGE_HEADER::T_RAW_MSG_HEADER raw_header;
+
+        if ((C_MESSAGE_HEADER::peek_header (msg_buf, deferred_msg.packet.get_packet_length (), raw_header) == true)
+            and (check_message_validity (raw_header) == false)
+            and (check_tc_freshness (msg_buf, raw_header) == true))
+          {
+            process_raw_message (msg_buf, raw_header, deferred_msg.sender_address, deferred_msg.l_in_metric);
+            m_overload.count_deferred_processed ();
+            processed = true;
+          }
+      }
+
+    m_deferred_msgs.erase (m_deferred_msgs.begin (), m_deferred_msgs.begin () + idx);
+
+    if (processed == true)
+      {
+        schedule_expiry_timer ();
+      }
+  }
+
+  /********************************************************************
+   * @function  process_hello
+   * @brief     This function processes OLSR hello message
+   *            received from neighbor nodes.
+   * @param     None.
+   * @return    true if the neighborhood changed.
+   * @note      A HELLO which only refreshes the validity times changes
+   *            neither the MPRs nor the routes.
+   ********************************************************************/
+  T_BOOL
   C_OLSR::process_hello (const C_MESSAGE_HEADER& msg_header, const T_NODE_ADDRESS& sender_iface, float l_in_metric)
   {
+    T_BOOL changed = false;
+
     if (sender_iface == msg_header.get_originator_address ())
       {
         const C_MESSAGE_HEADER::T_HELLO &hello_msg = msg_header.get_hello ();
 
-        link_sensing (msg_header, hello_msg, sender_iface, l_in_metric);
+        changed = link_sensing (msg_header, hello_msg, sender_iface, l_in_metric);
 
         populate_two_hop_set();
 
-        mpr_computation();
-
       }
 
+    return changed;
   }
 
   /********************************************************************
    * @function  link_sensing
    * @brief     This function senses link from neighbor and processes it
    * @param     None.
-   * @return    None.
-   * @note      None.
+   * @return    true if the link or the neighbor tuple changed other than
+   *            by its validity times.
+   * @note      The link becomes symmetric when the neighbor lists this
+   *            node as heard or symmetric, the neighbor tuple follows
+   *            the link tuple.
    ********************************************************************/
-  void
+  T_BOOL
   C_OLSR::link_sensing (const C_MESSAGE_HEADER& message_header, const C_MESSAGE_HEADER::T_HELLO& hello_message,
                         const T_NODE_ADDRESS& sender_iface_addr, float l_in_metric)
   {
+    M_PHASE_TIMER (LINK_SENSING_PHASE);
 
     Time cur_time = get_cur_time ();
-    T_BOOL link_created = false, link_updated = false;
+    Time validity = message_header.get_validity_time ();
+    T_BOOL link_created = false;
+    T_BOOL mpr_selector = false, flooding_mpr_selector = false;
 
-    OLSR_ASSERT (message_header.get_validity_time () > cur_time);
+    if (validity == 0)
+      {
+        return false;
+      }
 
     T_LINK_TUPLE* link_tuple = m_state.find_link_tuple (sender_iface_addr);
 
@@ -130,22 +402,38 @@ namespace ns_olsr2_0
       {
         T_LINK_TUPLE new_link_tuple = create_new_link_tuple(message_header, cur_time, l_in_metric);
 
-        link_tuple = &m_state.insert_link_tuple (new_link_tuple);
+        link_tuple = m_state.insert_link_tuple (new_link_tuple);
+
+        if (link_tuple == NULL)
+          {
+            return false;
+          }
 
         link_created = true;
 
       }
-    else
-      {
-        link_updated = true;
-      }
-    link_tuple->l_heard_time = cur_time + message_header.get_validity_time ();
+    T_LINK_TUPLE prev_link = *link_tuple;
+    link_tuple->l_heard_time = cur_time + validity;
+    link_tuple->l_in_metric = l_in_metric;
 
-    for (std::vector<C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK>::const_iterator iter = hello_message.neighbor_set.begin ();
+    for (C_MESSAGE_HEADER::AddrBlockList::const_iterator iter = hello_message.neighbor_set.begin ();
         iter != hello_message.neighbor_set.end (); iter++)
       {
-        if (((m_instance == NORMAL_NODE_INSTANCE) and (iter->unique_id == m_node_address.node_id))
-            || ((m_instance == LEADER_NODE_INSTANCE) and (iter->unique_id == m_node_address.net_id)))
+        T_NODE_ADDRESS listed_addr;
+
+        /* The listed address is the common id of the message completed by the unique id */
+        if (hello_message.abf == E_ADDRESS_BLOCK_FLAGS::NET_ID_COMMON)
+          {
+            listed_addr.net_id = hello_message.common_id;
+            listed_addr.node_id = iter->unique_id;
+          }
+        else
+          {
+            listed_addr.net_id = iter->unique_id;
+            listed_addr.node_id = hello_message.common_id;
+          }
+
+        if (listed_addr == m_node_address)
           {
             if(validate_neighbor_link_type(*iter) == true)
               {
@@ -155,46 +443,250 @@ namespace ns_olsr2_0
             if (iter->common_field.link_state.type_fields.link_type == LOST_LINK)
               {
                 link_tuple->l_sym_time = cur_time - 1;
-                link_tuple->l_heard_time = cur_time - 1;
-                link_tuple->l_status = LOST_LINK;
-                link_updated = true;
               }
             else if ((iter->common_field.link_state.type_fields.link_type == HEARD_LINK)
                 or (iter->common_field.link_state.type_fields.link_type == SYMMETRIC_LINK))
               {
-                link_tuple->l_sym_time = cur_time + message_header.get_validity_time ();
-                link_tuple->l_time = link_tuple->l_sym_time + message_header.get_validity_time ();
-                link_tuple->l_status = SYMMETRIC_LINK;
-                link_updated = true;
+                link_tuple->l_sym_time = cur_time + validity;
+                link_tuple->l_time = std::max (link_tuple->l_time, C_TUPLE_TIME (cur_time + validity + validity));
+
+                /* The neighbor's in metric is the out metric of this node */
+                link_tuple->l_out_metric = iter->metric[1];
               }
+
+            mpr_selector = ((iter->common_field.link_state.type_fields.nbr_type == ROUTING_MPR)
+                or (iter->common_field.link_state.type_fields.nbr_type == MPR_FLOOD_ROUTE));
+            flooding_mpr_selector = ((iter->common_field.link_state.type_fields.nbr_type == FLOODING_MPR)
+                or (iter->common_field.link_state.type_fields.nbr_type == MPR_FLOOD_ROUTE));
             break;
 
           }
 
       }
 
-    if(link_updated == true)
-        {
-           ;/* TBD - Update neighbor tuple */
-        }
-    if(link_created == true)
+    link_tuple->l_time = std::max (link_tuple->l_time, link_tuple->l_heard_time);
+    link_tuple->l_status = (link_tuple->l_sym_time >= cur_time) ? SYMMETRIC_LINK : HEARD_LINK;
+
+    /* A lapsed symmetric time is kept just behind the current time, so that it stays within the range of the 32 bit tuple times */
+    if (link_tuple->l_status != SYMMETRIC_LINK)
+      {
+        link_tuple->l_sym_time = cur_time - 1;
+      }
+    link_tuple->l_mpr_selector = (flooding_mpr_selector and (link_tuple->l_status == SYMMETRIC_LINK));
+    m_state.update_link_tuple (link_tuple);
+
+    T_BOOL changed = ((link_created == true) or (link_tuple->l_status != prev_link.l_status)
+        or (link_tuple->l_in_metric != prev_link.l_in_metric) or (link_tuple->l_out_metric != prev_link.l_out_metric)
+        or (link_tuple->l_mpr_selector != prev_link.l_mpr_selector));
+
+    T_NEIGHBOUR_TUPLE* neighbour_tuple = m_state.find_neighbour_tuple (sender_iface_addr);
+    T_NEIGHBOUR_TUPLE sensed_neighbour = T_NEIGHBOUR_TUPLE ();
+
+    sensed_neighbour.n_neighbor_addr = sender_iface_addr;
+    sensed_neighbour.n_in_metric = link_tuple->l_in_metric;
+    sensed_neighbour.n_out_metric = link_tuple->l_out_metric;
+    sensed_neighbour.n_willingness = hello_message.node_willingness;
+    sensed_neighbour.n_symmetric = (link_tuple->l_status == SYMMETRIC_LINK);
+    sensed_neighbour.n_mpr_selector = (mpr_selector and sensed_neighbour.n_symmetric);
+    sensed_neighbour.n_advertised = sensed_neighbour.n_mpr_selector;
+
+    /* A new neighbor is inserted fully built, the state derives its selector bit and advertised entry on insertion */
+    if (neighbour_tuple == NULL)
+      {
+        sensed_neighbour.n_flooding_mpr = false;
+        sensed_neighbour.n_routing_mpr = false;
+
+        neighbour_tuple = m_state.insert_neighbour_tuple (sensed_neighbour);
+
+        if (neighbour_tuple == NULL)
+          {
+            return changed;
+          }
+        changed = true;
+      }
+
+    T_NEIGHBOUR_TUPLE prev_neighbour = *neighbour_tuple;
+
+    neighbour_tuple->n_in_metric = sensed_neighbour.n_in_metric;
+    neighbour_tuple->n_out_metric = sensed_neighbour.n_out_metric;
+    neighbour_tuple->n_willingness = sensed_neighbour.n_willingness;
+    neighbour_tuple->n_symmetric = sensed_neighbour.n_symmetric;
+    neighbour_tuple->n_mpr_selector = sensed_neighbour.n_mpr_selector;
+    neighbour_tuple->n_advertised = sensed_neighbour.n_advertised;
+    m_state.update_neighbour_tuple (neighbour_tuple);
+
+    /* A new neighbor or a lost or newly symmetric link ends the stable period */
+    if ((link_created == true) or (link_tuple->l_status != prev_link.l_status))
       {
-        ; /* TBD - Create neighbor tuple */
+        note_churn(true, false);
       }
 
+    return ((changed == true) or (neighbour_tuple->n_in_metric != prev_neighbour.n_in_metric)
+        or (neighbour_tuple->n_out_metric != prev_neighbour.n_out_metric)
+        or (neighbour_tuple->n_willingness.willingness != prev_neighbour.n_willingness.willingness)
+        or (neighbour_tuple->n_symmetric != prev_neighbour.n_symmetric)
+        or (neighbour_tuple->n_mpr_selector != prev_neighbour.n_mpr_selector));
   }
 
   /********************************************************************
-   * @function  process_tc
-   *            received from neighbor nodes.
-   * @param     None.
-   * @return    None.
+   * @function  get_tc_address
+   * @brief     This function decodes an address listed in a TC address
+   *            block.
+   * @param     addr_block, addr.
+   * @return    The address.
    * @note      None.
    ********************************************************************/
-  void
+  static T_NODE_ADDRESS
+  get_tc_address (const C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK& addr_block, const C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK& addr)
+  {
+    T_NODE_ADDRESS listed_addr;
+
+    if (addr_block.abf == E_ADDRESS_BLOCK_FLAGS::NET_ID_COMMON)
+      {
+        listed_addr.net_id = addr_block.common_id;
+        listed_addr.node_id = addr.unique_id;
+      }
+    else
+      {
+        listed_addr.net_id = addr.unique_id;
+        listed_addr.node_id = addr_block.common_id;
+      }
+    return listed_addr;
+  }
+
+  /********************************************************************
+   * @function  process_tc
+   * @brief     This function updates the topology with a TC message
+   *            received from a symmetric neighbor.
+   * @param     msg_header, sender_iface.
+   * @return    true if the topology changed.
+   * @note      The router topology tuples of an originator are one slab
+   *            tagged with its ANSN, found with one lookup. An older TC
+   *            stops there, a newer one is written over the slab and
+   *            one with the same ANSN only extends its validity, adding
+   *            the addresses the slab lacks. The addresses are walked
+   *            in the order of the slab, so the cost follows the size
+   *            of the message and not the one of the topology, and an
+   *            address past the end of the slab is appended at once.
+   ********************************************************************/
+  T_BOOL
   C_OLSR::process_tc (const C_MESSAGE_HEADER& msg_header, const T_NODE_ADDRESS& sender_iface)
   {
-    ;
+    M_PHASE_TIMER (PROCESS_TC_PHASE);
+
+    const C_MESSAGE_HEADER::T_TC& tc_message = msg_header.get_tc ();
+    T_NODE_ADDRESS orig_addr = msg_header.get_originator_address ();
+    Time validity = msg_header.get_validity_time ();
+
+    if ((validity == 0) or (orig_addr == m_node_address) or (m_state.find_sym_neighbour_tuple (sender_iface) == NULL))
+      {
+        return false;
+      }
+
+    Time expiry = get_cur_time () + validity;
+    T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab = m_state.find_advertising_remote_router_tuple (orig_addr);
+
+    if ((slab != NULL) and (is_seq_num_newer (slab->ar_seq_number, tc_message.ansn) == true))
+      {
+        return false;
+      }
+
+    if ((slab == NULL) or (is_seq_num_newer (tc_message.ansn, slab->ar_seq_number) == true))
+      {
+        T_UINT32 count = 0;
+
+        for (const C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK& addr_block : tc_message.tc_addr_set)
+          {
+            if (addr_block.tc_msg_type == E_TC_ADDRESS_TYPE::ROUTABLE_ORIG)
+              {
+                count += addr_block.network_info.size ();
+              }
+          }
+
+        T_ROUTER_TOPOLOGY_TUPLE* topology_tuple = m_state.replace_router_topology_slab (orig_addr, tc_message.ansn, expiry, count);
+
+        if (topology_tuple == NULL)
+          {
+            return false;
+          }
+
+        for (const C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK& addr_block : tc_message.tc_addr_set)
+          {
+            if (addr_block.tc_msg_type != E_TC_ADDRESS_TYPE::ROUTABLE_ORIG)
+              {
+                continue;
+              }
+            for (const C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK& addr : addr_block.network_info)
+              {
+                topology_tuple->tr_from_orig_addr = orig_addr;
+                topology_tuple->tr_to_orig_addr = get_tc_address (addr_block, addr);
+                topology_tuple->tr_seq_number = tc_message.ansn;
+                topology_tuple->tr_time = C_TUPLE_TIME (expiry);
+                topology_tuple->tr_metric = addr.metric[0];
+                topology_tuple++;
+              }
+          }
+        return true;
+      }
+
+    /* Same ANSN, a repeated or a further message of the same TC */
+    slab->ar_time = std::max (slab->ar_time, C_TUPLE_TIME (expiry));
+
+    T_UINT32 next_idx = 0;
+    T_BOOL appended = false;
+
+    for (const C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK& addr_block : tc_message.tc_addr_set)
+      {
+        if (addr_block.tc_msg_type != E_TC_ADDRESS_TYPE::ROUTABLE_ORIG)
+          {
+            continue;
+          }
+        for (const C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK& addr : addr_block.network_info)
+          {
+            T_NODE_ADDRESS to_addr = get_tc_address (addr_block, addr);
+
+            /* Past the end of the slab the address is new, no need to search */
+            if (next_idx < slab->ar_count)
+              {
+                const T_ROUTER_TOPOLOGY_TUPLE* slab_tuples = m_state.get_router_topology_slab (*slab);
+
+                /* Listed in the order of the slab */
+                if (slab_tuples[next_idx].tr_to_orig_addr == to_addr)
+                  {
+                    next_idx++;
+                    continue;
+                  }
+
+                T_UINT32 idx = 0;
+
+                while ((idx < slab->ar_count) and ((slab_tuples[idx].tr_to_orig_addr == to_addr) == false))
+                  {
+                    idx++;
+                  }
+
+                if (idx < slab->ar_count)
+                  {
+                    next_idx = idx + 1;
+                    continue;
+                  }
+              }
+
+            T_ROUTER_TOPOLOGY_TUPLE* topology_tuple = m_state.append_router_topology_tuple (*slab);
+
+            if (topology_tuple == NULL)
+              {
+                return appended;
+              }
+            topology_tuple->tr_from_orig_addr = orig_addr;
+            topology_tuple->tr_to_orig_addr = to_addr;
+            topology_tuple->tr_seq_number = tc_message.ansn;
+            topology_tuple->tr_time = slab->ar_time;
+            topology_tuple->tr_metric = addr.metric[0];
+            next_idx = slab->ar_count;
+            appended = true;
+          }
+      }
+    return appended;
   }
 
 }
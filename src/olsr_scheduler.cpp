@@ -0,0 +1,261 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_scheduler.cpp
+ *
+ * Description        :   Implements the timer scheduler of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <algorithm>
+#include "olsr_scheduler.hpp"
+#include "olsr.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  timer_later
+   * @brief     Orders the timer heap, the earliest deadline on top.
+   * @param     entry_a, entry_b.
+   * @return    true if entry_a fires after entry_b.
+   * @note      None.
+  ********************************************************************/
+  static inline T_BOOL timer_later(const T_TIMER_ENTRY& entry_a, const T_TIMER_ENTRY& entry_b)
+  {
+    if(entry_a.deadline != entry_b.deadline)
+      {
+        return (entry_a.deadline > entry_b.deadline);
+      }
+    return ((T_INT32)(entry_a.sequence - entry_b.sequence) > 0);
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_SCHEDULER
+   * @brief     This function is the constructor of C_OLSR_SCHEDULER.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_SCHEDULER::C_OLSR_SCHEDULER()
+  {
+    m_sequence = 0;
+    m_stale_count = 0;
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_SCHEDULER
+   * @brief     This function is the destructor of C_OLSR_SCHEDULER.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_SCHEDULER::~C_OLSR_SCHEDULER()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  schedule
+   * @brief     This function schedules a timer of a node.
+   * @param     node, event, deadline, generation.
+   * @return    None.
+   * @note      Rescheduling does not search the heap, the node bumps
+   *            the generation of the timer and the older entry is
+   *            dropped when it reaches the top or by a compaction.
+  ********************************************************************/
+  void C_OLSR_SCHEDULER::schedule(C_OLSR* node, E_TIMER_EVENT event, Time deadline, T_UINT32 generation)
+  {
+    T_TIMER_ENTRY entry;
+
+    entry.deadline = deadline;
+    entry.sequence = m_sequence++;
+    entry.generation = generation;
+    entry.node = node;
+    entry.event = event;
+
+    m_heap.push_back(entry);
+    std::push_heap(m_heap.begin(), m_heap.end(), timer_later);
+  }
+
+  /********************************************************************
+   * @function  is_stale
+   * @brief     This function checks if a timer was rescheduled or
+   *            cancelled after this entry was pushed.
+   * @param     entry.
+   * @return    true if the entry must be ignored.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_OLSR_SCHEDULER::is_stale(const T_TIMER_ENTRY& entry) const
+  {
+    return (entry.node->get_timer_generation(entry.event) != entry.generation);
+  }
+
+  /********************************************************************
+   * @function  pop
+   * @brief     This function removes the top of the timer heap.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_SCHEDULER::pop(void)
+  {
+    std::pop_heap(m_heap.begin(), m_heap.end(), timer_later);
+    m_heap.pop_back();
+  }
+
+  /********************************************************************
+   * @function  cancel
+   * @brief     This function counts a pending timer whose entry turned
+   *            stale, the node bumped its generation.
+   * @param     None.
+   * @return    None.
+   * @note      The heap is compacted once the stale entries outnumber
+   *            the live ones, so that it stays at most twice the size
+   *            of the pending timers.
+  ********************************************************************/
+  void C_OLSR_SCHEDULER::cancel(void)
+  {
+    m_stale_count++;
+
+    if(m_stale_count > (m_heap.size() - m_stale_count))
+      {
+        compact();
+      }
+  }
+
+  /********************************************************************
+   * @function  compact
+   * @brief     This function drops the stale entries and rebuilds the
+   *            heap.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_SCHEDULER::compact(void)
+  {
+    m_heap.erase(std::remove_if(m_heap.begin(), m_heap.end(),
+                                [this](const T_TIMER_ENTRY& entry) { return is_stale(entry); }),
+                 m_heap.end());
+    std::make_heap(m_heap.begin(), m_heap.end(), timer_later);
+    m_stale_count = 0;
+  }
+
+  /********************************************************************
+   * @function  remove_node
+   * @brief     This function drops all the timers of a node.
+   * @param     node.
+   * @return    None.
+   * @note      Called by the node before it is destroyed or moved to
+   *            another scheduler, no entry may point to it afterwards.
+  ********************************************************************/
+  void C_OLSR_SCHEDULER::remove_node(const C_OLSR* node)
+  {
+    std::vector<T_TIMER_ENTRY>::iterator last = m_heap.end();
+
+    for(std::vector<T_TIMER_ENTRY>::iterator it = m_heap.begin(); it != last; )
+      {
+        if(it->node != node)
+          {
+            ++it;
+            continue;
+          }
+        if((is_stale(*it) == true) and (m_stale_count > 0))
+          {
+            m_stale_count--;
+          }
+        *it = *(--last);
+      }
+
+    if(last != m_heap.end())
+      {
+        m_heap.erase(last, m_heap.end());
+        std::make_heap(m_heap.begin(), m_heap.end(), timer_later);
+      }
+  }
+
+  /********************************************************************
+   * @function  run_due
+   * @brief     This function fires all timers whose deadline is
+   *            reached.
+   * @param     cur_time.
+   * @return    Number of timers fired.
+   * @note      A timer scheduled by a handler for cur_time or earlier
+   *            fires in the same call.
+  ********************************************************************/
+  T_UINT32 C_OLSR_SCHEDULER::run_due(Time cur_time)
+  {
+    T_UINT32 fired = 0;
+
+    while((m_heap.empty() == false) and (m_heap.front().deadline <= cur_time))
+      {
+        T_TIMER_ENTRY entry = m_heap.front();
+        pop();
+
+        if(is_stale(entry) == false)
+          {
+            entry.node->handle_timer(entry.event);
+            fired++;
+          }
+        else if(m_stale_count > 0)
+          {
+            m_stale_count--;
+          }
+      }
+
+    return fired;
+  }
+
+  /********************************************************************
+   * @function  next_deadline
+   * @brief     This function returns the deadline of the next pending
+   *            timer, so that the host can sleep until then.
+   * @param     None.
+   * @return    Deadline, M_TIME_INFINITE if nothing is pending.
+   * @note      Stale entries on top of the heap are dropped first so
+   *            that they do not wake the host.
+  ********************************************************************/
+  Time C_OLSR_SCHEDULER::next_deadline(void)
+  {
+    while((m_heap.empty() == false) and (is_stale(m_heap.front()) == true))
+      {
+        pop();
+        if(m_stale_count > 0)
+          {
+            m_stale_count--;
+          }
+      }
+
+    if(m_heap.empty() == true)
+      {
+        return M_TIME_INFINITE;
+      }
+    return m_heap.front().deadline;
+  }
+
+  /********************************************************************
+   * @function  clear
+   * @brief     This function drops all the timers.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_SCHEDULER::clear(void)
+  {
+    m_heap.clear();
+    m_stale_count = 0;
+  }
+
+}
@@ -0,0 +1,101 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_scheduler.hpp
+ *
+ * Description        :   To store the timer scheduler of olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_SCHEDULER_HPP_
+#define OLSR_SCHEDULER_HPP_
+
+#include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_TIME_INFINITE     0x7FFFFFFFFFFFFFFFLL    /* Deadline of an empty scheduler */
+
+  class C_OLSR;
+
+  /**
+   * Timers owned by an OLSR instance
+   */
+  typedef enum
+  {
+    HELLO_TIMER = 0X0,          /* Periodic HELLO transmission */
+    TC_TIMER = 0X1,             /* Periodic TC transmission */
+    EXPIRY_TIMER = 0X2,         /* Earliest expiry of the state tuples */
+    RECOMPUTE_TIMER = 0X3,      /* Deferred MPR and routing table computation */
+    MAX_TIMER_EVENT = 0X4
+  }E_TIMER_EVENT;
+
+  /**
+   * Entry of the timer heap
+   */
+  typedef struct
+  {
+    Time deadline;              /* Time at which the timer fires */
+    T_UINT32 sequence;          /* Insertion order, orders timers with equal deadlines */
+    T_UINT32 generation;        /* Generation of the timer when it was scheduled */
+    C_OLSR* node;               /* Owner of the timer */
+    E_TIMER_EVENT event;        /* Timer type */
+  }T_TIMER_ENTRY;
+
+  class C_OLSR_SCHEDULER
+  {
+
+  public:
+    C_OLSR_SCHEDULER();
+
+    ~C_OLSR_SCHEDULER();
+
+    /* Schedules a timer of a node, an older pending generation of it is ignored when it fires */
+    void schedule(C_OLSR* node, E_TIMER_EVENT event, Time deadline, T_UINT32 generation);
+
+    T_UINT32 run_due(Time cur_time);    /* Fires all timers due at cur_time and returns their count */
+
+    Time next_deadline(void);           /* Returns the deadline of the next pending timer */
+
+    void cancel(void);                  /* Counts a pending timer whose entry turned stale */
+
+    void remove_node(const C_OLSR* node);   /* Drops all the timers of a node before it is destroyed */
+
+    void clear(void);                   /* Drops all the timers */
+
+    T_UINT32
+    get_pending_count () const
+    {
+      return m_heap.size() - m_stale_count;
+    }
+
+  private:
+
+    std::vector<T_TIMER_ENTRY> m_heap;  /* Binary min heap ordered by deadline and sequence */
+
+    T_UINT32 m_sequence;                /* Sequence given to the next scheduled timer */
+
+    T_UINT32 m_stale_count;             /* Entries of cancelled or rescheduled timers still in the heap */
+
+    T_BOOL is_stale(const T_TIMER_ENTRY& entry) const;
+
+    void pop(void);
+
+    void compact(void);                 /* Drops the stale entries and rebuilds the heap */
+  };
+
+}
+
+#endif /* OLSR_SCHEDULER_HPP_ */
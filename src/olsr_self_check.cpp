@@ -0,0 +1,548 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_self_check.cpp
+ *
+ * Description        :   Implements the self check of the olsr state indexes .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <algorithm>
+#include <memory>
+#include "olsr_self_check.hpp"
+
+using namespace std;
+
+namespace ns_olsr2_0
+{
+#define M_CHECK_KEY_RANGE           (8 * M_KEY_HASH_THRESHOLD)      /* Keys drawn from a dense range, as the node ids are */
+#define M_CHECK_ABSENT_PROBES       16          /* Absent keys looked up after each operation */
+#define M_CHECK_MAX_REPORTED        10          /* Failures written, the others are only counted */
+
+  /********************************************************************
+   * @function  C_OLSR_SELF_CHECK
+   * @brief     This function is the constructor of C_OLSR_SELF_CHECK.
+   * @param     out.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_SELF_CHECK::C_OLSR_SELF_CHECK(std::ostream& out)
+    : m_out(out), m_rng(M_CHECK_SEED)
+  {
+    m_checks = 0;
+    m_failures = 0;
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_SELF_CHECK
+   * @brief     This function is the destructor of C_OLSR_SELF_CHECK.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_OLSR_SELF_CHECK::~C_OLSR_SELF_CHECK()
+  {
+
+  }
+
+  /********************************************************************
+   * @function  run
+   * @brief     This function runs all the checks and writes a summary.
+   * @param     None.
+   * @return    Failures.
+   * @note      None.
+  ********************************************************************/
+  T_UINT32 C_OLSR_SELF_CHECK::run(void)
+  {
+    m_checks = 0;
+    m_failures = 0;
+
+    check_key_index<T_UINT16>("key index 16 bit");
+    check_key_index<T_UINT32>("key index 32 bit");
+    check_topology_slabs();
+    check_selector_bits();
+    check_fresh_neighbour();
+    check_worker_digests();
+
+    m_out << "Self checks = " << m_checks << " failures = " << m_failures << endl;
+
+    return m_failures;
+  }
+
+  /********************************************************************
+   * @function  check
+   * @brief     This function counts a check and writes it if it failed.
+   * @param     condition, name.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_SELF_CHECK::check(T_BOOL condition, const char* name)
+  {
+    m_checks++;
+
+    if(condition == false)
+      {
+        m_failures++;
+        if(m_failures <= M_CHECK_MAX_REPORTED)
+          {
+            m_out << "Self check failed: " << name << endl;
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  check_key_rows
+   * @brief     This function checks that each key is found at its row
+   *            and that absent keys are not found.
+   * @param     index, keys, name.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  template <typename T_KEY>
+  void C_OLSR_SELF_CHECK::check_key_rows(const C_KEY_INDEX<T_KEY>& index, const std::vector<T_KEY>& keys, const char* name)
+  {
+    T_BOOL rows_found = (index.size() == keys.size());
+    T_BOOL absent_missed = true;
+
+    for(std::size_t row = 0; (row < keys.size()) and (rows_found == true); row++)
+      {
+        rows_found = (index.find(keys[row]) == row);
+      }
+
+    for(T_UINT32 probe = 0; probe < M_CHECK_ABSENT_PROBES; probe++)
+      {
+        T_KEY key = (T_KEY)(m_rng() % M_CHECK_KEY_RANGE);
+
+        if(std::find(keys.begin(), keys.end(), key) == keys.end())
+          {
+            absent_missed = (absent_missed == true) and (index.find(key) == index.size());
+          }
+      }
+
+    check(rows_found, name);
+    check(absent_missed, name);
+  }
+
+  /********************************************************************
+   * @function  check_key_index
+   * @brief     This function grows a key index past the hash threshold
+   *            and shrinks it back, comparing it with a plain vector of
+   *            the keys after each operation.
+   * @param     name.
+   * @return    None.
+   * @note      Each round shrinks with one kind of erasure: moving the
+   *            last row into the erased one, erasing rows in order, or
+   *            keeping the rows of a mask.
+  ********************************************************************/
+  template <typename T_KEY>
+  void C_OLSR_SELF_CHECK::check_key_index(const char* name)
+  {
+    C_OLSR_ARENA arena;
+    C_KEY_INDEX<T_KEY> index(&arena);
+    std::vector<T_KEY> keys;
+
+    for(T_UINT32 round = 0; round < M_CHECK_KEY_ROUNDS; round++)
+      {
+        while(keys.size() <= (2 * M_KEY_HASH_THRESHOLD))
+          {
+            T_KEY key = (T_KEY)(m_rng() % M_CHECK_KEY_RANGE);
+
+            /* The sets never hold two tuples of one key */
+            if(std::find(keys.begin(), keys.end(), key) != keys.end())
+              {
+                continue;
+              }
+            index.push_back(key);
+            keys.push_back(key);
+            check_key_rows(index, keys, name);
+          }
+
+        while(keys.size() >= (M_KEY_HASH_THRESHOLD / 2))
+          {
+            std::vector<T_BOOL> erase(keys.size(), false);
+            std::size_t kept = 0;
+
+            switch(round % 3)
+              {
+              case 0:
+                {
+                  std::size_t row = m_rng() % keys.size();
+
+                  index.swap_erase(row);
+                  keys[row] = keys.back();
+                  keys.pop_back();
+                }
+                break;
+
+              case 1:
+                for(std::size_t row = 0; row < keys.size(); row++)
+                  {
+                    erase[row] = ((m_rng() % 8) == 0);
+                  }
+                index.erase_rows([&](std::size_t row)
+                  {
+                    return erase[row];
+                  });
+                break;
+
+              default:
+                {
+                  T_MATCH_MASK keep;
+
+                  keep.resize((keys.size() + M_MASK_WORD_BITS - 1) / M_MASK_WORD_BITS);
+                  for(std::size_t word_idx = 0; word_idx < keep.size(); word_idx++)
+                    {
+                      keep[word_idx] = 0;
+                    }
+                  for(std::size_t row = 0; row < keys.size(); row++)
+                    {
+                      erase[row] = ((m_rng() % 8) == 0);
+                      if(erase[row] == false)
+                        {
+                          keep[row / M_MASK_WORD_BITS] |= (T_UINT64)1 << (row % M_MASK_WORD_BITS);
+                        }
+                    }
+                  index.compact(keep);
+                }
+                break;
+              }
+
+            if((round % 3) != 0)
+              {
+                for(std::size_t row = 0; row < keys.size(); row++)
+                  {
+                    if(erase[row] == false)
+                      {
+                        keys[kept++] = keys[row];
+                      }
+                  }
+                keys.resize(kept);
+              }
+            check_key_rows(index, keys, name);
+          }
+      }
+
+    index.reset();
+  }
+
+
+  /********************************************************************
+   * @function  get_check_address
+   * @brief     Address of a node of the slab check.
+   * @param     net_id, node_id.
+   * @return    Address.
+   * @note      None.
+  ********************************************************************/
+  static inline T_NODE_ADDRESS get_check_address(T_UINT8 net_id, T_UINT8 node_id)
+  {
+    T_NODE_ADDRESS address;
+
+    address.net_id = net_id;
+    address.node_id = node_id;
+
+    return address;
+  }
+
+  /********************************************************************
+   * @function  check_slab_tuples
+   * @brief     This function checks that the slab of each originator
+   *            holds its addresses in order, and the tuple count.
+   * @param     state, slab_nodes, name.
+   * @return    None.
+   * @note      The originator i + 1 of net 1 advertises the node ids
+   *            of slab_nodes[i] in net 2.
+  ********************************************************************/
+  void C_OLSR_SELF_CHECK::check_slab_tuples(C_OLSR_STATE& state, const std::vector<std::vector<T_UINT8> >& slab_nodes, const char* name)
+  {
+    T_BOOL tuples_found = true;
+    std::size_t count = 0;
+
+    for(std::size_t orig_idx = 0; (orig_idx < slab_nodes.size()) and (tuples_found == true); orig_idx++)
+      {
+        T_NODE_ADDRESS orig_addr = get_check_address(1, orig_idx + 1);
+        const T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab = state.find_advertising_remote_router_tuple(orig_addr);
+
+        tuples_found = (slab != NULL) and (slab->ar_count == slab_nodes[orig_idx].size())
+                       and (slab->ar_count <= slab->ar_capacity)
+                       and ((slab->ar_first + slab->ar_capacity) <= state.m_router_topology_set.size());
+
+        for(T_UINT32 idx = 0; (idx < slab_nodes[orig_idx].size()) and (tuples_found == true); idx++)
+          {
+            const T_ROUTER_TOPOLOGY_TUPLE& tuple = state.get_router_topology_slab(*slab)[idx];
+
+            tuples_found = (tuple.tr_from_orig_addr == orig_addr)
+                           and (tuple.tr_to_orig_addr == get_check_address(2, slab_nodes[orig_idx][idx]));
+          }
+        count += slab_nodes[orig_idx].size();
+      }
+
+    check(tuples_found, name);
+    check(state.get_router_topology_count() == count, name);
+  }
+
+  /********************************************************************
+   * @function  check_topology_slabs
+   * @brief     This function grows the slabs of the router topology
+   *            set tuple by tuple and by forced moves, and compacts the
+   *            set after each round, checking the tuples of each slab
+   *            after each step.
+   * @param     None.
+   * @return    None.
+   * @note      After a compaction the slabs follow each other from the
+   *            start of the set, without holes.
+  ********************************************************************/
+  void C_OLSR_SELF_CHECK::check_topology_slabs(void)
+  {
+    std::unique_ptr<C_OLSR_STATE> state(new C_OLSR_STATE());
+    std::vector<std::vector<T_UINT8> > slab_nodes(M_CHECK_ORIGINATORS);
+    Time expiry = get_cur_time() + M_TC_MSG_VALID_TIME * M_MSEC_PER_SEC;
+
+    for(T_UINT32 orig_idx = 0; orig_idx < M_CHECK_ORIGINATORS; orig_idx++)
+      {
+        T_NODE_ADDRESS orig_addr = get_check_address(1, orig_idx + 1);
+        T_UINT32 count = 1 + (m_rng() % M_TOPOLOGY_MIN_SLAB);
+        T_ROUTER_TOPOLOGY_TUPLE* tuples = state->replace_router_topology_slab(orig_addr, 1, expiry, count);
+
+        for(T_UINT32 idx = 0; (tuples != NULL) and (idx < count); idx++)
+          {
+            tuples[idx].tr_from_orig_addr = orig_addr;
+            tuples[idx].tr_to_orig_addr = get_check_address(2, idx + 1);
+            slab_nodes[orig_idx].push_back(idx + 1);
+          }
+      }
+    check_slab_tuples(*state, slab_nodes, "topology slabs filled");
+
+    for(T_UINT32 round = 0; round < M_CHECK_SLAB_ROUNDS; round++)
+      {
+        for(T_UINT32 step = 0; step < M_CHECK_ORIGINATORS; step++)
+          {
+            T_UINT32 orig_idx = m_rng() % M_CHECK_ORIGINATORS;
+            T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab = state->find_advertising_remote_router_tuple(get_check_address(1, orig_idx + 1));
+
+            if((m_rng() % 4) == 0)
+              {
+                /* Moves the slab to the end of the set with its tuples */
+                state->reserve_slab(*slab, slab->ar_capacity + 1);
+              }
+            else if(slab_nodes[orig_idx].size() < M_CHECK_MAX_SLAB_TUPLES)
+              {
+                T_ROUTER_TOPOLOGY_TUPLE* tuple = state->append_router_topology_tuple(*slab);
+
+                if(tuple != NULL)
+                  {
+                    slab_nodes[orig_idx].push_back(slab_nodes[orig_idx].size() + 1);
+                    tuple->tr_from_orig_addr = slab->ar_orig_addr;
+                    tuple->tr_to_orig_addr = get_check_address(2, slab_nodes[orig_idx].back());
+                  }
+              }
+            check_slab_tuples(*state, slab_nodes, "topology slabs moved");
+          }
+
+        state->compact_topology();
+        check_slab_tuples(*state, slab_nodes, "topology slabs compacted");
+
+        /* The slabs follow each other from the start of the set */
+        std::vector<const T_ADVERTISING_REMOTE_ROUTER_TUPLE*> slabs;
+        T_UINT32 first = 0;
+        T_BOOL packed = true;
+
+        for(const T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab : state->m_advertising_remote_router_set)
+          {
+            slabs.push_back(&slab);
+          }
+        std::sort(slabs.begin(), slabs.end(), [](const T_ADVERTISING_REMOTE_ROUTER_TUPLE* lhs, const T_ADVERTISING_REMOTE_ROUTER_TUPLE* rhs)
+          {
+            return (lhs->ar_first < rhs->ar_first);
+          });
+        for(const T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab : slabs)
+          {
+            packed = (packed == true) and (slab->ar_first == first);
+            first += slab->ar_capacity;
+          }
+
+        check((packed == true) and (first == state->m_router_topology_set.size()) and (state->m_topology_holes == 0),
+              "topology slabs packed");
+      }
+  }
+
+  /********************************************************************
+   * @function  check_selector_bits
+   * @brief     This function inserts neighbor and link tuples with
+   *            random selector flags and changes the flags in place,
+   *            checking the routing and flooding selector bits against
+   *            the tuples after each round.
+   * @param     None.
+   * @return    None.
+   * @note      The tuples are value initialised and fully built before
+   *            the insertion, as the protocol builds them.
+  ********************************************************************/
+  void C_OLSR_SELF_CHECK::check_selector_bits(void)
+  {
+    std::unique_ptr<C_OLSR_STATE> state(new C_OLSR_STATE());
+    Time expiry = get_cur_time() + M_TC_MSG_VALID_TIME * M_MSEC_PER_SEC;
+    T_UINT32 advertised_changes = 0;
+
+    for(T_UINT32 idx = 0; idx < M_CHECK_SELECTOR_TUPLES; idx++)
+      {
+        T_NODE_ADDRESS address = get_check_address(1 + (idx % 4), 1 + idx);
+        T_NEIGHBOUR_TUPLE neighbour = T_NEIGHBOUR_TUPLE();
+        T_LINK_TUPLE link = T_LINK_TUPLE();
+
+        neighbour.n_neighbor_addr = address;
+        neighbour.n_symmetric = true;
+        neighbour.n_mpr_selector = ((m_rng() % 2) == 0);
+        neighbour.n_advertised = neighbour.n_mpr_selector;
+        state->insert_neighbour_tuple(neighbour);
+        advertised_changes += (neighbour.n_advertised == true) ? 1 : 0;
+
+        link.l_neighbor_iface_addr = address;
+        link.l_heard_time = expiry;
+        link.l_sym_time = expiry;
+        link.l_time = expiry;
+        link.l_status = SYMMETRIC_LINK;
+        link.l_mpr_selector = ((m_rng() % 2) == 0);
+        state->insert_link_tuple(link);
+      }
+
+    for(T_UINT32 round = 0; round <= M_CHECK_SELECTOR_ROUNDS; round++)
+      {
+        T_BOOL bits_match = true;
+
+        for(T_UINT32 idx = 0; idx < M_CHECK_SELECTOR_TUPLES; idx++)
+          {
+            T_NODE_ADDRESS address = get_check_address(1 + (idx % 4), 1 + idx);
+            T_NEIGHBOUR_TUPLE* neighbour = state->find_neighbour_tuple(address);
+            T_LINK_TUPLE* link = state->find_link_tuple(address);
+
+            bits_match = (bits_match == true) and (neighbour != NULL) and (link != NULL)
+                         and (state->check_is_routing_mpr_selector(address) == neighbour->n_mpr_selector)
+                         and (state->check_is_flooding_mpr_selector(address) == link->l_mpr_selector);
+
+            if((neighbour != NULL) and ((m_rng() % 4) == 0))
+              {
+                neighbour->n_mpr_selector = (neighbour->n_mpr_selector == false);
+                neighbour->n_advertised = neighbour->n_mpr_selector;
+                state->update_neighbour_tuple(neighbour);
+                advertised_changes++;
+              }
+            if((link != NULL) and ((m_rng() % 4) == 0))
+              {
+                link->l_mpr_selector = (link->l_mpr_selector == false);
+                state->update_link_tuple(link);
+              }
+          }
+        check(bits_match, "selector bits");
+      }
+
+    /* Each selector change of a symmetric neighbor adds it to or removes it from the advertised set */
+    check(state->get_advertised_change_count() == advertised_changes, "advertised change count");
+  }
+
+  /********************************************************************
+   * @function  check_fresh_neighbour
+   * @brief     This function hands the HELLO of one instance to another
+   *            which has not heard it yet, and checks that the new
+   *            neighbor is not advertised.
+   * @param     None.
+   * @return    None.
+   * @note      The HELLO does not list the receiver, so the link is
+   *            only heard and the neighbor neither symmetric nor a
+   *            selector: the advertised set keeps its size and is not
+   *            marked as changed, no TC is due.
+  ********************************************************************/
+  void C_OLSR_SELF_CHECK::check_fresh_neighbour(void)
+  {
+    C_CAPTURE_TRANSPORT transport;
+    std::unique_ptr<C_OLSR> sender(new C_OLSR());
+    std::unique_ptr<C_OLSR> receiver(new C_OLSR());
+    T_NODE_ADDRESS sender_addr = get_check_address(1, 1);
+    T_NODE_ADDRESS receiver_addr = get_check_address(1, 2);
+
+    sender->set_node_addr(sender_addr);
+    sender->set_transport(&transport);
+    sender->init(NORMAL_NODE_INSTANCE);
+    receiver->set_node_addr(receiver_addr);
+    receiver->set_transport(&transport);
+    receiver->init(NORMAL_NODE_INSTANCE);
+
+    const C_OLSR_STATE& state = receiver->getState();
+    std::size_t advertised_count = state.get_advertised_set().size();
+    T_BOOL advertised_changed = state.m_advertised_changed;
+    T_UINT32 advertised_change_count = state.get_advertised_change_count();
+
+    transport.m_sent = false;
+    sender->send_hello();
+    sender->send_olsr_msg();
+    check(transport.m_sent == true, "fresh neighbor hello sent");
+
+    receiver->recv_olsr(transport.m_packet, sender_addr, receiver_addr, 1.0);
+
+    NeighbourSet::const_iterator neighbour = std::find_if(state.m_neighbour_set.begin(), state.m_neighbour_set.end(),
+      [&](const T_NEIGHBOUR_TUPLE& tuple)
+      {
+        return (tuple.n_neighbor_addr == sender_addr);
+      });
+
+    check((neighbour != state.m_neighbour_set.end()) and (neighbour->n_symmetric == false)
+          and (neighbour->n_mpr_selector == false) and (neighbour->n_advertised == false), "fresh neighbor inserted");
+    check((state.check_is_routing_mpr_selector(sender_addr) == false)
+          and (state.check_is_flooding_mpr_selector(sender_addr) == false), "fresh neighbor not a selector");
+    check((state.get_advertised_set().size() == advertised_count) and (state.m_advertised_changed == advertised_changed)
+          and (state.get_advertised_change_count() == advertised_change_count), "fresh neighbor not advertised");
+  }
+
+  /********************************************************************
+   * @function  check_worker_digests
+   * @brief     This function runs one random scenario with moving
+   *            nodes on 1, 2 and 4 workers and compares the state
+   *            digests of the runs.
+   * @param     None.
+   * @return    None.
+   * @note      Any state read before it is written, such as a field
+   *            of a partly built tuple, differs between the threads
+   *            and shows up as a different digest.
+  ********************************************************************/
+  void C_OLSR_SELF_CHECK::check_worker_digests(void)
+  {
+    T_EMULATOR_CONFIG config = C_OLSR_EMULATOR::get_default_config();
+    T_UINT64 first_digest = 0;
+
+    config.topology = RANDOM_GEOMETRIC_TOPOLOGY;
+    config.node_count = M_CHECK_DIGEST_NODES;
+    config.area_size = M_CHECK_DIGEST_AREA;
+    config.mobility = RANDOM_WAYPOINT_MOBILITY;
+    config.max_speed = 5.0;
+    config.duration = M_CHECK_DIGEST_DURATION;
+    config.seed = M_CHECK_SEED;
+
+    for(T_UINT32 worker_count = 1; worker_count <= M_CHECK_MAX_WORKERS; worker_count *= 2)
+      {
+        config.worker_count = worker_count;
+
+        std::unique_ptr<C_OLSR_EMULATOR> emulator(new C_OLSR_EMULATOR(config));
+
+        emulator->run();
+
+        T_UINT64 digest = emulator->get_host().get_state_digest();
+
+        if(worker_count == 1)
+          {
+            first_digest = digest;
+          }
+        check(digest == first_digest, "worker count digest");
+      }
+  }
+
+}
@@ -0,0 +1,119 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_self_check.hpp
+ *
+ * Description        :   To store the self check of the olsr state indexes .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_SELF_CHECK_HPP_
+#define OLSR_SELF_CHECK_HPP_
+
+#include <random>
+#include <ostream>
+#include "olsr.hpp"                  /* Include file for the OLSR instance */
+#include "olsr_emulator.hpp"         /* Include file for the emulated scenarios */
+#include "olsr_state.hpp"            /* Include file for the state of an instance */
+#include "olsr_transport.hpp"        /* Include file for the packet delivery of an instance */
+
+namespace ns_olsr2_0
+{
+#define M_CHECK_SEED                1           /* Seed of the random operations, the runs repeat */
+#define M_CHECK_KEY_ROUNDS          4           /* Times the key index grows past the hash threshold and shrinks back */
+#define M_CHECK_ORIGINATORS         16          /* Slabs of the router topology set */
+#define M_CHECK_SLAB_ROUNDS         8           /* Rounds of slab growth, each ended by a compaction */
+#define M_CHECK_MAX_SLAB_TUPLES     32          /* Tuples of one slab, the slabs fit the set of a static build */
+#define M_CHECK_SELECTOR_TUPLES     32          /* Neighbor and link tuples of the selector check, spread over nets */
+#define M_CHECK_SELECTOR_ROUNDS     8           /* Rounds of selector changes */
+#define M_CHECK_DIGEST_NODES        64          /* Nodes of the scenario run with each worker count */
+#define M_CHECK_DIGEST_AREA         400.0       /* Side of its area, in meters */
+#define M_CHECK_DIGEST_DURATION     10000       /* Length of its run, in milli seconds */
+#define M_CHECK_MAX_WORKERS         4           /* Worker counts 1, 2, ... doubled up to this one */
+
+  /**
+   * Checks the indexes of the state against plain references, for the
+   * cases the protocol runs seldom reach: a key index crossing the hash
+   * threshold both ways under each kind of erasure, and slabs of the
+   * router topology set moved and compacted, the selector bits of the
+   * neighbor and link tuples, a neighbor created by a HELLO, and the
+   * parallel host giving one result for any worker count. A failed check is written with its name, run() returns the
+   * failures.
+   */
+  class C_OLSR_SELF_CHECK
+  {
+
+  public:
+    C_OLSR_SELF_CHECK(std::ostream& out);
+
+    ~C_OLSR_SELF_CHECK();
+
+    T_UINT32 run(void);                 /* Runs all the checks and returns the failures */
+
+  private:
+
+    /**
+     * Keeps the last packet sent, to hand it to another instance
+     */
+    class C_CAPTURE_TRANSPORT : public C_OLSR_TRANSPORT
+    {
+
+    public:
+      C_CAPTURE_TRANSPORT() : m_sent(false) {}
+
+      void
+      send_packet (const T_NODE_ADDRESS& /* sender_address */, const C_PACKET_HEADER& olsr_packet)
+      {
+        m_packet = olsr_packet;
+        m_sent = true;
+      }
+
+      C_PACKET_HEADER m_packet;         /* Last packet sent */
+
+      T_BOOL m_sent;                    /* True once a packet is sent */
+    };
+
+    std::ostream& m_out;                /* Output of the failures and the summary */
+
+    std::mt19937 m_rng;                 /* Random source of the operations */
+
+    T_UINT32 m_checks;                  /* Checks made */
+
+    T_UINT32 m_failures;                /* Checks failed */
+
+    void check(T_BOOL condition, const char* name);
+
+    /* Compares a key index with the keys it should hold, row for row */
+    template <typename T_KEY>
+    void check_key_rows(const C_KEY_INDEX<T_KEY>& index, const std::vector<T_KEY>& keys, const char* name);
+
+    template <typename T_KEY>
+    void check_key_index(const char* name);
+
+    /* Compares the slab of each originator with the addresses it should hold */
+    void check_slab_tuples(C_OLSR_STATE& state, const std::vector<std::vector<T_UINT8> >& slab_nodes, const char* name);
+
+    void check_topology_slabs(void);
+
+    void check_selector_bits(void);
+
+    void check_fresh_neighbour(void);
+
+    void check_worker_digests(void);
+  };
+
+}
+
+#endif /* OLSR_SELF_CHECK_HPP_ */
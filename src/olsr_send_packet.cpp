@@ -25,15 +25,19 @@ namespace ns_olsr2_0
    ********************************************************************/
    void C_OLSR::send_hello(void)
    {
+     M_PHASE_TIMER(SEND_HELLO_PHASE);
 
      Time cur_time = get_cur_time();
 
-     this->m_state.fill_tuples();
-
-     C_MESSAGE_HEADER msg;
+     /* Built in place in the send queue, the message is neither copied nor moved */
+     C_MESSAGE_HEADER& msg = olsr_msg_list.emplace_back();
 
      msg.set_message_attributes(get_node_addr(), E_OLSR_MSG_TYPE::HELLO_MESSAGE, get_next_msg_seq_num());
 
+     /* Neighbors hold the links for a few of the current, possibly stretched, intervals */
+     msg.set_validity_time(M_VALIDITY_INTERVAL_FACTOR * m_hello_interval);
+     msg.set_interval_time(m_hello_interval);
+
      C_MESSAGE_HEADER::T_HELLO &hello_msg = msg.get_hello();
 
      hello_msg.node_willingness = m_willingness;
@@ -56,47 +60,159 @@ namespace ns_olsr2_0
 
      msg.set_message_length(msg.get_msg_size());
 
-   olsr_msg_list.push_back(msg);
+   }
+
+   /********************************************************************
+    * @function  add_tc_message
+    * @brief     This function queues an empty TC message of the
+    *            current ANSN
+    * @param     None.
+    * @return    The message.
+    * @note      None.
+    ********************************************************************/
+   C_MESSAGE_HEADER& C_OLSR::add_tc_message(void)
+   {
+     C_MESSAGE_HEADER& msg = olsr_msg_list.emplace_back();
+
+     msg.set_message_attributes(get_node_addr(), E_OLSR_MSG_TYPE::TC_MESSAGE, get_next_msg_seq_num());
+
+     msg.set_validity_time(M_VALIDITY_INTERVAL_FACTOR * m_tc_interval);
+     msg.set_interval_time(m_tc_interval);
 
-   unsigned char list[255];
+     msg.get_tc().ansn = m_ansn;
 
+     return msg;
+   }
+
+   /********************************************************************
+    * @function  send_tc
+    * @brief     This function prepares the OLSR TC messages of the
+    *            advertised set and sends them to the OLSR Tx buffer
+    * @param     None.
+    * @return    None.
+    * @note      The advertised set follows the neighbor set as it
+    *            changes, the ANSN only moves when it did. A set larger
+    *            than one message is sent as several messages of the
+    *            same ANSN, each within MAX_OLSR_BUF_SIZE. An empty set
+    *            is sent until the old one expired at all the receivers,
+    *            so that a lost empty TC does not leave it in place.
+    ********************************************************************/
+   void C_OLSR::send_tc(void)
+   {
+     M_PHASE_TIMER(SEND_TC_PHASE);
 
-   std::memcpy(list, &msg, sizeof(C_MESSAGE_HEADER));
+     T_BOOL changed = m_state.check_advertised_set_changed();
+     const AdvertisedNeighbourSet& advertised_set = m_state.get_advertised_set();
 
-   C_MESSAGE_HEADER recv_msg;
+     if(changed == true)
+       {
+         m_ansn++;
+         if(advertised_set.empty() == true)
+           {
+             m_empty_tc_deadline = get_cur_time() + (M_VALIDITY_INTERVAL_FACTOR * m_tc_interval);
+           }
+       }
+     else if((advertised_set.empty() == true) and (get_cur_time() >= m_empty_tc_deadline))
+       {
+         return;
+       }
 
-   std::memcpy(&recv_msg, list, sizeof(C_MESSAGE_HEADER));
+     C_MESSAGE_HEADER* msg = &add_tc_message();
+     T_UINT16 msg_size = M_TC_MSG_HEADER_LEN;
 
-   cout << "received message type " << recv_msg.get_message_type() << endl;
+     for(const T_ADVERTISED_NEIGHBOUR_TUPLE& advertised : advertised_set)
+       {
+         C_MESSAGE_HEADER::TcAddrBlockList& tc_addr_set = msg->get_tc().tc_addr_set;
+         C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK* tc_addr_block = NULL;
+
+         /* One address block per net, the node ids listed under the common net id */
+         for(C_MESSAGE_HEADER::T_TC_ADDRESS_BLOCK& addr_block : tc_addr_set)
+           {
+             if(addr_block.common_id == advertised.a_neighbor_addr.net_id)
+               {
+                 tc_addr_block = &addr_block;
+                 break;
+               }
+           }
+
+         T_UINT16 addr_size = M_ADDR_BLOCK_LEN + ((tc_addr_block == NULL) ? M_TC_ADDR_BLOCK_HEADER_LEN : 0);
+
+         if(((msg_size + addr_size) > MAX_OLSR_BUF_SIZE)
+             or ((tc_addr_block == NULL) and (tc_addr_set.size() == tc_addr_set.max_size()))
+             or ((tc_addr_block != NULL) and (tc_addr_block->network_info.size() == tc_addr_block->network_info.max_size())))
+           {
+             msg->set_message_length(msg->get_msg_size());
+             msg = &add_tc_message();
+             msg_size = M_TC_MSG_HEADER_LEN;
+             tc_addr_block = NULL;
+             addr_size = M_ADDR_BLOCK_LEN + M_TC_ADDR_BLOCK_HEADER_LEN;
+           }
+
+         if(tc_addr_block == NULL)
+           {
+             tc_addr_block = &msg->get_tc().tc_addr_set.emplace_back();
+             tc_addr_block->tc_msg_type = E_TC_ADDRESS_TYPE::ROUTABLE_ORIG;
+             tc_addr_block->abf = E_ADDRESS_BLOCK_FLAGS::NET_ID_COMMON;
+             tc_addr_block->common_id = advertised.a_neighbor_addr.net_id;
+           }
+
+         C_MESSAGE_HEADER::T_GENERIC_ADDR_BLOCK& addr = tc_addr_block->network_info.emplace_back();
+
+         addr.unique_id = advertised.a_neighbor_addr.node_id;
+         addr.common_field.hop_count = 0;
+         addr.metric[0] = advertised.a_out_metric;
+         addr.metric[1] = advertised.a_in_metric;
+
+         msg_size += addr_size;
+       }
 
+     msg->set_message_length(msg->get_msg_size());
    }
 
    /********************************************************************
     * @function  forward_default
     * @brief     This function finds a forwarded message tuple and returns
-    * @param     msg_header.
+    * @param     msg_header, sender_iface_addr.
     * @return    leader_tuple.
-    * @note      None.
+    * @note      A message not received from a flooding MPR selector is
+    *            neither forwarded nor recorded, RFC 7181 section 16.3.
     ********************************************************************/
-   void C_OLSR::forward_default(const C_MESSAGE_HEADER& msg_header)
+   void C_OLSR::forward_default(const C_MESSAGE_HEADER& msg_header, const T_NODE_ADDRESS& sender_iface_addr)
    {
+     /* The function shall forward only the messages of the neighbors which selected this node as flooding MPR */
+     if(m_state.check_is_flooding_mpr_selector(sender_iface_addr) == false)
+       {
+         return;
+       }
 
      T_FORWARDED_MSG_TUPLE * forwrded_msg_tuple = m_state.find_forwarded_msg_tuple(msg_header.get_originator_address(), msg_header.get_message_sequence_number());
 
      if(forwrded_msg_tuple == NULL)
        {
+         /* The function shall not forward while the receive path is overloaded */
+         if(m_overload.allow_forward() == false)
+           {
+             return;
+           }
+
          /* The function shall create a new forwarded message tuple if not present*/
          T_FORWARDED_MSG_TUPLE new_fwd_msg_tuple = create_forwarded_msg_tuple(msg_header);
 
          m_state.insert_forwarded_msg_tuple(new_fwd_msg_tuple);
 
-         /* The function shall push the message to the queue to be retransmitted*/
-         olsr_msg_list.push_back(msg_header);
+         /* The function shall push the message to the queue to be retransmitted, one hop further */
+         if(msg_header.get_time_to_live() > 1)
+           {
+             C_OLSR_METRICS::count(TC_FORWARD_COUNTER);
+             olsr_msg_list.push_back(msg_header);
+             olsr_msg_list.back().set_time_to_live(msg_header.get_time_to_live() - 1);
+             olsr_msg_list.back().set_hop_count(msg_header.get_hop_count() + 1);
+           }
        }
      else
        {
          /* The function shall update the validity time of forwarded message tuple if present */
-         forwrded_msg_tuple->f_time == get_cur_time() + msg_header.get_validity_time();
+         forwrded_msg_tuple->f_time = get_cur_time() + msg_header.get_validity_time();
        }
    }
 
@@ -0,0 +1,263 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_small_vector.hpp
+ *
+ * Description        :   To store the inline small vector used by the olsr messages .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_SMALL_VECTOR_HPP_
+#define OLSR_SMALL_VECTOR_HPP_
+
+#include <new>
+#include <cstdlib>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace ns_olsr2_0
+{
+
+  /**
+   * Vector keeping its first N elements inside the object. Only a
+   * vector growing past N elements allocates, a move steals that
+   * allocation. Iterators are plain pointers and are invalidated by
+   * any growth, as for std::vector. A FIXED vector never allocates,
+   * its producers keep it within max_size().
+   */
+  template <typename T, std::size_t N, bool FIXED = false>
+  class C_SMALL_VECTOR
+  {
+
+  public:
+
+    typedef T value_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::size_t size_type;
+
+    C_SMALL_VECTOR() : m_data(get_inline()), m_size(0), m_capacity(N) {}
+
+    C_SMALL_VECTOR(const C_SMALL_VECTOR& other) : m_data(get_inline()), m_size(0), m_capacity(N)
+    {
+      reserve(other.m_size);
+      for(size_type idx = 0; idx < other.m_size; idx++)
+        {
+          new (&m_data[idx]) T(other.m_data[idx]);
+        }
+      m_size = other.m_size;
+    }
+
+    C_SMALL_VECTOR(C_SMALL_VECTOR&& other) : m_data(get_inline()), m_size(0), m_capacity(N)
+    {
+      take(other);
+    }
+
+    ~C_SMALL_VECTOR()
+    {
+      clear();
+      release();
+    }
+
+    C_SMALL_VECTOR&
+    operator= (const C_SMALL_VECTOR& other)
+    {
+      if(this != &other)
+        {
+          clear();
+          reserve(other.m_size);
+          for(size_type idx = 0; idx < other.m_size; idx++)
+            {
+              new (&m_data[idx]) T(other.m_data[idx]);
+            }
+          m_size = other.m_size;
+        }
+      return *this;
+    }
+
+    C_SMALL_VECTOR&
+    operator= (C_SMALL_VECTOR&& other)
+    {
+      if(this != &other)
+        {
+          clear();
+          release();
+          take(other);
+        }
+      return *this;
+    }
+
+    size_type size () const { return m_size; }
+
+    size_type capacity () const { return m_capacity; }
+
+    /* Largest size, N for a FIXED vector */
+    size_type max_size () const { return (FIXED == true) ? N : UINT32_MAX; }
+
+    bool empty () const { return (m_size == 0); }
+
+    /* True while the elements are stored inside the object */
+    bool is_inline () const { return (m_data == get_inline()); }
+
+    T* data () { return m_data; }
+    const T* data () const { return m_data; }
+
+    iterator begin () { return m_data; }
+    iterator end () { return m_data + m_size; }
+    const_iterator begin () const { return m_data; }
+    const_iterator end () const { return m_data + m_size; }
+
+    T& operator[] (size_type idx) { return m_data[idx]; }
+    const T& operator[] (size_type idx) const { return m_data[idx]; }
+
+    T& front () { return m_data[0]; }
+    const T& front () const { return m_data[0]; }
+
+    T& back () { return m_data[m_size - 1]; }
+    const T& back () const { return m_data[m_size - 1]; }
+
+    void push_back (const T& value) { emplace_back(value); }
+
+    void push_back (T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... T_ARGS>
+    T&
+    emplace_back (T_ARGS&&... args)
+    {
+      if(m_size == m_capacity)
+        {
+          grow(m_capacity * 2);
+        }
+      T* element = new (&m_data[m_size]) T(std::forward<T_ARGS>(args)...);
+      m_size++;
+      return *element;
+    }
+
+    void
+    pop_back ()
+    {
+      m_size--;
+      m_data[m_size].~T();
+    }
+
+    /* Destroys the elements, a heap buffer is kept for reuse */
+    void
+    clear ()
+    {
+      for(size_type idx = 0; idx < m_size; idx++)
+        {
+          m_data[idx].~T();
+        }
+      m_size = 0;
+    }
+
+    void
+    reserve (size_type capacity)
+    {
+      if(capacity > m_capacity)
+        {
+          grow(capacity);
+        }
+    }
+
+    void
+    resize (size_type size)
+    {
+      reserve(size);
+      while(m_size > size)
+        {
+          pop_back();
+        }
+      while(m_size < size)
+        {
+          emplace_back();
+        }
+    }
+
+  private:
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];   /* Storage of the first N elements */
+
+    T* m_data;                          /* m_inline or a heap buffer */
+
+    std::uint32_t m_size;               /* 32 bit counts keep the header of the vector at 16 bytes */
+
+    std::uint32_t m_capacity;
+
+    T* get_inline () { return reinterpret_cast<T*>(m_inline); }
+
+    const T* get_inline () const { return reinterpret_cast<const T*>(m_inline); }
+
+    /* Moves the elements to a heap buffer of the given capacity, a FIXED vector overflowing is a bug of its producer */
+    void
+    grow (size_type capacity)
+    {
+      if(FIXED == true)
+        {
+          std::abort();
+        }
+
+      T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+
+      for(size_type idx = 0; idx < m_size; idx++)
+        {
+          new (&data[idx]) T(std::move(m_data[idx]));
+          m_data[idx].~T();
+        }
+      release();
+      m_data = data;
+      m_capacity = capacity;
+    }
+
+    /* Frees the heap buffer, the vector must be empty */
+    void
+    release ()
+    {
+      if(is_inline() == false)
+        {
+          ::operator delete(m_data);
+          m_data = get_inline();
+          m_capacity = N;
+        }
+    }
+
+    /* Takes the elements of an other vector, this one must be empty and inline */
+    void
+    take (C_SMALL_VECTOR& other)
+    {
+      if(other.is_inline() == false)
+        {
+          m_data = other.m_data;
+          m_size = other.m_size;
+          m_capacity = other.m_capacity;
+          other.m_data = other.get_inline();
+          other.m_size = 0;
+          other.m_capacity = N;
+          return;
+        }
+
+      for(size_type idx = 0; idx < other.m_size; idx++)
+        {
+          new (&m_data[idx]) T(std::move(other.m_data[idx]));
+        }
+      m_size = other.m_size;
+      other.clear();
+    }
+  };
+
+}
+
+#endif /* OLSR_SMALL_VECTOR_HPP_ */
@@ -0,0 +1,133 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_spsc_queue.hpp
+ *
+ * Description        :   To store the lock free single producer single consumer queue .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_SPSC_QUEUE_HPP_
+#define OLSR_SPSC_QUEUE_HPP_
+
+#include <array>
+#include <atomic>
+#include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+
+namespace ns_olsr2_0
+{
+#define M_SPSC_CHUNK_SIZE       64      /* Items stored per chunk of a queue */
+
+  /**
+   * Unbounded lock free queue between one producer thread and one
+   * consumer thread. Items are stored in chunks, the producer links a
+   * new chunk when the last one is full and the consumer frees a chunk
+   * once it has read all its items, so push never waits.
+   */
+  template <typename T>
+  class C_SPSC_QUEUE
+  {
+
+  public:
+    C_SPSC_QUEUE()
+    {
+      m_head = new T_CHUNK();
+      m_tail = m_head;
+      m_read_idx = 0;
+    }
+
+    ~C_SPSC_QUEUE()
+    {
+      while(m_head != NULL)
+        {
+          T_CHUNK* next = m_head->next.load(std::memory_order_relaxed);
+          delete m_head;
+          m_head = next;
+        }
+    }
+
+    C_SPSC_QUEUE(const C_SPSC_QUEUE&) = delete;
+    C_SPSC_QUEUE& operator=(const C_SPSC_QUEUE&) = delete;
+
+    /* Producer side, appends an item */
+    void
+    push (const T& item)
+    {
+      T_UINT32 count = m_tail->count.load(std::memory_order_relaxed);
+
+      if(count == M_SPSC_CHUNK_SIZE)
+        {
+          T_CHUNK* chunk = new T_CHUNK();
+
+          m_tail->next.store(chunk, std::memory_order_release);
+          m_tail = chunk;
+          count = 0;
+        }
+
+      m_tail->items[count] = item;
+      m_tail->count.store(count + 1, std::memory_order_release);
+    }
+
+    /* Consumer side, takes the oldest item, false if the queue is empty */
+    T_BOOL
+    pop (T& item)
+    {
+      while(true)
+        {
+          if(m_read_idx < m_head->count.load(std::memory_order_acquire))
+            {
+              item = m_head->items[m_read_idx];
+              m_read_idx++;
+              return true;
+            }
+
+          if(m_read_idx < M_SPSC_CHUNK_SIZE)
+            {
+              return false;
+            }
+
+          T_CHUNK* next = m_head->next.load(std::memory_order_acquire);
+
+          if(next == NULL)
+            {
+              return false;
+            }
+
+          delete m_head;
+          m_head = next;
+          m_read_idx = 0;
+        }
+    }
+
+  private:
+
+    struct T_CHUNK
+    {
+      std::array<T, M_SPSC_CHUNK_SIZE> items;           /* Items of the chunk */
+      std::atomic<T_UINT32> count;                      /* Items published by the producer */
+      std::atomic<T_CHUNK*> next;                       /* Next chunk, linked when this one is full */
+
+      T_CHUNK() : count(0), next(NULL) {}
+    };
+
+    alignas(64) T_CHUNK* m_head;        /* Chunk read by the consumer */
+    T_UINT32 m_read_idx;                /* Next item read in m_head */
+
+    alignas(64) T_CHUNK* m_tail;        /* Chunk written by the producer */
+  };
+
+}
+
+#endif /* OLSR_SPSC_QUEUE_HPP_ */
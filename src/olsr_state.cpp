@@ -18,7 +18,10 @@
  *
  *
  */
+#include <algorithm>
 #include "olsr_state.hpp"
+#include "olsr_scheduler.hpp"
+#include "olsr_log.hpp"
 
 namespace ns_olsr2_0
 {
@@ -30,8 +33,105 @@ namespace ns_olsr2_0
    * @note      None.
    ********************************************************************/
   C_OLSR_STATE::C_OLSR_STATE ()
+  :
+#ifdef M_STATIC_MEMORY
+    m_arena (m_storage, sizeof (m_storage)),
+#endif
+    m_link_set (&m_arena), m_two_hop_neighbour_set (&m_arena), m_neighbour_set (&m_arena),
+#ifdef M_TUPLE_COLUMNS
+    m_link_columns (&m_arena), m_neighbour_columns (&m_arena),
+#endif
+    m_advertised_set (&m_arena), m_advertising_remote_router_set (&m_arena), m_router_topology_set (&m_arena), m_processed_msg_set (&m_arena),
+    m_forwarded_msg_set (&m_arena), m_routing_table (&m_arena), m_link_keys (&m_arena), m_neighbour_keys (&m_arena),
+    m_two_hop_keys (&m_arena), m_processed_keys (&m_arena), m_forwarded_keys (&m_arena), m_advertised_keys (&m_arena),
+    m_advertising_keys (&m_arena), m_flooding_selectors (&m_arena), m_routing_selectors (&m_arena),
+    m_slab_order (&m_arena)
   {
+    m_overflow_count = 0;
+    m_advertised_changed = false;
+    m_advertised_change_count = 0;
+    m_topology_count = 0;
+    m_topology_holes = 0;
+    reserve_sets ();
 
+    m_next_expiry = M_TIME_INFINITE;
+  }
+
+  /********************************************************************
+   * @function  C_OLSR_STATE
+   * @brief     This function is the copy constructor of C_OLSR_STATE.
+   * @param     state.
+   * @return    None.
+   * @note      The sets of the copy live in its own arena.
+   ********************************************************************/
+  C_OLSR_STATE::C_OLSR_STATE (const C_OLSR_STATE& state)
+  :
+#ifdef M_STATIC_MEMORY
+    m_arena (m_storage, sizeof (m_storage)),
+#endif
+    m_link_set (&m_arena), m_two_hop_neighbour_set (&m_arena), m_neighbour_set (&m_arena),
+#ifdef M_TUPLE_COLUMNS
+    m_link_columns (&m_arena), m_neighbour_columns (&m_arena),
+#endif
+    m_advertised_set (&m_arena), m_advertising_remote_router_set (&m_arena), m_router_topology_set (&m_arena), m_processed_msg_set (&m_arena),
+    m_forwarded_msg_set (&m_arena), m_routing_table (&m_arena), m_link_keys (&m_arena), m_neighbour_keys (&m_arena),
+    m_two_hop_keys (&m_arena), m_processed_keys (&m_arena), m_forwarded_keys (&m_arena), m_advertised_keys (&m_arena),
+    m_advertising_keys (&m_arena), m_flooding_selectors (&m_arena), m_routing_selectors (&m_arena),
+    m_slab_order (&m_arena)
+  {
+    m_overflow_count = 0;
+    m_advertised_changed = false;
+    m_advertised_change_count = 0;
+    m_topology_count = 0;
+    m_topology_holes = 0;
+    reserve_sets ();
+    *this = state;
+  }
+
+  /********************************************************************
+   * @function  operator=
+   * @brief     This function copies the tuples of another state.
+   * @param     state.
+   * @return    This state.
+   * @note      pmr containers keep their own memory resource on
+   *            assignment, so the tuples are copied into this arena.
+   ********************************************************************/
+  C_OLSR_STATE&
+  C_OLSR_STATE::operator= (const C_OLSR_STATE& state)
+  {
+    if (this != &state)
+      {
+        m_link_set = state.m_link_set;
+        m_two_hop_neighbour_set = state.m_two_hop_neighbour_set;
+        m_neighbour_set = state.m_neighbour_set;
+#ifdef M_TUPLE_COLUMNS
+        m_link_columns.assign (m_link_set);
+        m_neighbour_columns.assign (m_neighbour_set);
+#endif
+        m_advertising_remote_router_set = state.m_advertising_remote_router_set;
+        m_router_topology_set = state.m_router_topology_set;
+        m_processed_msg_set = state.m_processed_msg_set;
+        m_forwarded_msg_set = state.m_forwarded_msg_set;
+        m_link_keys.assign (m_link_set);
+        m_neighbour_keys.assign (m_neighbour_set);
+        m_two_hop_keys.assign (m_two_hop_neighbour_set);
+        m_processed_keys.assign (m_processed_msg_set);
+        m_forwarded_keys.assign (m_forwarded_msg_set);
+        m_advertised_set = state.m_advertised_set;
+        m_advertised_keys.assign (m_advertised_set);
+        m_advertised_changed = state.m_advertised_changed;
+        m_advertised_change_count = state.m_advertised_change_count;
+        m_advertising_keys.assign (m_advertising_remote_router_set);
+        m_flooding_selectors = state.m_flooding_selectors;
+        m_routing_selectors = state.m_routing_selectors;
+        m_topology_count = state.m_topology_count;
+        m_topology_holes = state.m_topology_holes;
+        m_leader_node = state.m_leader_node;
+        m_routing_table = state.m_routing_table;
+        m_next_expiry = state.m_next_expiry;
+        m_overflow_count = state.m_overflow_count;
+      }
+    return *this;
   }
 
   /********************************************************************
@@ -69,15 +169,7 @@ namespace ns_olsr2_0
    ********************************************************************/
    T_NEIGHBOUR_TUPLE* C_OLSR_STATE::find_neighbour_tuple (const T_NODE_ADDRESS & nbr_addr)
    {
-     for (std::vector<T_NEIGHBOUR_TUPLE>::iterator nbr_iterator = m_neighbour_set.begin ();
-         nbr_iterator != m_neighbour_set.end (); nbr_iterator++)
-           {
-             if (nbr_iterator->n_neighbor_addr == nbr_addr)
-               {
-                 return &(*nbr_iterator);
-               }
-           }
-         return NULL;
+     return find_keyed_tuple (m_neighbour_keys, m_neighbour_set, get_packed_address (nbr_addr));
    }
 
    /********************************************************************
@@ -91,17 +183,143 @@ namespace ns_olsr2_0
    const T_NEIGHBOUR_TUPLE*
    C_OLSR_STATE::find_sym_neighbour_tuple (const T_NODE_ADDRESS &main_addr) const
    {
-     for (std::vector<T_NEIGHBOUR_TUPLE>::const_iterator nbr_iterator = m_neighbour_set.begin ();
-              nbr_iterator != m_neighbour_set.end (); nbr_iterator++)
+     const T_NEIGHBOUR_TUPLE* nbr_tuple = find_keyed_tuple (m_neighbour_keys, m_neighbour_set, get_packed_address (main_addr));
+
+     if ((nbr_tuple != NULL) and (nbr_tuple->n_symmetric == true))
+       {
+         return nbr_tuple;
+       }
+     return NULL;
+   }
+
+  /********************************************************************
+   * @function  insert_neighbour_tuple
+   * @brief     This function inserts a neighbor tuple to neighbor set .
+   * @param     tuple.
+   * @return    Inserted tuple.
+   * @note      None.
+   ********************************************************************/
+  T_NEIGHBOUR_TUPLE*
+  C_OLSR_STATE::insert_neighbour_tuple (const T_NEIGHBOUR_TUPLE &tuple)
+  {
+#ifdef M_STATIC_MEMORY
+    if (m_neighbour_set.size () >= M_STATIC_MAX_NEIGHBOURS)
       {
-        if ((nbr_iterator->n_neighbor_addr == main_addr) and (nbr_iterator->n_symmetric == true))
-          {
-            return &(*nbr_iterator);
-          }
+        m_overflow_count++;
+        return NULL;
       }
-    return NULL;
+#endif
+    m_neighbour_set.push_back(tuple);
+    push_key (m_neighbour_keys, m_neighbour_set);
+#ifdef M_TUPLE_COLUMNS
+    m_neighbour_columns.push_back (tuple);
+#endif
+    m_routing_selectors.set (get_tuple_key (tuple), tuple.n_mpr_selector);
+    track_advertised_neighbour (tuple);
 
-   }
+    return &m_neighbour_set.back();
+  }
+
+  /********************************************************************
+   * @function  update_neighbour_tuple
+   * @brief     This function copies a neighbor tuple changed through
+   *            the pointer of a find or insert to the columns, to the
+   *            routing selector bits and to the advertised set.
+   * @param     tuple - Tuple of the neighbor set.
+   * @return    None.
+   * @note      Must follow every change in place, the scans read the
+   *            columns and the TCs the advertised set, not the tuples.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::update_neighbour_tuple (const T_NEIGHBOUR_TUPLE* tuple)
+  {
+#ifdef M_TUPLE_COLUMNS
+    m_neighbour_columns.set_row (tuple - m_neighbour_set.data (), *tuple);
+#endif
+    m_routing_selectors.set (get_tuple_key (*tuple), tuple->n_mpr_selector);
+    track_advertised_neighbour (*tuple);
+  }
+
+  /********************************************************************
+   * @function  track_advertised_neighbour
+   * @brief     This function adds, updates or removes the advertised
+   *            tuple of a neighbor after a change of its tuple.
+   * @param     tuple - Tuple of the neighbor set.
+   * @return    None.
+   * @note      Only a change of the advertised addresses or metrics
+   *            marks the set as changed.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::track_advertised_neighbour (const T_NEIGHBOUR_TUPLE& tuple)
+  {
+    if ((tuple.n_advertised == false) or (tuple.n_symmetric == false))
+      {
+        untrack_advertised_neighbour (tuple.n_neighbor_addr);
+        return;
+      }
+
+    T_ADVERTISED_NEIGHBOUR_TUPLE* advertised = find_keyed_tuple (m_advertised_keys, m_advertised_set, get_packed_address (tuple.n_neighbor_addr));
+
+    if (advertised == NULL)
+      {
+        T_ADVERTISED_NEIGHBOUR_TUPLE new_tuple;
+
+        new_tuple.a_neighbor_addr = tuple.n_neighbor_addr;
+        new_tuple.a_out_metric = tuple.n_out_metric;
+        new_tuple.a_in_metric = tuple.n_in_metric;
+        m_advertised_set.push_back (new_tuple);
+        push_key (m_advertised_keys, m_advertised_set);
+        m_advertised_changed = true;
+        m_advertised_change_count++;
+      }
+    else if ((advertised->a_out_metric != tuple.n_out_metric) or (advertised->a_in_metric != tuple.n_in_metric))
+      {
+        advertised->a_out_metric = tuple.n_out_metric;
+        advertised->a_in_metric = tuple.n_in_metric;
+        m_advertised_changed = true;
+        m_advertised_change_count++;
+      }
+  }
+
+  /********************************************************************
+   * @function  untrack_advertised_neighbour
+   * @brief     This function removes a neighbor from the advertised
+   *            set.
+   * @param     neighbor_addr.
+   * @return    None.
+   * @note      The last tuple takes the place of the removed one.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::untrack_advertised_neighbour (const T_NODE_ADDRESS& neighbor_addr)
+  {
+    std::size_t idx = m_advertised_keys.find (get_packed_address (neighbor_addr));
+
+    if (idx < m_advertised_set.size ())
+      {
+        m_advertised_keys.swap_erase (idx);
+        m_advertised_set[idx] = m_advertised_set.back ();
+        m_advertised_set.pop_back ();
+        m_advertised_changed = true;
+        m_advertised_change_count++;
+      }
+  }
+
+  /********************************************************************
+   * @function  check_advertised_set_changed
+   * @brief     This function tells whether the advertised set changed
+   *            since its last call.
+   * @param     None.
+   * @return    true if it changed.
+   * @note      Called once per TC, which bumps the ANSN on a change.
+   ********************************************************************/
+  T_BOOL
+  C_OLSR_STATE::check_advertised_set_changed ()
+  {
+    T_BOOL changed = m_advertised_changed;
+
+    m_advertised_changed = false;
+    return changed;
+  }
 
   /********************************************************************
    * @function  get_two_hop_neighbours
@@ -116,6 +334,41 @@ namespace ns_olsr2_0
     return m_two_hop_neighbour_set;
   }
 
+  /********************************************************************
+   * @function  find_two_hop_neighbour_tuple
+   * @brief     This function finds the 2-hop neighbor tuple reached
+   *            through the given 1-hop neighbor.
+   * @param     neighbour, two_hop_neighbour.
+   * @return    Tuple, NULL if not present.
+   * @note      None.
+   ********************************************************************/
+  T_TWO_HOP_NEIGHBOUR_TUPLE*
+  C_OLSR_STATE::find_two_hop_neighbour_tuple (const T_NODE_ADDRESS &neighbour, const T_NODE_ADDRESS &two_hop_neighbour)
+  {
+    return find_keyed_tuple (m_two_hop_keys, m_two_hop_neighbour_set, get_pair_key (neighbour, two_hop_neighbour));
+  }
+
+  /********************************************************************
+   * @function  insert_two_hop_neighbour_tuple
+   * @brief     This function inserts a tuple to the 2-hop neighbor set.
+   * @param     tuple.
+   * @return    None.
+   * @note      None.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::insert_two_hop_neighbour_tuple (const T_TWO_HOP_NEIGHBOUR_TUPLE &tuple)
+  {
+#ifdef M_STATIC_MEMORY
+    if (make_room (m_two_hop_neighbour_set, M_STATIC_MAX_TWO_HOP, M_STATIC_TWO_HOP_POLICY, &T_TWO_HOP_NEIGHBOUR_TUPLE::n2_time) == false)
+      {
+        return;
+      }
+#endif
+    m_two_hop_neighbour_set.push_back(tuple);
+    push_key (m_two_hop_keys, m_two_hop_neighbour_set);
+    update_next_expiry(tuple.n2_time.to_time(get_cur_time()));
+  }
+
   /********************************************************************
    * @function  get_links
    * @brief     This function returns the link set.
@@ -139,16 +392,7 @@ namespace ns_olsr2_0
   T_LINK_TUPLE*
   C_OLSR_STATE::find_link_tuple (const T_NODE_ADDRESS & send_iface_addr)
   {
-    for (std::vector<T_LINK_TUPLE>::iterator link_iterator = m_link_set.begin ();
-        link_iterator != m_link_set.end (); link_iterator++)
-      {
-        if (link_iterator->l_neighbor_iface_addr == send_iface_addr)
-          {
-            return &(*link_iterator);
-          }
-      }
-    return NULL;
-
+    return find_keyed_tuple (m_link_keys, m_link_set, get_packed_address (send_iface_addr));
   }
 
   /********************************************************************
@@ -158,12 +402,98 @@ namespace ns_olsr2_0
    * @return    None.
    * @note      None.
    ********************************************************************/
-  T_LINK_TUPLE&
+  T_LINK_TUPLE*
   C_OLSR_STATE::insert_link_tuple (const T_LINK_TUPLE &new_link_tuple)
   {
+#ifdef M_STATIC_MEMORY
+    if (make_room (m_link_set, M_STATIC_MAX_LINKS, M_STATIC_LINK_POLICY, &T_LINK_TUPLE::l_time) == false)
+      {
+        return NULL;
+      }
+
+    /* An eviction removed a link which may have been a selector */
+    if (m_link_keys.size () > m_link_set.size ())
+      {
+        assign_flooding_selectors ();
+      }
+#endif
     m_link_set.push_back(new_link_tuple);
-    m_link_set.back();
+    push_key (m_link_keys, m_link_set);
+    m_flooding_selectors.set (get_tuple_key (new_link_tuple), new_link_tuple.l_mpr_selector);
+    update_next_expiry(new_link_tuple.l_time.to_time(get_cur_time()));
+    update_sym_expiry(new_link_tuple, get_cur_time());
 
+#ifdef M_TUPLE_COLUMNS
+    /* An eviction removed a row in the middle of the set */
+    if (m_link_columns.size () >= m_link_set.size ())
+      {
+        m_link_columns.assign (m_link_set);
+      }
+    else
+      {
+        m_link_columns.push_back (new_link_tuple);
+      }
+#endif
+
+    return &m_link_set.back();
+
+  }
+
+  /********************************************************************
+   * @function  update_link_tuple
+   * @brief     This function copies a link tuple changed through the
+   *            pointer of a find or insert to the columns and to the
+   *            flooding selector bits.
+   * @param     tuple - Tuple of the link set.
+   * @return    None.
+   * @note      Must follow every change in place, the scans read the
+   *            columns and not the tuples.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::update_link_tuple (const T_LINK_TUPLE* tuple)
+  {
+#ifdef M_TUPLE_COLUMNS
+    m_link_columns.set_row (tuple - m_link_set.data (), *tuple);
+#endif
+    m_flooding_selectors.set (get_tuple_key (*tuple), tuple->l_mpr_selector);
+    update_sym_expiry (*tuple, get_cur_time ());
+  }
+
+  /********************************************************************
+   * @function  update_sym_expiry
+   * @brief     This function lowers the earliest tuple expiry to the
+   *            end of the symmetric time of a link.
+   * @param     tuple, cur_time.
+   * @return    None.
+   * @note      The neighbor sweep run by that expiry clears the
+   *            n_symmetric of the neighbor, which changes the routes.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::update_sym_expiry (const T_LINK_TUPLE& tuple, Time cur_time)
+  {
+    if (tuple.l_sym_time >= cur_time)
+      {
+        update_next_expiry (tuple.l_sym_time.to_time (cur_time) + 1);
+      }
+  }
+
+  /********************************************************************
+   * @function  assign_flooding_selectors
+   * @brief     This function rebuilds the flooding selector bits from
+   *            the link set.
+   * @return    None.
+   * @note      Only for a link erased without its address, the
+   *            expiry sweep clears the bits of the links it erases.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::assign_flooding_selectors ()
+  {
+    m_flooding_selectors.clear ();
+
+    for (const T_LINK_TUPLE& tuple : m_link_set)
+      {
+        m_flooding_selectors.set (get_tuple_key (tuple), tuple.l_mpr_selector);
+      }
   }
 
   /********************************************************************
@@ -171,41 +501,27 @@ namespace ns_olsr2_0
    * @brief     This function checks if the node is a routing mpr selector.
    * @param     send_iface_addr.
    * @return    None.
-   * @note      None.
+   * @note      The bit follows n_mpr_selector through the insert,
+   *            update and erasure of the neighbor tuples.
    ********************************************************************/
 
   T_BOOL C_OLSR_STATE::check_is_routing_mpr_selector(const T_NODE_ADDRESS &address) const
   {
-     for(NeighbourSet::const_iterator nbr_tuple_iter = m_neighbour_set.begin();
-         nbr_tuple_iter != m_neighbour_set.end(); nbr_tuple_iter++)
-       {
-         if((nbr_tuple_iter->n_neighbor_addr == address) and (nbr_tuple_iter->n_mpr_selector == true))
-           {
-             return true;
-           }
-       }
-     return false;
+     return m_routing_selectors.test(get_packed_address(address));
   }
 
   /********************************************************************
    * @function  check_is_flooding_mpr_selector
-   * @brief     This function checks if the node is a routing mpr selector.
+   * @brief     This function checks if the node is a flooding mpr selector.
    * @param     send_iface_addr.
    * @return    None.
-   * @note      None.
+   * @note      The bit follows l_mpr_selector through the insert,
+   *            update and erasure of the link tuples.
    ********************************************************************/
 
   T_BOOL C_OLSR_STATE::check_is_flooding_mpr_selector(const T_NODE_ADDRESS &address) const
   {
-     for(LinkSet::const_iterator link_tuple_iter = m_link_set.begin();
-         link_tuple_iter != m_link_set.end(); link_tuple_iter++)
-       {
-         if((link_tuple_iter->l_neighbor_iface_addr == address) and (link_tuple_iter->l_mpr_selector == true))
-           {
-             return true;
-           }
-       }
-     return false;
+     return m_flooding_selectors.test(get_packed_address(address));
   }
 
 
@@ -224,16 +540,217 @@ namespace ns_olsr2_0
   }
 
   /********************************************************************
-   * @function  get_router_topology_set
-   * @brief     This function returns the router toplogy set.
+   * @function  find_advertising_remote_router_tuple
+   * @brief     This function finds the advertising remote router tuple
+   *            of an originator, which heads its slab of router
+   *            topology tuples.
+   * @param     orig_addr.
+   * @return    The tuple, NULL if none.
+   * @note      None.
+   ********************************************************************/
+  T_ADVERTISING_REMOTE_ROUTER_TUPLE*
+  C_OLSR_STATE::find_advertising_remote_router_tuple (const T_NODE_ADDRESS &orig_addr)
+  {
+    return find_keyed_tuple (m_advertising_keys, m_advertising_remote_router_set, get_packed_address (orig_addr));
+  }
+
+  const T_ADVERTISING_REMOTE_ROUTER_TUPLE*
+  C_OLSR_STATE::find_advertising_remote_router_tuple (const T_NODE_ADDRESS &orig_addr) const
+  {
+    return find_keyed_tuple (m_advertising_keys, m_advertising_remote_router_set, get_packed_address (orig_addr));
+  }
+
+  /********************************************************************
+   * @function  find_newer_advertising_remote_router_tuple
+   * @brief     This function finds the advertising remote router tuple
+   *            of an originator if its ANSN is newer than ansn.
+   * @param     orig_addr, ansn.
+   * @return    The tuple, NULL if none or not newer.
+   * @note      A TC message with such an ANSN is out of date.
+   ********************************************************************/
+  const T_ADVERTISING_REMOTE_ROUTER_TUPLE*
+  C_OLSR_STATE::find_newer_advertising_remote_router_tuple (const T_NODE_ADDRESS &orig_addr, T_UINT16 ansn) const
+  {
+    const T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab = find_advertising_remote_router_tuple (orig_addr);
+
+    return ((slab != NULL) and (is_seq_num_newer (slab->ar_seq_number, ansn) == true)) ? slab : NULL;
+  }
+
+  /********************************************************************
+   * @function  replace_router_topology_slab
+   * @brief     This function replaces the router topology tuples of an
+   *            originator by the ones of a newer TC message.
+   * @param     orig_addr, ansn, expiry, count.
+   * @return    The count tuples of the slab to fill, NULL if a full
+   *            set dropped them.
+   * @note      The old tuples are dropped as a whole, the new ones
+   *            are written over them when they fit the slab.
+   ********************************************************************/
+  T_ROUTER_TOPOLOGY_TUPLE*
+  C_OLSR_STATE::replace_router_topology_slab (const T_NODE_ADDRESS &orig_addr, T_UINT16 ansn, Time expiry, T_UINT32 count)
+  {
+    T_ADVERTISING_REMOTE_ROUTER_TUPLE* slab = find_advertising_remote_router_tuple (orig_addr);
+
+    if (slab == NULL)
+      {
+#ifdef M_STATIC_MEMORY
+        /* A tuple evicted from the set would leave its slab behind, so new originators are dropped */
+        if (m_advertising_remote_router_set.size () >= M_STATIC_MAX_ADVERTISING)
+          {
+            m_overflow_count++;
+            return NULL;
+          }
+#endif
+        T_ADVERTISING_REMOTE_ROUTER_TUPLE tuple = T_ADVERTISING_REMOTE_ROUTER_TUPLE ();
+
+        tuple.ar_orig_addr = orig_addr;
+        m_advertising_remote_router_set.push_back (tuple);
+        push_key (m_advertising_keys, m_advertising_remote_router_set);
+        slab = &m_advertising_remote_router_set.back ();
+      }
+
+    slab->ar_seq_number = ansn;
+    slab->ar_time = C_TUPLE_TIME (expiry);
+    update_next_expiry (expiry);
+
+    m_topology_count -= slab->ar_count;
+    slab->ar_count = 0;
+
+    if (reserve_slab (*slab, count) == false)
+      {
+        return NULL;
+      }
+    slab->ar_count = count;
+    m_topology_count += count;
+
+    return m_router_topology_set.data () + slab->ar_first;
+  }
+
+  /********************************************************************
+   * @function  append_router_topology_tuple
+   * @brief     This function adds a router topology tuple to the slab
+   *            of an originator.
+   * @param     slab.
+   * @return    The tuple to fill, NULL if a full set dropped it.
+   * @note      For the further messages of a TC with the same ANSN.
+   ********************************************************************/
+  T_ROUTER_TOPOLOGY_TUPLE*
+  C_OLSR_STATE::append_router_topology_tuple (T_ADVERTISING_REMOTE_ROUTER_TUPLE &slab)
+  {
+    if (reserve_slab (slab, slab.ar_count + 1) == false)
+      {
+        return NULL;
+      }
+    m_topology_count++;
+
+    return m_router_topology_set.data () + slab.ar_first + (slab.ar_count++);
+  }
+
+  /********************************************************************
+   * @function  reserve_slab
+   * @brief     This function gives a slab room for count tuples.
+   * @param     slab, count.
+   * @return    false if a full set has no room left.
+   * @note      A slab too small moves to the end of the set with twice
+   *            the capacity it needs, keeping its tuples. The place it
+   *            leaves is a hole until the next compaction.
+   ********************************************************************/
+  T_BOOL
+  C_OLSR_STATE::reserve_slab (T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab, T_UINT32 count)
+  {
+    if (count <= slab.ar_capacity)
+      {
+        return true;
+      }
+
+    T_UINT32 capacity = M_TOPOLOGY_MIN_SLAB;
+
+    while (capacity < count)
+      {
+        capacity *= 2;
+      }
+
+    check_topology_holes ();
+#ifdef M_STATIC_MEMORY
+    if ((m_router_topology_set.size () + capacity) > M_STATIC_MAX_TOPOLOGY)
+      {
+        compact_topology ();
+      }
+    if ((m_router_topology_set.size () + capacity) > M_STATIC_MAX_TOPOLOGY)
+      {
+        m_overflow_count++;
+        return false;
+      }
+#endif
+
+    T_UINT32 first = m_router_topology_set.size ();
+
+    m_router_topology_set.resize (first + capacity);
+    std::copy (m_router_topology_set.begin () + slab.ar_first, m_router_topology_set.begin () + slab.ar_first + slab.ar_count,
+               m_router_topology_set.begin () + first);
+
+    m_topology_holes += slab.ar_capacity;
+    slab.ar_first = first;
+    slab.ar_capacity = capacity;
+
+    return true;
+  }
+
+  /********************************************************************
+   * @function  compact_topology
+   * @brief     This function moves the slabs of the router topology
+   *            set down over the holes, in place.
    * @param     None.
    * @return    None.
-   * @note      None.
+   * @note      The slabs keep their order and capacity.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::compact_topology ()
+  {
+    T_UINT32 first = 0;
+
+    m_slab_order.clear ();
+    for (T_UINT32 idx = 0; idx < m_advertising_remote_router_set.size (); idx++)
+      {
+        m_slab_order.push_back (idx);
+      }
+    std::sort (m_slab_order.begin (), m_slab_order.end (), [this](T_UINT32 lhs, T_UINT32 rhs)
+      {
+        return (m_advertising_remote_router_set[lhs].ar_first < m_advertising_remote_router_set[rhs].ar_first);
+      });
+
+    for (T_UINT32 idx : m_slab_order)
+      {
+        T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab = m_advertising_remote_router_set[idx];
+
+        if (slab.ar_first != first)
+          {
+            std::copy (m_router_topology_set.begin () + slab.ar_first, m_router_topology_set.begin () + slab.ar_first + slab.ar_count,
+                       m_router_topology_set.begin () + first);
+            slab.ar_first = first;
+          }
+        first += slab.ar_capacity;
+      }
+    m_router_topology_set.resize (first);
+    m_topology_holes = 0;
+  }
+
+  /********************************************************************
+   * @function  check_topology_holes
+   * @brief     This function compacts the router topology set once
+   *            its holes outnumber the tuples of its slabs.
+   * @param     None.
+   * @return    None.
+   * @note      Each compaction follows as many tuples moved or erased
+   *            as it copies, so its cost is spread over them.
    ********************************************************************/
-  const RouterTopologySet &
-  C_OLSR_STATE::get_router_topology_set () const
+  void
+  C_OLSR_STATE::check_topology_holes ()
   {
-    return m_router_topology_set;
+    if ((m_topology_holes >= M_TOPOLOGY_MIN_HOLES) and (m_topology_holes > (m_router_topology_set.size () - m_topology_holes)))
+      {
+        compact_topology ();
+      }
   }
 
   /********************************************************************
@@ -252,7 +769,7 @@ namespace ns_olsr2_0
     if ((m_leader_node.at (0).is_leader == true) and (m_leader_node.at (0).leader_addr.net_id == 10)
         and (m_leader_node.at (0).leader_addr.node_id == 0x0))
       {
-        std::cout << "successsfully insertted leader node info " << std::endl;
+        M_LOG_DEBUG("Inserted leader node info");
       }
 
   }
@@ -289,16 +806,7 @@ namespace ns_olsr2_0
   T_PROCESSED_MSG_TUPLE*
   C_OLSR_STATE::find_processed_msg_tuple (const T_NODE_ADDRESS &address, uint16_t sequence_number)
   {
-    for (std::vector<T_PROCESSED_MSG_TUPLE>::iterator iterater = m_processed_msg_set.begin ();
-        iterater != m_processed_msg_set.end (); iterater++)
-      {
-        if ((iterater->p_orig_addr == address) and (iterater->p_seq_number == sequence_number))
-          {
-            return &(*iterater);
-          }
-
-      }
-    return NULL;
+    return find_keyed_tuple (m_processed_keys, m_processed_msg_set, get_sequence_key (address, sequence_number));
   }
 
   /********************************************************************
@@ -310,7 +818,15 @@ namespace ns_olsr2_0
    ********************************************************************/
   void C_OLSR_STATE::insert_processed_msg_tuple (const T_PROCESSED_MSG_TUPLE &tuple)
   {
+#ifdef M_STATIC_MEMORY
+    if (make_room (m_processed_msg_set, M_STATIC_MAX_PROCESSED_MSGS, M_STATIC_PROCESSED_MSG_POLICY, &T_PROCESSED_MSG_TUPLE::p_time) == false)
+      {
+        return;
+      }
+#endif
     m_processed_msg_set.push_back(tuple);
+    push_key (m_processed_keys, m_processed_msg_set);
+    update_next_expiry(tuple.p_time.to_time(get_cur_time()));
   }
 
   /********************************************************************
@@ -323,17 +839,7 @@ namespace ns_olsr2_0
   T_FORWARDED_MSG_TUPLE*
   C_OLSR_STATE::find_forwarded_msg_tuple (const T_NODE_ADDRESS &address, T_UINT16 sequence_number)
   {
-    for (std::vector<T_FORWARDED_MSG_TUPLE>::iterator iterater = m_forwarded_msg_set.begin ();
-        iterater != m_forwarded_msg_set.end (); iterater++)
-      {
-        if ((iterater->f_orig_addr == address) and (iterater->f_seq_number == sequence_number))
-          {
-            return &(*iterater);
-          }
-
-      }
-    return NULL;
-
+    return find_keyed_tuple (m_forwarded_keys, m_forwarded_msg_set, get_sequence_key (address, sequence_number));
   }
 
   /********************************************************************
@@ -345,7 +851,15 @@ namespace ns_olsr2_0
    ********************************************************************/
   void C_OLSR_STATE::insert_forwarded_msg_tuple (const T_FORWARDED_MSG_TUPLE &tuple)
   {
+#ifdef M_STATIC_MEMORY
+    if (make_room (m_forwarded_msg_set, M_STATIC_MAX_FORWARDED_MSGS, M_STATIC_FORWARDED_MSG_POLICY, &T_FORWARDED_MSG_TUPLE::f_time) == false)
+      {
+        return;
+      }
+#endif
     m_forwarded_msg_set.push_back(tuple);
+    push_key (m_forwarded_keys, m_forwarded_msg_set);
+    update_next_expiry(tuple.f_time.to_time(get_cur_time()));
   }
 
   /********************************************************************
@@ -353,11 +867,17 @@ namespace ns_olsr2_0
    * @brief     This function initializes all the OLSR state tuples.
    * @param     None.
    * @return    None.
-   * @note      None.
+   * @note      The tuples are trivially destructible, so each set is
+   *            dropped with one deallocation and the arena is then
+   *            released as a whole, whatever the number of tuples.
+   *            Only the routing table map frees its nodes one by one.
+   *            The static build keeps the buffers and only empties the
+   *            sets.
    ********************************************************************/
   void
   C_OLSR_STATE::init_state_tuples ()
   {
+#ifdef M_STATIC_MEMORY
     m_link_set.clear ();
     m_neighbour_set.clear ();
     m_two_hop_neighbour_set.clear ();
@@ -365,171 +885,369 @@ namespace ns_olsr2_0
     m_router_topology_set.clear ();
     m_processed_msg_set.clear ();
     m_forwarded_msg_set.clear ();
+    m_routing_table.clear ();
+    m_link_keys.clear ();
+    m_neighbour_keys.clear ();
+    m_two_hop_keys.clear ();
+    m_processed_keys.clear ();
+    m_forwarded_keys.clear ();
+    m_advertised_set.clear ();
+    m_advertised_keys.clear ();
+    m_advertising_keys.clear ();
+    m_slab_order.clear ();
+    m_flooding_selectors.clear ();
+    m_routing_selectors.clear ();
+#ifdef M_TUPLE_COLUMNS
+    m_link_columns.clear ();
+    m_neighbour_columns.clear ();
+#endif
+#else
+    reset_set (m_link_set);
+    reset_set (m_neighbour_set);
+    reset_set (m_two_hop_neighbour_set);
+    reset_set (m_advertising_remote_router_set);
+    reset_set (m_router_topology_set);
+    reset_set (m_processed_msg_set);
+    reset_set (m_forwarded_msg_set);
+    reset_set (m_routing_table);
+    m_link_keys.reset ();
+    m_neighbour_keys.reset ();
+    m_two_hop_keys.reset ();
+    m_processed_keys.reset ();
+    m_forwarded_keys.reset ();
+    reset_set (m_advertised_set);
+    m_advertised_keys.reset ();
+    m_advertising_keys.reset ();
+    reset_set (m_slab_order);
+    m_flooding_selectors.reset ();
+    m_routing_selectors.reset ();
+#ifdef M_TUPLE_COLUMNS
+    m_link_columns.reset ();
+    m_neighbour_columns.reset ();
+#endif
+
+    m_arena.release ();
+#endif
+
     m_leader_node[0].is_leader = false;
     m_leader_node[0].leader_addr.net_id = 0xff;
     m_leader_node[0].leader_addr.node_id == 0xff;
 
-    m_routing_table.clear ();
+    m_advertised_changed = false;
+    m_topology_count = 0;
+    m_topology_holes = 0;
+
+    m_next_expiry = M_TIME_INFINITE;
+  }
+
+  /********************************************************************
+   * @function  reserve_sets
+   * @brief     This function gives each set the buffer of its full
+   *            capacity.
+   * @param     None.
+   * @return    None.
+   * @note      Called once at construction, the inserts never grow the
+   *            sets afterwards, so the static build allocates nothing
+   *            after start up. Does nothing in the heap build.
+   ********************************************************************/
+  void
+  C_OLSR_STATE::reserve_sets ()
+  {
+#ifdef M_STATIC_MEMORY
+    m_link_set.reserve (M_STATIC_MAX_LINKS);
+    m_neighbour_set.reserve (M_STATIC_MAX_NEIGHBOURS);
+    m_two_hop_neighbour_set.reserve (M_STATIC_MAX_TWO_HOP);
+    m_advertising_remote_router_set.reserve (M_STATIC_MAX_ADVERTISING);
+    m_router_topology_set.reserve (M_STATIC_MAX_TOPOLOGY);
+    m_processed_msg_set.reserve (M_STATIC_MAX_PROCESSED_MSGS);
+    m_forwarded_msg_set.reserve (M_STATIC_MAX_FORWARDED_MSGS);
+    m_link_keys.reserve (M_STATIC_MAX_LINKS);
+    m_neighbour_keys.reserve (M_STATIC_MAX_NEIGHBOURS);
+    m_two_hop_keys.reserve (M_STATIC_MAX_TWO_HOP);
+    m_processed_keys.reserve (M_STATIC_MAX_PROCESSED_MSGS);
+    m_forwarded_keys.reserve (M_STATIC_MAX_FORWARDED_MSGS);
+    m_advertised_set.reserve (M_STATIC_MAX_NEIGHBOURS);
+    m_advertised_keys.reserve (M_STATIC_MAX_NEIGHBOURS);
+    m_advertising_keys.reserve (M_STATIC_MAX_ADVERTISING);
+    m_slab_order.reserve (M_STATIC_MAX_ADVERTISING);
+    m_flooding_selectors.reserve (M_STATIC_MAX_LINKS);
+    m_routing_selectors.reserve (M_STATIC_MAX_NEIGHBOURS);
+#ifdef M_TUPLE_COLUMNS
+    m_link_columns.reserve (M_STATIC_MAX_LINKS);
+    m_neighbour_columns.reserve (M_STATIC_MAX_NEIGHBOURS);
+#endif
+#endif
+  }
+
+  /********************************************************************
+      * @function  update_next_expiry
+      * @brief     This function lowers the earliest tuple expiry when a
+      *            tuple expiring earlier is inserted
+      * @param     expiry_time.
+      * @return    None.
+      * @note      Validity times are only extended in place, so the
+      *            value stays a lower bound until the next sweep.
+  ********************************************************************/
+  void C_OLSR_STATE::update_next_expiry(Time expiry_time)
+  {
+    if(expiry_time < m_next_expiry)
+      {
+        m_next_expiry = expiry_time;
+      }
+  }
+
+  /********************************************************************
+      * @function  compute_next_expiry
+      * @brief     This function finds the earliest expiry among the
+      *            tuples having a validity time
+      * @return    None.
+      * @note      The router topology tuples expire with their slab.
+  ********************************************************************/
+  void C_OLSR_STATE::compute_next_expiry()
+  {
+    Time cur_time = get_cur_time();
+
+    m_next_expiry = M_TIME_INFINITE;
+
+    for(LinkSet::const_iterator iter = m_link_set.begin(); iter != m_link_set.end(); iter++)
+      {
+        update_next_expiry(iter->l_time.to_time(cur_time));
+        update_sym_expiry(*iter, cur_time);
+      }
+    for(TwoHopNeighborSet::const_iterator iter = m_two_hop_neighbour_set.begin(); iter != m_two_hop_neighbour_set.end(); iter++)
+      {
+        update_next_expiry(iter->n2_time.to_time(cur_time));
+      }
+    for(AdvertisingRemoteRouterSet::const_iterator iter = m_advertising_remote_router_set.begin(); iter != m_advertising_remote_router_set.end(); iter++)
+      {
+        update_next_expiry(iter->ar_time.to_time(cur_time));
+      }
+    for(ProcessedMsgSet::const_iterator iter = m_processed_msg_set.begin(); iter != m_processed_msg_set.end(); iter++)
+      {
+        update_next_expiry(iter->p_time.to_time(cur_time));
+      }
+    for(ForwardedMsgSet::const_iterator iter = m_forwarded_msg_set.begin(); iter != m_forwarded_msg_set.end(); iter++)
+      {
+        update_next_expiry(iter->f_time.to_time(cur_time));
+      }
   }
 
   /********************************************************************
       * @function  check_link_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
+      * @brief     This function erases the link tuples whose validity
+      *            time has expired
       * @return    None.
-      * @note      None.
+      * @note      With the columns, one kernel pass over the validity
+      *            times finds the links kept, which are then moved
+      *            down in one pass instead of one erase per link.
   ********************************************************************/
   void C_OLSR_STATE::check_link_set_timeout()
   {
-    ;
+    Time cur_time = get_cur_time();
+
+#ifdef M_TUPLE_COLUMNS
+    T_MATCH_MASK valid_mask;
+
+    m_link_columns.get_valid_mask(cur_time, valid_mask);
+
+    if(get_match_count(valid_mask) != m_link_set.size())
+      {
+        for(std::size_t idx = 0; idx < m_link_set.size(); idx++)
+          {
+            if(get_match(valid_mask, idx) == false)
+              {
+                m_flooding_selectors.set(get_tuple_key(m_link_set[idx]), false);
+              }
+          }
+        compact_column(m_link_set, valid_mask);
+        m_link_columns.compact(valid_mask);
+        m_link_keys.compact(valid_mask);
+      }
+#else
+    for(const T_LINK_TUPLE& tuple : m_link_set)
+      {
+        if(tuple.l_time <= cur_time)
+          {
+            m_flooding_selectors.set(get_tuple_key(tuple), false);
+          }
+      }
+    sweep_set(m_link_set, m_link_keys, &T_LINK_TUPLE::l_time, cur_time);
+#endif
   }
 
   /********************************************************************
       * @function  check_one_hop_neigh_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
-      * @return    None.
-      * @note      None.
+      * @brief     This function erases the neighbor tuples which have
+      *            no link tuple left and follows the lapse of the
+      *            symmetric time of the others
+      * @return    true if a tuple is erased or changes its symmetry.
+      * @note      Must run after check_link_set_timeout.
   ********************************************************************/
-  void C_OLSR_STATE::check_one_hop_neigh_set_timeout()
+  T_BOOL C_OLSR_STATE::check_one_hop_neigh_set_timeout()
   {
-    ;
+    Time cur_time = get_cur_time();
+
+    T_BOOL erased = false;
+    T_BOOL changed = false;
+
+    for(NeighbourSet::iterator iter = m_neighbour_set.begin(); iter != m_neighbour_set.end();)
+      {
+        const T_LINK_TUPLE* link_tuple = find_link_tuple(iter->n_neighbor_addr);
+
+        if(link_tuple == NULL)
+          {
+            untrack_advertised_neighbour(iter->n_neighbor_addr);
+            m_routing_selectors.set(get_tuple_key(*iter), false);
+            iter = m_neighbour_set.erase(iter);
+            erased = true;
+          }
+        else
+          {
+            if(iter->n_symmetric != (link_tuple->l_sym_time >= cur_time))
+              {
+                iter->n_symmetric = (link_tuple->l_sym_time >= cur_time);
+                changed = true;
+                if(erased == false)
+                  {
+                    update_neighbour_tuple(&(*iter));
+                  }
+                else
+                  {
+                    track_advertised_neighbour(*iter);
+                  }
+              }
+            iter++;
+          }
+      }
+
+    /* The rows after an erased tuple moved down */
+    if(erased == true)
+      {
+        m_neighbour_keys.assign(m_neighbour_set);
+#ifdef M_TUPLE_COLUMNS
+        m_neighbour_columns.assign(m_neighbour_set);
+#endif
+      }
+
+    return (erased or changed);
   }
 
   /********************************************************************
       * @function  check_two_hop_neigh_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
+      * @brief     This function erases the 2-hop neighbor tuples whose
+      *            validity time has expired
       * @return    None.
       * @note      None.
   ********************************************************************/
   void C_OLSR_STATE::check_two_hop_neigh_set_timeout()
   {
-    ;
+    sweep_set(m_two_hop_neighbour_set, m_two_hop_keys, &T_TWO_HOP_NEIGHBOUR_TUPLE::n2_time, get_cur_time());
   }
 
   /********************************************************************
       * @function  check_advt_router_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
+      * @brief     This function erases the advertising remote router
+      *            tuples whose validity time has expired, with their
+      *            slab
       * @return    None.
-      * @note      None.
+      * @note      Only looked up by key, so the last tuple takes
+      *            the place of each erased one.
   ********************************************************************/
   void C_OLSR_STATE::check_advt_router_set_timeout()
   {
-    ;
+    Time cur_time = get_cur_time();
+
+    for(std::size_t idx = 0; idx < m_advertising_remote_router_set.size();)
+      {
+        const T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab = m_advertising_remote_router_set[idx];
+
+        if(slab.ar_time <= cur_time)
+          {
+            m_topology_count -= slab.ar_count;
+            m_topology_holes += slab.ar_capacity;
+
+            m_advertising_keys.swap_erase(idx);
+            m_advertising_remote_router_set[idx] = m_advertising_remote_router_set.back();
+            m_advertising_remote_router_set.pop_back();
+          }
+        else
+          {
+            idx++;
+          }
+      }
   }
 
   /********************************************************************
       * @function  check_router_topo_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
+      * @brief     This function reclaims the router topology tuples of
+      *            the expired slabs
       * @return    None.
-      * @note      None.
+      * @note      Must run after check_advt_router_set_timeout.
   ********************************************************************/
   void C_OLSR_STATE::check_router_topo_set_timeout()
   {
-    ;
+    if(m_advertising_remote_router_set.empty() == true)
+      {
+        m_router_topology_set.clear();
+        m_topology_holes = 0;
+      }
+    else
+      {
+        check_topology_holes();
+      }
   }
 
   /********************************************************************
       * @function  check_processed_msg_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
+      * @brief     This function erases the processed message tuples
+      *            whose validity time has expired
       * @return    None.
-      * @note      None.
+      * @note      Only looked up by key, so the last tuple takes
+      *            the place of each erased one.
   ********************************************************************/
   void C_OLSR_STATE::check_processed_msg_set_timeout()
   {
-    ;
+    sweep_unordered_set(m_processed_msg_set, m_processed_keys, &T_PROCESSED_MSG_TUPLE::p_time, get_cur_time());
   }
 
   /********************************************************************
       * @function  check_forwarded_msg_set_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
+      * @brief     This function erases the forwarded message tuples
+      *            whose validity time has expired
       * @return    None.
-      * @note      None.
+      * @note      Only looked up by key, so the last tuple takes
+      *            the place of each erased one.
   ********************************************************************/
   void C_OLSR_STATE::check_forwarded_msg_set_timeout()
   {
-    ;
+    sweep_unordered_set(m_forwarded_msg_set, m_forwarded_keys, &T_FORWARDED_MSG_TUPLE::f_time, get_cur_time());
   }
 
   /********************************************************************
       * @function  check_tables_timeout
-      * @brief     This function increments the message sequence
-      *            number and sends
-      * @return    None.
+      * @brief     This function erases the expired tuples of all the
+      *            sets and finds the next expiry
+      * @return    true if any neighborhood or topology tuple is erased
+      *            or a neighbor changes its symmetry.
       * @note      None.
   ********************************************************************/
-  void C_OLSR_STATE::check_tables_timeout()
+  T_BOOL C_OLSR_STATE::check_tables_timeout()
   {
+    size_t topology_size = m_link_set.size() + m_neighbour_set.size() + m_two_hop_neighbour_set.size()
+        + m_advertising_remote_router_set.size() + m_topology_count;
+
     check_link_set_timeout();
-    check_one_hop_neigh_set_timeout();
+    T_BOOL neighbours_changed = check_one_hop_neigh_set_timeout();
     check_two_hop_neigh_set_timeout();
     check_advt_router_set_timeout();
     check_router_topo_set_timeout();
     check_processed_msg_set_timeout();
     check_forwarded_msg_set_timeout();
 
-  }
-
-  void
-  C_OLSR_STATE::fill_tuples ()
-  {
-    for (int i = 0; i < 5; i++)
-      {
-        T_LINK_TUPLE loc_link_tup;
-        T_NEIGHBOUR_TUPLE loc_nbr_tup;
-
-        loc_link_tup.l_mpr_selector = true;
-        loc_link_tup.l_neighbor_iface_addr.net_id = 10;
-        loc_link_tup.l_neighbor_iface_addr.node_id = i + 5;
-        loc_link_tup.l_heard_time = i + 9;
-        loc_link_tup.l_time = i + 9;
-        loc_link_tup.l_sym_time = i + 9;
-
-        loc_nbr_tup.n_neighbor_addr = loc_link_tup.l_neighbor_iface_addr;
-
-        if ((i == 1) or (i == 3))
-          {
+    compute_next_expiry();
 
-            loc_link_tup.l_in_metric = 0.9;
-            loc_link_tup.l_out_metric = 0.8;
-            loc_link_tup.l_status = SYMMETRIC_LINK;
-
-            loc_nbr_tup.n_flooding_mpr = false;
-            loc_nbr_tup.n_routing_mpr = true;
-            loc_nbr_tup.n_advertised = true;
-            loc_nbr_tup.n_in_metric = loc_link_tup.l_in_metric;
-            loc_nbr_tup.n_out_metric = loc_link_tup.l_out_metric;
-            loc_nbr_tup.n_mpr_selector = true;
-            loc_nbr_tup.n_symmetric = true;
-            loc_nbr_tup.n_willingness.willingness = 0x33;
-
-          }
-        else
-          {
-            loc_link_tup.l_in_metric = 0.6;
-            loc_link_tup.l_out_metric = 0.9;
-            loc_link_tup.l_status = SYMMETRIC_LINK;
-
-            loc_nbr_tup.n_flooding_mpr = true;
-            loc_nbr_tup.n_routing_mpr = false;
-            loc_nbr_tup.n_advertised = false;
-            loc_nbr_tup.n_in_metric = loc_link_tup.l_in_metric;
-            loc_nbr_tup.n_out_metric = loc_link_tup.l_out_metric;
-            loc_nbr_tup.n_mpr_selector = false;
-            loc_nbr_tup.n_symmetric = true;
-            loc_nbr_tup.n_willingness.willingness = 0x32;
-
-          }
-
-        m_link_set.push_back (loc_link_tup);
-        m_neighbour_set.push_back (loc_nbr_tup);
-
-      }
+    return ((neighbours_changed == true) or (topology_size != (m_link_set.size() + m_neighbour_set.size() + m_two_hop_neighbour_set.size()
+        + m_advertising_remote_router_set.size() + m_topology_count)));
 
   }
 
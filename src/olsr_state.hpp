@@ -23,36 +23,275 @@
 
 #include <map>
 #include "olsr_types.hpp"    /* Include file for OLSR types functionalities */
+#include "olsr_arena.hpp"    /* Include file for the tuple arena */
+#include "olsr_static_memory.hpp"    /* Include file for the set capacities of the static build */
+#include "olsr_tuple_columns.hpp"    /* Include file for the link and neighbor columns */
+#include "olsr_key_index.hpp"        /* Include file for the key index of the sets */
 
 namespace ns_olsr2_0
 {
+#define M_TOPOLOGY_MIN_SLAB     4       /* Smallest capacity of a router topology slab, in tuples */
+#define M_TOPOLOGY_MIN_HOLES    64      /* Holes of the router topology set left before it is compacted */
+
+#ifdef M_STATIC_MEMORY
+#ifdef M_TUPLE_COLUMNS
+#define M_STATIC_COLUMN_BYTES   (C_LINK_COLUMNS::get_reserved_bytes(M_STATIC_MAX_LINKS) + C_NEIGHBOUR_COLUMNS::get_reserved_bytes(M_STATIC_MAX_NEIGHBOURS))
+#else
+#define M_STATIC_COLUMN_BYTES   0
+#endif
+
+#define M_STATIC_KEY_BYTES      (C_KEY_INDEX<T_UINT16>::get_reserved_bytes(M_STATIC_MAX_LINKS) + C_KEY_INDEX<T_UINT16>::get_reserved_bytes(M_STATIC_MAX_NEIGHBOURS) \
+                               + C_KEY_INDEX<T_UINT32>::get_reserved_bytes(M_STATIC_MAX_TWO_HOP) + C_KEY_INDEX<T_UINT32>::get_reserved_bytes(M_STATIC_MAX_PROCESSED_MSGS) \
+                               + C_KEY_INDEX<T_UINT32>::get_reserved_bytes(M_STATIC_MAX_FORWARDED_MSGS) + C_KEY_INDEX<T_UINT16>::get_reserved_bytes(M_STATIC_MAX_ADVERTISING) \
+                               + C_KEY_INDEX<T_UINT16>::get_reserved_bytes(M_STATIC_MAX_NEIGHBOURS) \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_ADVERTISING * sizeof(T_UINT32)) \
+                               + C_ADDRESS_BITMAP::get_reserved_bytes(M_STATIC_MAX_LINKS) + C_ADDRESS_BITMAP::get_reserved_bytes(M_STATIC_MAX_NEIGHBOURS))
+
+#define M_MAP_NODE_OVERHEAD     (4 * sizeof(void*))     /* Color and links of a std::map node */
+
+/* Arena bytes of all the sets filled to their capacity */
+#define M_STATIC_STATE_BYTES    (C_OLSR_ARENA::get_block_size(M_STATIC_MAX_LINKS * sizeof(T_LINK_TUPLE))                           \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_NEIGHBOURS * sizeof(T_NEIGHBOUR_TUPLE))                 \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_NEIGHBOURS * sizeof(T_ADVERTISED_NEIGHBOUR_TUPLE))      \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_TWO_HOP * sizeof(T_TWO_HOP_NEIGHBOUR_TUPLE))            \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_ADVERTISING * sizeof(T_ADVERTISING_REMOTE_ROUTER_TUPLE)) \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_TOPOLOGY * sizeof(T_ROUTER_TOPOLOGY_TUPLE))             \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_PROCESSED_MSGS * sizeof(T_PROCESSED_MSG_TUPLE))         \
+                               + C_OLSR_ARENA::get_block_size(M_STATIC_MAX_FORWARDED_MSGS * sizeof(T_FORWARDED_MSG_TUPLE))         \
+                               + (M_STATIC_MAX_ROUTES * C_OLSR_ARENA::get_block_size(M_MAP_NODE_OVERHEAD + sizeof(RoutingTable::value_type)))   \
+                               + M_STATIC_COLUMN_BYTES + M_STATIC_KEY_BYTES)
+#endif
 
   class C_OLSR_STATE
   {
 
   public:
     C_OLSR_STATE();
+    C_OLSR_STATE(const C_OLSR_STATE& state);                /* The copy allocates from its own arena */
+    C_OLSR_STATE& operator=(const C_OLSR_STATE& state);     /* Copies the tuples, the arena stays the one of this state */
     virtual ~C_OLSR_STATE();
 
 
   private:
+
+    friend class C_OLSR_SELF_CHECK;                                 /* Forces the slab moves and the compaction */
+
+#ifdef M_STATIC_MEMORY
+    alignas(std::max_align_t) unsigned char m_storage[M_STATIC_STATE_BYTES];   /* Memory of the arena, part of the instance */
+#endif
+
+    C_OLSR_ARENA m_arena;                                           /* Memory of all the sets below, declared first so that it outlives them */
+
     LinkSet m_link_set;                                             /* link set of current OLSR instance */
     TwoHopNeighborSet m_two_hop_neighbour_set;                      /* two hop neighbor set of current OLSR instance */
     NeighbourSet m_neighbour_set;                                   /* one hop neighbor set of current OLSR instance */
 
-    AdvertisingRemoteRouterSet m_advertising_remote_router_set;     /* advertising remote router set of current OLSR instance */
+#ifdef M_TUPLE_COLUMNS
+    C_LINK_COLUMNS m_link_columns;                                  /* Columns of m_link_set, row for row */
+    C_NEIGHBOUR_COLUMNS m_neighbour_columns;                        /* Columns of m_neighbour_set, row for row */
+#endif
 
-    RouterTopologySet m_router_topology_set;                        /* router topology set of current OLSR instance */
+    AdvertisedNeighbourSet m_advertised_set;                        /* Neighbors advertised in the TC messages, follows m_neighbour_set */
+
+    AdvertisingRemoteRouterSet m_advertising_remote_router_set;     /* advertising remote router set of current OLSR instance, one tuple per slab */
+
+    RouterTopologySet m_router_topology_set;                        /* router topology set of current OLSR instance, as slabs of ar_capacity tuples */
 
     ProcessedMsgSet m_processed_msg_set;                            /* router topology set of current OLSR instance */
     ForwardedMsgSet m_forwarded_msg_set;                            /* router topology set of current OLSR instance */
 
     std::array<T_LEADER_TUPLE, 1> m_leader_node;
 
-    std::map<T_NODE_ADDRESS, T_ROUTING_TABLE_ENTRY> m_routing_table;
+    RoutingTable m_routing_table;
+
+    C_KEY_INDEX<T_UINT16> m_link_keys;                              /* Keys of m_link_set, row for row */
+    C_KEY_INDEX<T_UINT16> m_neighbour_keys;                         /* Keys of m_neighbour_set, row for row */
+    C_KEY_INDEX<T_UINT32> m_two_hop_keys;                           /* Keys of m_two_hop_neighbour_set, row for row */
+    C_KEY_INDEX<T_UINT32> m_processed_keys;                         /* Keys of m_processed_msg_set, row for row */
+    C_KEY_INDEX<T_UINT32> m_forwarded_keys;                         /* Keys of m_forwarded_msg_set, row for row */
+    C_KEY_INDEX<T_UINT16> m_advertised_keys;                        /* Keys of m_advertised_set, row for row */
+    C_KEY_INDEX<T_UINT16> m_advertising_keys;                       /* Keys of m_advertising_remote_router_set, row for row */
+
+    C_ADDRESS_BITMAP m_flooding_selectors;                          /* Links whose neighbor selected this node as flooding MPR */
+    C_ADDRESS_BITMAP m_routing_selectors;                           /* Neighbors which selected this node as routing MPR */
+
+    std::pmr::vector<T_UINT32> m_slab_order;                        /* Advertising remote router tuples by slab position, for the compaction */
+
+    T_BOOL m_advertised_changed;                                    /* The advertised set changed since the last TC */
+
+    T_UINT32 m_advertised_change_count;                             /* Changes of the advertised set, never reset */
+
+    T_UINT32 m_topology_count;                                      /* Router topology tuples of all the slabs */
+    T_UINT32 m_topology_holes;                                      /* Router topology tuples of the slabs moved or erased */
+
+    Time m_next_expiry;                                             /* Lower bound of the earliest tuple expiry */
+
+    T_UINT64 m_overflow_count;                                      /* Insertions into a full set, static build only */
+
+    void update_next_expiry(Time expiry_time);                      /* Lowers the earliest tuple expiry */
+
+    void compute_next_expiry();                                     /* Finds the earliest tuple expiry */
+
+    void update_sym_expiry(const T_LINK_TUPLE& tuple, Time cur_time);  /* Lowers the earliest tuple expiry to the lapse of a symmetric link */
+
+    /* Empties a set and drops its buffer, which goes back to the arena */
+    template <typename T_SET>
+    void
+    reset_set (T_SET& set)
+    {
+      T_SET(&m_arena).swap(set);
+    }
+
+    void reserve_sets();                                            /* Takes the full capacity of each set, static build only */
+
+    void track_advertised_neighbour(const T_NEIGHBOUR_TUPLE& tuple);  /* Follows a neighbor tuple changed in the advertised set */
+
+    void untrack_advertised_neighbour(const T_NODE_ADDRESS& neighbor_addr);  /* Drops an erased neighbor from the advertised set */
+
+    void assign_flooding_selectors();                               /* Rebuilds the flooding selector bits from the link set */
+
+    T_BOOL reserve_slab(T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab, T_UINT32 count);  /* Gives a slab room for count tuples, false if a full set has none */
+
+    void compact_topology();                                        /* Moves the slabs down over the holes */
+
+    void check_topology_holes();                                    /* Compacts the router topology set once its holes outnumber its tuples */
+
+    /* Adds the key of the tuple appended to a set */
+    template <typename T_KEY, typename T_SET>
+    void
+    push_key (C_KEY_INDEX<T_KEY>& index, const T_SET& set)
+    {
+      /* An eviction removed a row in the middle of the set */
+      if(index.size() >= set.size())
+        {
+          index.assign(set);
+        }
+      else
+        {
+          index.push_back(get_tuple_key(set.back()));
+        }
+    }
+
+    /* Erases the tuples of a set whose expiry time has passed, and their keys, in one pass each */
+    template <typename T_KEY, typename T_SET, typename T_TUPLE>
+    void
+    sweep_set (T_SET& set, C_KEY_INDEX<T_KEY>& index, C_TUPLE_TIME T_TUPLE::*expiry, Time cur_time)
+    {
+      std::size_t kept = 0;
+
+      index.erase_rows([&](std::size_t row)
+        {
+          return (set[row].*expiry <= cur_time);
+        });
+
+      for(std::size_t idx = 0; idx < set.size(); idx++)
+        {
+          if((set[idx].*expiry <= cur_time) == false)
+            {
+              set[kept++] = set[idx];
+            }
+        }
+      set.resize(kept);
+    }
+
+    /* Erases the expired tuples of a set whose order does not matter, moving the last tuple into each erased one */
+    template <typename T_KEY, typename T_SET, typename T_TUPLE>
+    void
+    sweep_unordered_set (T_SET& set, C_KEY_INDEX<T_KEY>& index, C_TUPLE_TIME T_TUPLE::*expiry, Time cur_time)
+    {
+      for(std::size_t idx = 0; idx < set.size();)
+        {
+          if(set[idx].*expiry <= cur_time)
+            {
+              index.swap_erase(idx);
+              set[idx] = set.back();
+              set.pop_back();
+            }
+          else
+            {
+              idx++;
+            }
+        }
+    }
+
+    /* Finds the tuple of a key in a set */
+    template <typename T_KEY, typename T_SET>
+    static typename T_SET::value_type*
+    find_keyed_tuple (const C_KEY_INDEX<T_KEY>& index, T_SET& set, T_KEY key)
+    {
+      std::size_t idx = index.find(key);
+
+      return (idx < set.size()) ? &set[idx] : NULL;
+    }
+
+    template <typename T_KEY, typename T_SET>
+    static const typename T_SET::value_type*
+    find_keyed_tuple (const C_KEY_INDEX<T_KEY>& index, const T_SET& set, T_KEY key)
+    {
+      std::size_t idx = index.find(key);
+
+      return (idx < set.size()) ? &set[idx] : NULL;
+    }
+
+    /* Checks that a set can take one more tuple, applying the overflow policy if it is full */
+    template <typename T_SET, typename T_TUPLE>
+    T_BOOL
+    make_room (T_SET& set, std::size_t capacity, E_OVERFLOW_POLICY policy, C_TUPLE_TIME T_TUPLE::*expiry)
+    {
+      if(set.size() < capacity)
+        {
+          return true;
+        }
+
+      m_overflow_count++;
+
+      if(policy == OVERFLOW_DROP_NEW)
+        {
+          return false;
+        }
+
+      typename T_SET::iterator earliest = set.begin();
+
+      for(typename T_SET::iterator iter = set.begin(); iter != set.end(); iter++)
+        {
+          if(((*iter).*expiry) < ((*earliest).*expiry))
+            {
+              earliest = iter;
+            }
+        }
+      set.erase(earliest);
+
+      return true;
+    }
 
   public:
 
+    const C_OLSR_ARENA&
+    get_arena () const
+    {
+      return m_arena;
+    }
+
+    T_UINT64
+    get_overflow_count () const
+    {
+      return m_overflow_count;
+    }
+
+#ifdef M_TUPLE_COLUMNS
+    const C_LINK_COLUMNS&
+    get_link_columns () const
+    {
+      return m_link_columns;
+    }
+
+    const C_NEIGHBOUR_COLUMNS&
+    get_neighbour_columns () const
+    {
+      return m_neighbour_columns;
+    }
+#endif
+
 
     /* -------------------------------  [  Link set  ] ------------------------------------ */
 
@@ -70,8 +309,11 @@ namespace ns_olsr2_0
     /* Erases a link tuple.                                            */
     void erase_link_tuple (const T_LINK_TUPLE &tuple);
 
-    /* Inserts a link tuple.                                           */
-    T_LINK_TUPLE& insert_link_tuple (const T_LINK_TUPLE &new_link_tuple);
+    /* Inserts a link tuple, NULL if a full set dropped it.            */
+    T_LINK_TUPLE* insert_link_tuple (const T_LINK_TUPLE &new_link_tuple);
+
+    /* Publishes the changes made to a tuple found in the set.         */
+    void update_link_tuple (const T_LINK_TUPLE* tuple);
 
     void check_link_set_timeout();
   
@@ -90,10 +332,30 @@ namespace ns_olsr2_0
     /* Erases a neighbor tuple.                                        */
     void erase_neighbour_tuple (const T_NEIGHBOUR_TUPLE &neighbour_tuple);
 
-    /* Inserts a neighbor tuple.                                       */
-    void insert_neighbour_tuple (const T_NEIGHBOUR_TUPLE &tuple);
+    /* Inserts a neighbor tuple, NULL if a full set dropped it.        */
+    T_NEIGHBOUR_TUPLE* insert_neighbour_tuple (const T_NEIGHBOUR_TUPLE &tuple);
+
+    /* Publishes the changes made to a tuple found in the set.         */
+    void update_neighbour_tuple (const T_NEIGHBOUR_TUPLE* tuple);
+
+    T_BOOL check_one_hop_neigh_set_timeout();     /* Returns true if a tuple is erased or changes its symmetry */
 
-    void check_one_hop_neigh_set_timeout();
+    /* Gets the neighbors advertised in the TC messages, in no order.  */
+    const AdvertisedNeighbourSet &
+    get_advertised_set () const
+    {
+      return m_advertised_set;
+    }
+
+    /* Returns true once after each change of the advertised set.     */
+    T_BOOL check_advertised_set_changed ();
+
+    /* Counts the changes of the advertised set, read without a reset. */
+    T_UINT32
+    get_advertised_change_count () const
+    {
+      return m_advertised_change_count;
+    }
 
     /* ----------------------------  [ Two hop neighbour ] -------------------------------- */
 
@@ -121,15 +383,21 @@ namespace ns_olsr2_0
 
     /* ---------------------------------  [   MPR Selector Set   ] --------------------------------- */
 
-    /* Checks if the address is a routing mpr selector*/
+    /* Checks if the address is a routing mpr selector, one bit test */
     T_BOOL check_is_routing_mpr_selector(const T_NODE_ADDRESS &address) const ;
 
-    /* Checks if the address is a routing mpr selector*/
+    /* Checks if the address is a flooding mpr selector, one bit test */
     T_BOOL check_is_flooding_mpr_selector(const T_NODE_ADDRESS &address) const ;
 
 
     /* --------------------------------  [ Processed message ] ---------------------------- */
 
+    /* Gets the Processed message set.                                 */
+    const ProcessedMsgSet & get_processed_msgs () const
+    {
+      return m_processed_msg_set;
+    }
+
     /* Finds a Processed message tuple.                                */
     T_PROCESSED_MSG_TUPLE*
     find_processed_msg_tuple (const T_NODE_ADDRESS &address, uint16_t sequence_number);
@@ -144,6 +412,12 @@ namespace ns_olsr2_0
 
     /* --------------------------------  [ Forwarded message ] ---------------------------- */
 
+    /* Gets the Forwarded message set.                                 */
+    const ForwardedMsgSet & get_forwarded_msgs () const
+    {
+      return m_forwarded_msg_set;
+    }
+
     /* Finds a Forwarded message tuple.                                */
     T_FORWARDED_MSG_TUPLE*
     find_forwarded_msg_tuple (const T_NODE_ADDRESS &address, T_UINT16 sequence_number);
@@ -160,47 +434,65 @@ namespace ns_olsr2_0
 
     /* --------------------------------  [ Toplogy set ] ---------------------------------- */
 
-    /* Gets the Advertising Remote Router set.                         */
+    /* Gets the Advertising Remote Router set, one tuple per originator heading its slab */
     const AdvertisingRemoteRouterSet & get_advertising_remote_router_set () const;
-	
-    /* Finds a Advertising Remote Router tuple.                        */
-    T_ADVERTISING_REMOTE_ROUTER_TUPLE*
-    find_advertising_remote_router_tuple (const T_NODE_ADDRESS &dest_addr, const T_NODE_ADDRESS &last_addr);
-	
-    /* Finds a Advertising Remote Router tuple.                        */
+
+    /* Finds the Advertising Remote Router tuple of an originator.     */
     T_ADVERTISING_REMOTE_ROUTER_TUPLE*
-    find_newer_advertising_remote_router_tuple (const T_NODE_ADDRESS &last_addr, uint16_t ansn);
-	
-    /* Erases a Advertising Remote Router tuple.                       */
-    void erase_advertising_remote_router_tuple (const T_ADVERTISING_REMOTE_ROUTER_TUPLE &tuple);
-	
-    /* Erases a Advertising Remote Router tuple.                       */
-    void erase_older_advertising_remote_router_tuple (const T_NODE_ADDRESS &last_addr, uint16_t ansn);
-	
-    /* Inserts a Advertising Remote Router tuple.                      */
-    void insert_advertising_remote_router_tuple (const T_ADVERTISING_REMOTE_ROUTER_TUPLE &tuple);
+    find_advertising_remote_router_tuple (const T_NODE_ADDRESS &orig_addr);
+
+    const T_ADVERTISING_REMOTE_ROUTER_TUPLE*
+    find_advertising_remote_router_tuple (const T_NODE_ADDRESS &orig_addr) const;
+
+    /* Finds the tuple of an originator if its ANSN is newer than ansn. */
+    const T_ADVERTISING_REMOTE_ROUTER_TUPLE*
+    find_newer_advertising_remote_router_tuple (const T_NODE_ADDRESS &orig_addr, T_UINT16 ansn) const;
 
     void check_advt_router_set_timeout();
 
-    /* Gets the Advertising Remote Router set.                         */
-    const RouterTopologySet & get_router_topology_set () const;
-	
-    /* Finds a Router Topology tuple.                                  */
-    RouterTopologySet*
-    find_router_topology_tuple (const T_NODE_ADDRESS &dest_addr, const T_NODE_ADDRESS &last_addr);
-	
-    /* Finds a Router Topology tuple.                                  */
-    RouterTopologySet*
-    find_newer_router_topology_tuple (const T_NODE_ADDRESS &last_addr, uint16_t ansn);
-	
-    /* Erases a Router Topology tuple.                                 */
-    void erase_router_topology_tuple (const RouterTopologySet &tuple);
-	
-    /* Erases a Router Topology tuple tuple.                           */
-    void erase_older_router_topology_tuple (const T_NODE_ADDRESS &last_addr, uint16_t ansn);
-	
-    /* Inserts a Router Topology tuple tuple.                          */
-    void insert_router_topology_tuple (const RouterTopologySet &tuple);
+    /* Gets the Routing table.                                         */
+    const RoutingTable & get_routing_table () const
+    {
+      return m_routing_table;
+    }
+
+    /* Gets the Router Topology tuples of a slab, ar_count of them.    */
+    const T_ROUTER_TOPOLOGY_TUPLE*
+    get_router_topology_slab (const T_ADVERTISING_REMOTE_ROUTER_TUPLE &slab) const
+    {
+      return m_router_topology_set.data() + slab.ar_first;
+    }
+
+    /* Number of Router Topology tuples of all the slabs.              */
+    std::size_t
+    get_router_topology_count () const
+    {
+      return m_topology_count;
+    }
+
+    /* Calls func with each slab and each of its Router Topology tuples */
+    template <typename T_FUNC>
+    void
+    for_each_router_topology_tuple (T_FUNC func) const
+    {
+      for(const T_ADVERTISING_REMOTE_ROUTER_TUPLE& slab : m_advertising_remote_router_set)
+        {
+          const T_ROUTER_TOPOLOGY_TUPLE* tuples = get_router_topology_slab(slab);
+
+          for(T_UINT32 idx = 0; idx < slab.ar_count; idx++)
+            {
+              func(slab, tuples[idx]);
+            }
+        }
+    }
+
+    /* Replaces the slab of an originator by count tuples of a newer ANSN, returns the tuples to fill, NULL if a full set dropped them */
+    T_ROUTER_TOPOLOGY_TUPLE*
+    replace_router_topology_slab (const T_NODE_ADDRESS &orig_addr, T_UINT16 ansn, Time expiry, T_UINT32 count);
+
+    /* Adds one tuple to a slab, returns it to fill, NULL if a full set dropped it */
+    T_ROUTER_TOPOLOGY_TUPLE*
+    append_router_topology_tuple (T_ADVERTISING_REMOTE_ROUTER_TUPLE &slab);
 
     void check_router_topo_set_timeout();
 
@@ -213,9 +505,14 @@ namespace ns_olsr2_0
 
     T_LEADER_TUPLE* get_leader_tuple();      /* Returns the leader tuple */
 
-    void fill_tuples();
+    T_BOOL check_tables_timeout();     /* Erases the expired tuples, returns true if a tuple is erased or a neighbor changes its symmetry */
 
-    void check_tables_timeout();
+    /* Returns a lower bound of the earliest tuple expiry */
+    Time
+    get_next_expiry () const
+    {
+      return m_next_expiry;
+    }
 
   };
 
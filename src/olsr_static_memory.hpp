@@ -0,0 +1,55 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_static_memory.hpp
+ *
+ * Description        :   To store the capacities of the static memory build of olsr .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_STATIC_MEMORY_HPP_
+#define OLSR_STATIC_MEMORY_HPP_
+
+/* #define M_STATIC_MEMORY */   /* Fixed capacity tuple sets and messages inside the instance, uncomment for targets without heap after start up */
+
+namespace ns_olsr2_0
+{
+#define M_STATIC_MAX_LINKS              64      /* Link tuples of one instance */
+#define M_STATIC_MAX_NEIGHBOURS         M_STATIC_MAX_LINKS  /* Neighbor tuples, one per link */
+#define M_STATIC_MAX_TWO_HOP            512     /* 2-hop neighbor tuples */
+#define M_STATIC_MAX_ADVERTISING        64      /* Advertising remote router tuples */
+#define M_STATIC_MAX_TOPOLOGY           1024    /* Router topology tuples */
+#define M_STATIC_MAX_PROCESSED_MSGS     256     /* Processed message tuples */
+#define M_STATIC_MAX_FORWARDED_MSGS     256     /* Forwarded message tuples */
+#define M_STATIC_MAX_ROUTES             256     /* Routing table entries */
+#define M_STATIC_MAX_TC_BLOCKS          2       /* Address blocks of one TC message, one per net */
+
+  /**
+   * Handling of an insertion into a full set
+   */
+  typedef enum
+  {
+    OVERFLOW_DROP_NEW = 0,              /* The new tuple is ignored */
+    OVERFLOW_EVICT_EARLIEST             /* The tuple expiring first makes room for the new one */
+  }E_OVERFLOW_POLICY;
+
+#define M_STATIC_LINK_POLICY            OVERFLOW_DROP_NEW           /* Links of a full set are kept until they expire */
+#define M_STATIC_TWO_HOP_POLICY         OVERFLOW_DROP_NEW           /* 2-hop neighbors beyond the capacity are not covered */
+#define M_STATIC_PROCESSED_MSG_POLICY   OVERFLOW_EVICT_EARLIEST     /* Oldest duplicate entries are forgotten first */
+#define M_STATIC_FORWARDED_MSG_POLICY   OVERFLOW_EVICT_EARLIEST     /* Oldest duplicate entries are forgotten first */
+
+}
+
+#endif /* OLSR_STATIC_MEMORY_HPP_ */
@@ -0,0 +1,188 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_trace.cpp
+ *
+ * Description        :   Implements the trace event recorder of the olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <vector>
+#include "olsr_trace.hpp"
+
+namespace ns_olsr2_0
+{
+
+  std::atomic<T_BOOL> C_OLSR_TRACE::s_enabled(false);
+  const std::chrono::steady_clock::time_point C_OLSR_TRACE::s_epoch = std::chrono::steady_clock::now();
+  std::atomic<C_OLSR_TRACE::T_TRACE_RING*> C_OLSR_TRACE::s_rings(NULL);
+
+  /********************************************************************
+   * @function  register_ring
+   * @brief     This function gives the calling thread the ring of an
+   *            exited thread, or links a new ring to the ring list.
+   * @param     None.
+   * @return    Ring.
+   * @note      Called once per thread, on its first event. The events
+   *            of the previous owner are kept.
+  ********************************************************************/
+  C_OLSR_TRACE::T_TRACE_RING* C_OLSR_TRACE::register_ring(void)
+  {
+    static thread_local C_RING_OWNER t_owner;
+    T_TRACE_RING* ring;
+
+    for(ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        T_BOOL released = false;
+
+        if(ring->in_use.compare_exchange_strong(released, true, std::memory_order_acquire) == true)
+          {
+            t_owner.m_ring = ring;
+            return ring;
+          }
+      }
+
+    ring = new T_TRACE_RING();
+
+    ring->count.store(0, std::memory_order_relaxed);
+    ring->in_use.store(true, std::memory_order_relaxed);
+
+    ring->next = s_rings.load(std::memory_order_relaxed);
+
+    while(s_rings.compare_exchange_weak(ring->next, ring, std::memory_order_release, std::memory_order_relaxed) == false)
+      {
+        ;
+      }
+
+    t_owner.m_ring = ring;
+
+    return ring;
+  }
+
+  /********************************************************************
+   * @function  get_event_count
+   * @brief     This function returns the number of events kept in the
+   *            rings.
+   * @param     None.
+   * @return    Events.
+   * @note      None.
+  ********************************************************************/
+  T_UINT64 C_OLSR_TRACE::get_event_count(void)
+  {
+    T_UINT64 events = 0;
+
+    for(T_TRACE_RING* ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        T_UINT64 count = ring->count.load(std::memory_order_acquire);
+
+        events += (count < M_TRACE_RING_SIZE) ? count : M_TRACE_RING_SIZE;
+      }
+
+    return events;
+  }
+
+  /********************************************************************
+   * @function  clear
+   * @brief     This function drops the recorded events.
+   * @param     None.
+   * @return    None.
+   * @note      Only call it while tracing is disabled and no span is
+   *            open, a thread recording meanwhile keeps its count.
+  ********************************************************************/
+  void C_OLSR_TRACE::clear(void)
+  {
+    for(T_TRACE_RING* ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        ring->count.store(0, std::memory_order_release);
+      }
+  }
+
+  /********************************************************************
+   * @function  write_json
+   * @brief     This function writes the recorded events in the trace
+   *            event format read by chrome://tracing and Perfetto.
+   * @param     out.
+   * @return    None.
+   * @note      Each orthogonal net is a process and each node one of
+   *            its threads. Only call it while tracing is disabled, an
+   *            event overwritten during the export may be written
+   *            half updated.
+  ********************************************************************/
+  void C_OLSR_TRACE::write_json(std::ostream& out)
+  {
+    std::vector<T_BOOL> nodes(1 << 16, false);
+    const char* separator = "\n";
+    T_UINT32 last_net = 1 << 8;
+
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+    for(T_TRACE_RING* ring = s_rings.load(std::memory_order_acquire); ring != NULL; ring = ring->next)
+      {
+        T_UINT64 count = ring->count.load(std::memory_order_acquire);
+        T_UINT64 first = (count > M_TRACE_RING_SIZE) ? (count - M_TRACE_RING_SIZE) : 0;
+
+        for(T_UINT64 idx = first; idx < count; idx++)
+          {
+            const T_TRACE_EVENT& event = ring->events[idx & (M_TRACE_RING_SIZE - 1)];
+
+            out << separator << "{\"name\": \"" << event.name << "\", \"pid\": " << (event.node >> 8)
+                << ", \"tid\": " << (event.node & 0XFF) << ", \"ts\": " << (event.start_ns / 1000)
+                << "." << (event.start_ns % 1000) / 100 << (event.start_ns % 100) / 10 << (event.start_ns % 10);
+
+            if(event.is_instant == true)
+              {
+                out << ", \"ph\": \"i\", \"s\": \"t\"";
+              }
+            else
+              {
+                out << ", \"ph\": \"X\", \"dur\": " << (event.duration_ns / 1000)
+                    << "." << (event.duration_ns % 1000) / 100 << (event.duration_ns % 100) / 10 << (event.duration_ns % 10);
+              }
+
+            if(event.peer != M_TRACE_NO_PEER)
+              {
+                out << ", \"args\": {\"from\": \"" << (event.peer >> 8) << "." << (event.peer & 0XFF) << "\"}";
+              }
+            out << "}";
+
+            separator = ",\n";
+            nodes[event.node] = true;
+          }
+      }
+
+    /* Names of the tracks */
+    for(T_UINT32 node = 0; node < nodes.size(); node++)
+      {
+        if(nodes[node] == false)
+          {
+            continue;
+          }
+
+        if((node >> 8) != last_net)
+          {
+            last_net = node >> 8;
+            out << separator << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << (node >> 8)
+                << ", \"args\": {\"name\": \"net " << (node >> 8) << "\"}}";
+            separator = ",\n";
+          }
+        out << separator << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << (node >> 8) << ", \"tid\": " << (node & 0XFF)
+            << ", \"args\": {\"name\": \"node " << (node >> 8) << "." << (node & 0XFF) << "\"}}";
+        separator = ",\n";
+      }
+
+    out << "\n]}" << std::endl;
+  }
+
+}
@@ -0,0 +1,223 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_trace.hpp
+ *
+ * Description        :   To store the trace event recorder of the olsr instances .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_TRACE_HPP_
+#define OLSR_TRACE_HPP_
+
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <ostream>
+#include "olsr_metrics.hpp"  /* Include file for the cache line size */
+
+#ifndef M_NO_TRACE_EVENTS
+#define M_TRACE_EVENTS       /* Records trace events while enabled, build with -DM_NO_TRACE_EVENTS to remove the recording */
+#endif
+
+namespace ns_olsr2_0
+{
+#define M_TRACE_RING_SIZE       65536   /* Events kept per thread, a power of two, the oldest are overwritten */
+#define M_TRACE_NO_PEER         0XFFFF  /* Peer of an event without a peer address */
+
+  /**
+   * Recorded event, the node and the peer are (net_id << 8) | node_id
+   */
+  typedef struct
+  {
+    const char* name;                   /* String literal */
+    T_UINT64 start_ns;                  /* Start since the trace epoch */
+    T_UINT64 duration_ns;               /* 0 for an instant event */
+    T_UINT16 node;                      /* Instance recording the event */
+    T_UINT16 peer;                      /* Sender of a received message, M_TRACE_NO_PEER otherwise */
+    T_BOOL is_instant;
+  }T_TRACE_EVENT;
+
+  /**
+   * Trace event recorder of the protocol activity. Each thread writes
+   * its events into a ring of its own, write_json() exports the rings
+   * in the Chrome / Perfetto trace event format with one process per
+   * orthogonal net and one thread per node.
+   */
+  class C_OLSR_TRACE
+  {
+
+  public:
+
+    static void
+    set_enabled (T_BOOL enabled)
+    {
+      s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    /* Checked before taking any time stamp, the only cost while disabled */
+    static T_BOOL
+    is_enabled ()
+    {
+      return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static T_UINT64
+    get_time_ns ()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+    }
+
+    static T_UINT16
+    get_trace_address (const T_NODE_ADDRESS& address)
+    {
+      return (address.net_id << 8) | address.node_id;
+    }
+
+    /* Adds an event of the calling thread */
+    static void
+    record (const char* name, T_UINT64 start_ns, T_UINT64 duration_ns, const T_NODE_ADDRESS& node, T_UINT16 peer, T_BOOL is_instant)
+    {
+      T_TRACE_RING& ring = get_ring();
+      T_UINT64 count = ring.count.load(std::memory_order_relaxed);
+      T_TRACE_EVENT& event = ring.events[count & (M_TRACE_RING_SIZE - 1)];
+
+      event.name = name;
+      event.start_ns = start_ns;
+      event.duration_ns = duration_ns;
+      event.node = get_trace_address(node);
+      event.peer = peer;
+      event.is_instant = is_instant;
+
+      ring.count.store(count + 1, std::memory_order_release);
+    }
+
+    static void
+    instant (const char* name, const T_NODE_ADDRESS& node, const T_NODE_ADDRESS& peer)
+    {
+      record(name, get_time_ns(), 0, node, get_trace_address(peer), true);
+    }
+
+    static T_UINT64 get_event_count(void);      /* Events kept in the rings */
+
+    static void clear(void);                    /* Drops the recorded events */
+
+    static void write_json(std::ostream& out);  /* Writes the recorded events as a trace event file */
+
+  private:
+
+    /**
+     * Events of one thread, reused by the next thread once it exits
+     */
+    struct alignas(M_CACHE_LINE_SIZE) T_TRACE_RING
+    {
+      std::array<T_TRACE_EVENT, M_TRACE_RING_SIZE> events;
+      std::atomic<T_UINT64> count;      /* Events recorded since the last clear */
+      std::atomic<T_BOOL> in_use;       /* True while a thread owns the ring */
+      T_TRACE_RING* next;               /* Ring registered before this one */
+    };
+
+    /**
+     * Releases the ring of a thread when the thread exits
+     */
+    class C_RING_OWNER
+    {
+
+    public:
+      C_RING_OWNER() : m_ring(NULL) {}
+
+      ~C_RING_OWNER()
+      {
+        if(m_ring != NULL)
+          {
+            m_ring->in_use.store(false, std::memory_order_release);
+          }
+      }
+
+      T_TRACE_RING* m_ring;             /* Ring of the thread */
+    };
+
+    static std::atomic<T_BOOL> s_enabled;           /* Runtime switch */
+
+    static const std::chrono::steady_clock::time_point s_epoch;    /* Time 0 of the trace */
+
+    static std::atomic<T_TRACE_RING*> s_rings;      /* Last registered ring */
+
+    static T_TRACE_RING* register_ring(void);       /* Takes over a released ring or links a new one */
+
+    static T_TRACE_RING&
+    get_ring ()
+    {
+      static thread_local T_TRACE_RING* t_ring = NULL;
+
+      if(t_ring == NULL)
+        {
+          t_ring = register_ring();
+        }
+      return *t_ring;
+    }
+  };
+
+  /**
+   * Records a scope as a complete event when tracing is enabled at its
+   * start
+   */
+  class C_TRACE_SPAN
+  {
+
+  public:
+    C_TRACE_SPAN(const char* name, const T_NODE_ADDRESS& node)
+    : m_name(name), m_node(node), m_enabled(C_OLSR_TRACE::is_enabled())
+    {
+      m_start_ns = (m_enabled == true) ? C_OLSR_TRACE::get_time_ns() : 0;
+    }
+
+    ~C_TRACE_SPAN()
+    {
+      if(m_enabled == true)
+        {
+          C_OLSR_TRACE::record(m_name, m_start_ns, C_OLSR_TRACE::get_time_ns() - m_start_ns, m_node, M_TRACE_NO_PEER, false);
+        }
+    }
+
+  private:
+
+    const char* m_name;
+
+    const T_NODE_ADDRESS& m_node;
+
+    T_BOOL m_enabled;
+
+    T_UINT64 m_start_ns;
+  };
+
+#ifdef M_TRACE_EVENTS
+#define M_TRACE_SPAN(name, node)            C_TRACE_SPAN trace_span(name, node)     /* Records the rest of the scope */
+#define M_TRACE_INSTANT(name, node, peer)                                                   \
+  do                                                                                        \
+    {                                                                                       \
+      if(C_OLSR_TRACE::is_enabled() == true)                                                \
+        {                                                                                   \
+          C_OLSR_TRACE::instant((name), (node), (peer));                                    \
+        }                                                                                   \
+    } while(0)
+#else
+#define M_TRACE_SPAN(name, node)
+#define M_TRACE_INSTANT(name, node, peer)
+#endif
+
+}
+
+#endif /* OLSR_TRACE_HPP_ */
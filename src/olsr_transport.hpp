@@ -0,0 +1,46 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_transport.hpp
+ *
+ * Description        :   To store the interface between olsr and the packet transport .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_TRANSPORT_HPP_
+#define OLSR_TRANSPORT_HPP_
+
+#include "olsr_header.hpp"           /* Include file for hearder functionalities */
+
+namespace ns_olsr2_0
+{
+
+  /**
+   * Delivers the packets of an OLSR instance to its 1-hop neighbors,
+   * received packets are handed back through C_OLSR::recv_olsr(void*)
+   */
+  class C_OLSR_TRANSPORT
+  {
+
+  public:
+    virtual ~C_OLSR_TRANSPORT() {}
+
+    /* Sends a packet to all the 1-hop neighbors of sender_address */
+    virtual void send_packet(const T_NODE_ADDRESS& sender_address, const C_PACKET_HEADER& olsr_packet) = 0;
+  };
+
+}
+
+#endif /* OLSR_TRANSPORT_HPP_ */
@@ -0,0 +1,547 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_tuple_columns.cpp
+ *
+ * Description        :   Implements the column store and mask kernels of the olsr link and neighbor sets .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <algorithm>
+#include "olsr_tuple_columns.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ns_olsr2_0
+{
+
+  /*
+   * Tests of one step of a kernel. Each returns one bit per lane, lane
+   * i in bit i, for lanes tuples starting at the given column entry.
+   * A full step of M_MASK_LANES lanes uses SSE2, and AVX2 for the 32
+   * bit columns when the build targets it, a shorter tail is tested
+   * one tuple at a time.
+   */
+
+#if defined(__AVX2__)
+  /* Bits of 8 times at or after reference */
+  static inline T_UINT32
+  get_live_octet (const T_UINT32* times, __m256i reference)
+  {
+    __m256i distance = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)times), reference);
+
+    return (T_UINT32)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(distance, _mm256_set1_epi32(-1))));
+  }
+
+  /* Bits of 8 metrics at or above 0 */
+  static inline T_UINT32
+  get_non_negative_octet (const T_FLOAT* metrics)
+  {
+    return (T_UINT32)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(metrics), _mm256_setzero_ps(), _CMP_GE_OQ));
+  }
+#elif defined(__SSE2__)
+  /* Bits of 4 times at or after reference */
+  static inline T_UINT32
+  get_live_quad (const T_UINT32* times, __m128i reference)
+  {
+    __m128i distance = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)times), reference);
+
+    return (T_UINT32)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(distance, _mm_set1_epi32(-1))));
+  }
+
+  /* Bits of 4 metrics at or above 0 */
+  static inline T_UINT32
+  get_non_negative_quad (const T_FLOAT* metrics)
+  {
+    return (T_UINT32)_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(metrics), _mm_setzero_ps()));
+  }
+#endif
+
+  /* Times at or after reference, in the wrap around order of C_TUPLE_TIME */
+  static inline T_UINT32
+  get_live_bits (const T_UINT32* times, T_UINT32 reference, std::size_t lanes)
+  {
+    T_UINT32 bits = 0;
+
+#if defined(__AVX2__)
+    if(lanes == M_MASK_LANES)
+      {
+        __m256i ref = _mm256_set1_epi32((T_INT32)reference);
+
+        return get_live_octet(times, ref) | (get_live_octet(times + 8, ref) << 8);
+      }
+#elif defined(__SSE2__)
+    if(lanes == M_MASK_LANES)
+      {
+        __m128i ref = _mm_set1_epi32((T_INT32)reference);
+
+        return get_live_quad(times, ref) | (get_live_quad(times + 4, ref) << 4)
+            | (get_live_quad(times + 8, ref) << 8) | (get_live_quad(times + 12, ref) << 12);
+      }
+#endif
+    for(std::size_t lane = 0; lane < lanes; lane++)
+      {
+        bits |= (T_UINT32)((T_INT32)(times[lane] - reference) >= 0) << lane;
+      }
+    return bits;
+  }
+
+  /* Bytes equal to value */
+  static inline T_UINT32
+  get_equal_bits (const T_UINT8* column, T_UINT8 value, std::size_t lanes)
+  {
+    T_UINT32 bits = 0;
+
+#if defined(__SSE2__)
+    if(lanes == M_MASK_LANES)
+      {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)column);
+
+        return (T_UINT32)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8((char)value)));
+      }
+#endif
+    for(std::size_t lane = 0; lane < lanes; lane++)
+      {
+        bits |= (T_UINT32)(column[lane] == value) << lane;
+      }
+    return bits;
+  }
+
+  /* Bytes above value, both below 128 as the willingness and flags are */
+  static inline T_UINT32
+  get_above_bits (const T_UINT8* column, T_UINT8 value, std::size_t lanes)
+  {
+    T_UINT32 bits = 0;
+
+#if defined(__SSE2__)
+    if(lanes == M_MASK_LANES)
+      {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)column);
+
+        return (T_UINT32)_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, _mm_set1_epi8((char)value)));
+      }
+#endif
+    for(std::size_t lane = 0; lane < lanes; lane++)
+      {
+        bits |= (T_UINT32)(column[lane] > value) << lane;
+      }
+    return bits;
+  }
+
+  /* Metrics at or above 0, an unknown metric is negative */
+  static inline T_UINT32
+  get_non_negative_bits (const T_FLOAT* metrics, std::size_t lanes)
+  {
+    T_UINT32 bits = 0;
+
+#if defined(__AVX2__)
+    if(lanes == M_MASK_LANES)
+      {
+        return get_non_negative_octet(metrics) | (get_non_negative_octet(metrics + 8) << 8);
+      }
+#elif defined(__SSE2__)
+    if(lanes == M_MASK_LANES)
+      {
+        return get_non_negative_quad(metrics) | (get_non_negative_quad(metrics + 4) << 4)
+            | (get_non_negative_quad(metrics + 8) << 8) | (get_non_negative_quad(metrics + 12) << 12);
+      }
+#endif
+    for(std::size_t lane = 0; lane < lanes; lane++)
+      {
+        bits |= (T_UINT32)(metrics[lane] >= 0) << lane;
+      }
+    return bits;
+  }
+
+  /********************************************************************
+   * @function  build_mask
+   * @brief     This function runs the tests of a kernel over count
+   *            tuples, M_MASK_LANES at a time, and stores the bits.
+   * @param     count, mask, test - Returns the bits of the lanes
+   *            starting at the given index.
+   * @return    None.
+   * @note      One pass over the columns read by the test.
+  ********************************************************************/
+  template <typename T_TEST>
+  static void
+  build_mask (std::size_t count, T_MATCH_MASK& mask, T_TEST test)
+  {
+    mask.clear();
+    mask.resize((count + M_MASK_WORD_BITS - 1) / M_MASK_WORD_BITS);
+
+    for(std::size_t idx = 0; idx < count; idx += M_MASK_LANES)
+      {
+        std::size_t lanes = std::min<std::size_t>(count - idx, M_MASK_LANES);
+
+        mask[idx / M_MASK_WORD_BITS] |= (T_UINT64)test(idx, lanes) << (idx % M_MASK_WORD_BITS);
+      }
+  }
+
+  /* Empties a column and drops its buffer, which goes back to the memory resource */
+  template <typename T_COLUMN>
+  static void
+  reset_column (T_COLUMN& column)
+  {
+    T_COLUMN(column.get_allocator()).swap(column);
+  }
+
+  /********************************************************************
+   * @function  C_LINK_COLUMNS
+   * @brief     This function is the constructor of C_LINK_COLUMNS.
+   * @param     resource - Memory of the columns.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_LINK_COLUMNS::C_LINK_COLUMNS(std::pmr::memory_resource* resource)
+  : m_times(resource), m_sym_times(resource), m_heard_times(resource),
+    m_status(resource), m_out_metrics(resource)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  push_back
+   * @brief     This function adds the row of a tuple appended to the
+   *            link set.
+   * @param     tuple.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::push_back(const T_LINK_TUPLE& tuple)
+  {
+    m_times.push_back(tuple.l_time.get_raw());
+    m_sym_times.push_back(tuple.l_sym_time.get_raw());
+    m_heard_times.push_back(tuple.l_heard_time.get_raw());
+    m_status.push_back(tuple.l_status);
+    m_out_metrics.push_back(tuple.l_out_metric);
+  }
+
+  /********************************************************************
+   * @function  set_row
+   * @brief     This function writes a tuple changed in place.
+   * @param     idx - Index of the tuple in the set, tuple.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::set_row(std::size_t idx, const T_LINK_TUPLE& tuple)
+  {
+    m_times[idx] = tuple.l_time.get_raw();
+    m_sym_times[idx] = tuple.l_sym_time.get_raw();
+    m_heard_times[idx] = tuple.l_heard_time.get_raw();
+    m_status[idx] = tuple.l_status;
+    m_out_metrics[idx] = tuple.l_out_metric;
+  }
+
+  /********************************************************************
+   * @function  assign
+   * @brief     This function rebuilds the rows from a link set.
+   * @param     link_set.
+   * @return    None.
+   * @note      For the changes not following the set in place, such as
+   *            a copy of the state or an eviction.
+  ********************************************************************/
+  void C_LINK_COLUMNS::assign(const LinkSet& link_set)
+  {
+    clear();
+
+    for(LinkSet::const_iterator iter = link_set.begin(); iter != link_set.end(); iter++)
+      {
+        push_back(*iter);
+      }
+  }
+
+  /********************************************************************
+   * @function  compact
+   * @brief     This function keeps the rows whose bit is set, in order.
+   * @param     keep.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::compact(const T_MATCH_MASK& keep)
+  {
+    compact_column(m_times, keep);
+    compact_column(m_sym_times, keep);
+    compact_column(m_heard_times, keep);
+    compact_column(m_status, keep);
+    compact_column(m_out_metrics, keep);
+  }
+
+  /********************************************************************
+   * @function  clear
+   * @brief     This function removes all the rows.
+   * @param     None.
+   * @return    None.
+   * @note      The buffers are kept.
+  ********************************************************************/
+  void C_LINK_COLUMNS::clear(void)
+  {
+    m_times.clear();
+    m_sym_times.clear();
+    m_heard_times.clear();
+    m_status.clear();
+    m_out_metrics.clear();
+  }
+
+  /********************************************************************
+   * @function  reset
+   * @brief     This function removes all the rows and gives the
+   *            buffers back to the memory resource.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::reset(void)
+  {
+    reset_column(m_times);
+    reset_column(m_sym_times);
+    reset_column(m_heard_times);
+    reset_column(m_status);
+    reset_column(m_out_metrics);
+  }
+
+  /********************************************************************
+   * @function  reserve
+   * @brief     This function reserves capacity rows in each column.
+   * @param     capacity.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::reserve(std::size_t capacity)
+  {
+    m_times.reserve(capacity);
+    m_sym_times.reserve(capacity);
+    m_heard_times.reserve(capacity);
+    m_status.reserve(capacity);
+    m_out_metrics.reserve(capacity);
+  }
+
+  /********************************************************************
+   * @function  get_symmetric_mask
+   * @brief     This function marks the links with a symmetric status
+   *            whose symmetric time has not expired.
+   * @param     cur_time, mask.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::get_symmetric_mask(Time cur_time, T_MATCH_MASK& mask) const
+  {
+    T_UINT32 reference = C_TUPLE_TIME(cur_time).get_raw();
+
+    build_mask(size(), mask, [&](std::size_t idx, std::size_t lanes)
+      {
+        return get_equal_bits(&m_status[idx], SYMMETRIC, lanes) & get_live_bits(&m_sym_times[idx], reference, lanes);
+      });
+  }
+
+  /********************************************************************
+   * @function  get_allowed_mask
+   * @brief     This function marks the symmetric links with a known out
+   *            metric.
+   * @param     cur_time, mask.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::get_allowed_mask(Time cur_time, T_MATCH_MASK& mask) const
+  {
+    T_UINT32 reference = C_TUPLE_TIME(cur_time).get_raw();
+
+    build_mask(size(), mask, [&](std::size_t idx, std::size_t lanes)
+      {
+        return get_equal_bits(&m_status[idx], SYMMETRIC, lanes) & get_live_bits(&m_sym_times[idx], reference, lanes)
+            & get_non_negative_bits(&m_out_metrics[idx], lanes);
+      });
+  }
+
+  /********************************************************************
+   * @function  get_heard_mask
+   * @brief     This function marks the links whose heard time has not
+   *            expired.
+   * @param     cur_time, mask.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_LINK_COLUMNS::get_heard_mask(Time cur_time, T_MATCH_MASK& mask) const
+  {
+    T_UINT32 reference = C_TUPLE_TIME(cur_time).get_raw();
+
+    build_mask(size(), mask, [&](std::size_t idx, std::size_t lanes)
+      {
+        return get_live_bits(&m_heard_times[idx], reference, lanes);
+      });
+  }
+
+  /********************************************************************
+   * @function  get_valid_mask
+   * @brief     This function marks the links whose validity time is
+   *            after cur_time.
+   * @param     cur_time, mask.
+   * @return    None.
+   * @note      The complement is what the expiry sweep erases.
+  ********************************************************************/
+  void C_LINK_COLUMNS::get_valid_mask(Time cur_time, T_MATCH_MASK& mask) const
+  {
+    T_UINT32 reference = C_TUPLE_TIME(cur_time + 1).get_raw();
+
+    build_mask(size(), mask, [&](std::size_t idx, std::size_t lanes)
+      {
+        return get_live_bits(&m_times[idx], reference, lanes);
+      });
+  }
+
+  /********************************************************************
+   * @function  C_NEIGHBOUR_COLUMNS
+   * @brief     This function is the constructor of C_NEIGHBOUR_COLUMNS.
+   * @param     resource - Memory of the columns.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_NEIGHBOUR_COLUMNS::C_NEIGHBOUR_COLUMNS(std::pmr::memory_resource* resource)
+  : m_route_wills(resource), m_flood_wills(resource), m_symmetric(resource),
+    m_in_metrics(resource)
+  {
+
+  }
+
+  /********************************************************************
+   * @function  push_back
+   * @brief     This function adds the row of a tuple appended to the
+   *            neighbor set.
+   * @param     tuple.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::push_back(const T_NEIGHBOUR_TUPLE& tuple)
+  {
+    m_route_wills.push_back(tuple.n_willingness.fields.route_will);
+    m_flood_wills.push_back(tuple.n_willingness.fields.flood_will);
+    m_symmetric.push_back(tuple.n_symmetric);
+    m_in_metrics.push_back(tuple.n_in_metric);
+  }
+
+  /********************************************************************
+   * @function  set_row
+   * @brief     This function writes a tuple changed in place.
+   * @param     idx - Index of the tuple in the set, tuple.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::set_row(std::size_t idx, const T_NEIGHBOUR_TUPLE& tuple)
+  {
+    m_route_wills[idx] = tuple.n_willingness.fields.route_will;
+    m_flood_wills[idx] = tuple.n_willingness.fields.flood_will;
+    m_symmetric[idx] = tuple.n_symmetric;
+    m_in_metrics[idx] = tuple.n_in_metric;
+  }
+
+  /********************************************************************
+   * @function  assign
+   * @brief     This function rebuilds the rows from a neighbor set.
+   * @param     neighbour_set.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::assign(const NeighbourSet& neighbour_set)
+  {
+    clear();
+
+    for(NeighbourSet::const_iterator iter = neighbour_set.begin(); iter != neighbour_set.end(); iter++)
+      {
+        push_back(*iter);
+      }
+  }
+
+  /********************************************************************
+   * @function  compact
+   * @brief     This function keeps the rows whose bit is set, in order.
+   * @param     keep.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::compact(const T_MATCH_MASK& keep)
+  {
+    compact_column(m_route_wills, keep);
+    compact_column(m_flood_wills, keep);
+    compact_column(m_symmetric, keep);
+    compact_column(m_in_metrics, keep);
+  }
+
+  /********************************************************************
+   * @function  clear
+   * @brief     This function removes all the rows.
+   * @param     None.
+   * @return    None.
+   * @note      The buffers are kept.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::clear(void)
+  {
+    m_route_wills.clear();
+    m_flood_wills.clear();
+    m_symmetric.clear();
+    m_in_metrics.clear();
+  }
+
+  /********************************************************************
+   * @function  reset
+   * @brief     This function removes all the rows and gives the
+   *            buffers back to the memory resource.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::reset(void)
+  {
+    reset_column(m_route_wills);
+    reset_column(m_flood_wills);
+    reset_column(m_symmetric);
+    reset_column(m_in_metrics);
+  }
+
+  /********************************************************************
+   * @function  reserve
+   * @brief     This function reserves capacity rows in each column.
+   * @param     capacity.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::reserve(std::size_t capacity)
+  {
+    m_route_wills.reserve(capacity);
+    m_flood_wills.reserve(capacity);
+    m_symmetric.reserve(capacity);
+    m_in_metrics.reserve(capacity);
+  }
+
+  /********************************************************************
+   * @function  get_routing_allowed_mask
+   * @brief     This function marks the symmetric neighbors with a
+   *            known in metric willing to be routing MPRs.
+   * @param     mask.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_NEIGHBOUR_COLUMNS::get_routing_allowed_mask(T_MATCH_MASK& mask) const
+  {
+    build_mask(size(), mask, [&](std::size_t idx, std::size_t lanes)
+      {
+        return get_equal_bits(&m_symmetric[idx], 1, lanes) & get_above_bits(&m_route_wills[idx], WILL_NEVER, lanes)
+            & get_non_negative_bits(&m_in_metrics[idx], lanes);
+      });
+  }
+
+}
@@ -0,0 +1,212 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_tuple_columns.hpp
+ *
+ * Description        :   To store the link and neighbor sets of olsr as columns .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_TUPLE_COLUMNS_HPP_
+#define OLSR_TUPLE_COLUMNS_HPP_
+
+#include "olsr_types.hpp"            /* Include file for OLSR types functionalities */
+#include "olsr_arena.hpp"             /* Include file for the tuple arena */
+#include "olsr_small_vector.hpp"     /* Include file for the small vector */
+
+#define M_TUPLE_COLUMNS     /* Keeps the link and neighbor sets also as columns scanned by the mask kernels, comment out to scan the tuples */
+
+namespace ns_olsr2_0
+{
+#define M_MASK_LANES            16      /* Tuples tested by one step of a kernel */
+#define M_MASK_WORD_BITS        64      /* Tuples of one mask word */
+#define M_MASK_INLINE_WORDS     4       /* Mask words kept inside the mask, 256 tuples */
+
+  /**
+   * One bit per tuple of a set, bit i of word i / 64 for the tuple at
+   * index i, set if the tuple matches
+   */
+  typedef C_SMALL_VECTOR<T_UINT64, M_MASK_INLINE_WORDS> T_MATCH_MASK;
+
+  /* Address as one 16 bit key, the net id in the high byte */
+  static inline T_UINT16
+  get_packed_address (const T_NODE_ADDRESS& address)
+  {
+    return (T_UINT16)((address.net_id << 8) | address.node_id);
+  }
+
+  /* Calls func with the index of each tuple matching in the mask, in increasing order */
+  template <typename T_FUNC>
+  void
+  for_each_match (const T_MATCH_MASK& mask, T_FUNC func)
+  {
+    for(std::size_t word_idx = 0; word_idx < mask.size(); word_idx++)
+      {
+        T_UINT64 word = mask[word_idx];
+
+        while(word != 0)
+          {
+            func((word_idx * M_MASK_WORD_BITS) + __builtin_ctzll(word));
+            word &= (word - 1);
+          }
+      }
+  }
+
+  /* Tests the bit of the tuple at index idx */
+  static inline T_BOOL
+  get_match (const T_MATCH_MASK& mask, std::size_t idx)
+  {
+    return (((mask[idx / M_MASK_WORD_BITS] >> (idx % M_MASK_WORD_BITS)) & 1) != 0);
+  }
+
+  /* Number of tuples matching in the mask */
+  static inline std::size_t
+  get_match_count (const T_MATCH_MASK& mask)
+  {
+    std::size_t count = 0;
+
+    for(std::size_t word_idx = 0; word_idx < mask.size(); word_idx++)
+      {
+        count += __builtin_popcountll(mask[word_idx]);
+      }
+    return count;
+  }
+
+  /* Moves the tuples whose bit is set to the front of the column, in order, and drops the others */
+  template <typename T_COLUMN>
+  void
+  compact_column (T_COLUMN& column, const T_MATCH_MASK& keep)
+  {
+    std::size_t kept = 0;
+
+    for_each_match(keep, [&](std::size_t idx)
+      {
+        column[kept++] = column[idx];
+      });
+    column.resize(kept);
+  }
+
+  /**
+   * Link set stored as one column per field tested by the scans. Row i
+   * holds the i-th tuple of the LinkSet it mirrors, the owner writes
+   * every change of the set to the columns.
+   */
+  class C_LINK_COLUMNS
+  {
+
+  public:
+    C_LINK_COLUMNS(std::pmr::memory_resource* resource);
+
+    void push_back(const T_LINK_TUPLE& tuple);                  /* Adds a row for a tuple appended to the set */
+
+    void set_row(std::size_t idx, const T_LINK_TUPLE& tuple);   /* Writes a tuple changed in place */
+
+    void assign(const LinkSet& link_set);                       /* Rebuilds all the rows */
+
+    void compact(const T_MATCH_MASK& keep);                     /* Keeps the rows whose bit is set */
+
+    void clear(void);
+
+    void reset(void);                                           /* Empties the columns and drops their buffers */
+
+    void reserve(std::size_t capacity);
+
+    /* Links with a symmetric status whose symmetric time has not expired */
+    void get_symmetric_mask(Time cur_time, T_MATCH_MASK& mask) const;
+
+    /* Symmetric links with a known out metric, the flooding MPR candidates */
+    void get_allowed_mask(Time cur_time, T_MATCH_MASK& mask) const;
+
+    /* Links whose heard time has not expired */
+    void get_heard_mask(Time cur_time, T_MATCH_MASK& mask) const;
+
+    /* Links whose validity time has not expired */
+    void get_valid_mask(Time cur_time, T_MATCH_MASK& mask) const;
+
+    std::size_t
+    size () const
+    {
+      return m_times.size();
+    }
+
+    /* Arena bytes of the columns of capacity rows, to size a fixed buffer */
+    static constexpr std::size_t
+    get_reserved_bytes (std::size_t capacity)
+    {
+      return (3 * C_OLSR_ARENA::get_block_size(capacity * sizeof(T_UINT32)))
+          + C_OLSR_ARENA::get_block_size(capacity * sizeof(T_UINT8)) + C_OLSR_ARENA::get_block_size(capacity * sizeof(T_FLOAT));
+    }
+
+  private:
+
+    std::pmr::vector<T_UINT32> m_times;             /* l_time */
+    std::pmr::vector<T_UINT32> m_sym_times;         /* l_sym_time */
+    std::pmr::vector<T_UINT32> m_heard_times;       /* l_heard_time */
+    std::pmr::vector<T_UINT8> m_status;             /* l_status */
+    std::pmr::vector<T_FLOAT> m_out_metrics;        /* l_out_metric */
+  };
+
+  /**
+   * Neighbor set stored as one column per field tested by the scans,
+   * row i holds the i-th tuple of the NeighbourSet it mirrors
+   */
+  class C_NEIGHBOUR_COLUMNS
+  {
+
+  public:
+    C_NEIGHBOUR_COLUMNS(std::pmr::memory_resource* resource);
+
+    void push_back(const T_NEIGHBOUR_TUPLE& tuple);                 /* Adds a row for a tuple appended to the set */
+
+    void set_row(std::size_t idx, const T_NEIGHBOUR_TUPLE& tuple);  /* Writes a tuple changed in place */
+
+    void assign(const NeighbourSet& neighbour_set);                 /* Rebuilds all the rows */
+
+    void compact(const T_MATCH_MASK& keep);                         /* Keeps the rows whose bit is set */
+
+    void clear(void);
+
+    void reset(void);                                               /* Empties the columns and drops their buffers */
+
+    void reserve(std::size_t capacity);
+
+    /* Symmetric neighbors with a known in metric and a routing willingness above WILL_NEVER, the routing MPR candidates */
+    void get_routing_allowed_mask(T_MATCH_MASK& mask) const;
+
+    std::size_t
+    size () const
+    {
+      return m_symmetric.size();
+    }
+
+    /* Arena bytes of the columns of capacity rows, to size a fixed buffer */
+    static constexpr std::size_t
+    get_reserved_bytes (std::size_t capacity)
+    {
+      return (3 * C_OLSR_ARENA::get_block_size(capacity * sizeof(T_UINT8)))
+          + C_OLSR_ARENA::get_block_size(capacity * sizeof(T_FLOAT));
+    }
+
+  private:
+
+    std::pmr::vector<T_UINT8> m_route_wills;        /* Routing willingness */
+    std::pmr::vector<T_UINT8> m_flood_wills;        /* Flooding willingness */
+    std::pmr::vector<T_UINT8> m_symmetric;          /* n_symmetric, 0 or 1 */
+    std::pmr::vector<T_FLOAT> m_in_metrics;         /* n_in_metric */
+  };
+
+}
+
+#endif /* OLSR_TUPLE_COLUMNS_HPP_ */
@@ -25,6 +25,8 @@
 #include <iostream>
 #include <stdint.h>
 #include <vector>
+#include <map>
+#include <memory_resource>
 #include <array>
 #include "time.h"	        /* Include file for Time functionality */
 #include "olsr_utility.hpp"        /* Include file for basic utilities */
@@ -38,10 +40,13 @@ namespace ns_olsr2_0
 {
 #define M_HELLO_INTERVAL 1                              /* Periodic interval of Hello message */
 #define M_TC_INTERVAL 2                                 /* Periodic interval of Tc message */
-#define M_HELLO_MSG_VALID__TIME (3 * M_HELLO_INTERVAL)    /* Validity Time  of Hello message */
-#define M_TC_MSG_VALID_TIME (3 * M_TC_INTERVAL)           /* Validity Time  of Tc message */
+#define M_VALIDITY_INTERVAL_FACTOR 3                    /* Validity time of a periodic message in intervals */
+#define M_HELLO_MSG_VALID__TIME (M_VALIDITY_INTERVAL_FACTOR * M_HELLO_INTERVAL)    /* Validity Time  of Hello message */
+#define M_TC_MSG_VALID_TIME (M_VALIDITY_INTERVAL_FACTOR * M_TC_INTERVAL)           /* Validity Time  of Tc message */
 #define M_DUP_MSG_HOLD_TIME  30                         /* Validity time of duplicate message */
 #define M_MAX_MSG_SEQ_NUM  65535                        /* Max sequence number of OLSR message */
+#define M_MSEC_PER_SEC     1000                         /* Time resolution of the instance is one milli second */
+#define M_MAX_JITTER_DIVISOR 4                          /* Max jitter is a quarter of the message interval (RFC 5148) */
 
 #define LOST_LINK        0X1    /* Link is lost */
 #define HEARD_LINK       0X2    /* Link is heard */
@@ -61,7 +66,57 @@ namespace ns_olsr2_0
 #define MAX_OLSR_BUF_SIZE   512     /* Maximum buffer size of a OLSR message */
 #define UNKNOWN_METRIC  0xFF    /* link metric value which is unknown  */
 
-typedef long long int Time;
+typedef long long int Time;     /* Time in milli seconds */
+
+/**
+ * Validity time of a tuple, kept as the low 32 bits of the milli second
+ * time. The comparisons use wrap around arithmetic, so they stay right
+ * on a clock running for years as long as the two times compared are
+ * less than 24 days apart, which holds for validity times of seconds or
+ * minutes compared with the current time.
+ */
+class C_TUPLE_TIME
+{
+
+public:
+  C_TUPLE_TIME() = default;
+
+  C_TUPLE_TIME(Time time) : m_time((T_UINT32)time) {}
+
+  /* Full time, given a reference less than 24 days away such as the current time */
+  Time
+  to_time (Time reference) const
+  {
+    return reference + get_distance(reference);
+  }
+
+  T_UINT32
+  get_raw () const
+  {
+    return m_time;
+  }
+
+  bool operator< (Time time) const { return (get_distance(time) < 0); }
+
+  bool operator<= (Time time) const { return (get_distance(time) <= 0); }
+
+  bool operator> (Time time) const { return (get_distance(time) > 0); }
+
+  bool operator>= (Time time) const { return (get_distance(time) >= 0); }
+
+  bool operator< (const C_TUPLE_TIME& other) const { return ((T_INT32)(m_time - other.m_time) < 0); }
+
+private:
+
+  T_UINT32 m_time;                      /* Low 32 bits of the time */
+
+  /* Signed milli seconds from time to this one */
+  T_INT32
+  get_distance (Time time) const
+  {
+    return (T_INT32)(m_time - (T_UINT32)time);
+  }
+};
 
 
 /**
@@ -102,7 +157,7 @@ typedef enum
   LEADER_NODE_INSTANCE = 0X1
 }E_OLSR_INSTANCE;
 
-typedef enum
+typedef enum : T_UINT8               /* One byte, so that U_WILLINGNESS packs into one byte */
 {
   WILL_NEVER = 0X0,
   WILL_LOW = 0X1,
@@ -178,6 +233,16 @@ operator == (const T_NODE_ADDRESS& addr_a, const T_NODE_ADDRESS& addr_b)
   return((addr_a.net_id == addr_b.net_id) and (addr_a.node_id == addr_b.node_id));
 }
 
+/**
+ * Checks if sequence number seq_a is newer than seq_b, taking the
+ * wrap around of 16 bit sequence numbers into account
+ */
+static inline T_BOOL
+is_seq_num_newer (T_UINT16 seq_a, T_UINT16 seq_b)
+{
+  return ((T_INT16)(seq_a - seq_b) > 0);
+}
+
 /**
  * Leader address block shared in hello message
  */
@@ -196,14 +261,17 @@ typedef struct
  */
 typedef struct
 {
-	T_FLOAT l_in_metric;		                            /* Incoming data-link metric from 1-hop neighbor node to local node*/
-	T_FLOAT l_out_metric;		                            /* Outgoing data-link metric from local node to 1-hop neighbor node */
-	T_BOOL l_mpr_selector;	                                /* True if the 1-hop neighbor selected this local node as flooding MPR */
+	/* Hot fields, read by the lookups and the expiry sweep */
 	T_NODE_ADDRESS  l_neighbor_iface_addr;                  /* The address of that interface of the 1-hop neighbor */
-	Time l_heard_time;		                                /* the validity time of this incoming link */
-	Time l_sym_time;		                                /* Validity time of this symmetric link */
-	Time l_time;			                                /* Validity time of this link */
 	T_UINT8 l_status;                                       /* Status of this link */
+	T_BOOL l_mpr_selector : 1;	                            /* True if the 1-hop neighbor selected this local node as flooding MPR */
+	C_TUPLE_TIME l_time;			                        /* Validity time of this link */
+	C_TUPLE_TIME l_sym_time;		                        /* Validity time of this symmetric link */
+	C_TUPLE_TIME l_heard_time;		                        /* the validity time of this incoming link */
+
+	/* Cold fields, read when a HELLO is built or the MPRs are computed */
+	T_FLOAT l_in_metric;		                            /* Incoming data-link metric from 1-hop neighbor node to local node*/
+	T_FLOAT l_out_metric;		                            /* Outgoing data-link metric from local node to 1-hop neighbor node */
 }T_LINK_TUPLE;
 
 /**
@@ -211,11 +279,14 @@ typedef struct
  */
 typedef struct
 {
-	T_FLOAT n2_in_metric;	                                /* Incoming neighbor metric from 1-hop neighbor node to local node*/
-	T_FLOAT n2_out_metric;                                  /* Outgoing neighbor metric from local node to 1-hop neighbor node */
+	/* Hot fields, read by the lookups and the expiry sweep */
 	T_NODE_ADDRESS n2_neighbor_iface_addr;     /* The address of that interface of 1-hop neighbor which has a symmetric connection to this 2-hop neighbor */
 	T_NODE_ADDRESS n2_2hop_addr;	                        /* Ip address of the 2-hop neighbor */
-	Time n2_time;		                                    /* Validity time of this 2-hop connection */
+	C_TUPLE_TIME n2_time;		                            /* Validity time of this 2-hop connection */
+
+	/* Cold fields, read when the MPRs are computed */
+	T_FLOAT n2_in_metric;	                                /* Incoming neighbor metric from 1-hop neighbor node to local node*/
+	T_FLOAT n2_out_metric;                                  /* Outgoing neighbor metric from local node to 1-hop neighbor node */
 }T_TWO_HOP_NEIGHBOUR_TUPLE;
 
 /*------------------------------------------------------------------
@@ -227,17 +298,31 @@ typedef struct
  */
 typedef struct
 {
+	/* Hot fields, read by the lookups */
 	T_NODE_ADDRESS n_neighbor_addr;	                        /* Address of the 1-hop neighbor */
+	U_WILLINGNESS n_willingness;                                  /* bits 0-3 - Flooding Will and bits 4-7 Routing Willingness */
+	T_BOOL n_symmetric : 1;		                            /* True if the connection is symmetric */
+	T_BOOL n_flooding_mpr : 1;	                            /* True if this neighbor is a flooding MPR */
+	T_BOOL n_routing_mpr : 1;		                        /* True if this neighbor is a routing MPR */
+	T_BOOL n_mpr_selector : 1;	                            /* True if this neighbor selected this local node as a Routing MPR */
+	T_BOOL n_advertised : 1;		                        /* True if n_mpr_selector is True */
+
+	/* Cold fields, read when the MPRs are computed */
 	T_FLOAT n_in_metric;	                                /* Neighbor In metric */
 	T_FLOAT n_out_metric;	                                /* Neighbor out metric */
-	U_WILLINGNESS n_willingness;                                  /* bits 0-3 - Flooding Will and bits 4-7 Routing Willingness */
-	T_BOOL n_symmetric;		                                /* True if the connection is symmetric */
-	T_BOOL n_flooding_mpr;	                                /* True if this neighbor is a flooding MPR */
-	T_BOOL n_routing_mpr;		                            /* True if this neighbor is a routing MPR */
-	T_BOOL n_mpr_selector;	                                /* True if this neighbor selected this local node as a Routing MPR */
-	T_BOOL n_advertised;		                            /* True if n_mpr_selector is True */
 }T_NEIGHBOUR_TUPLE;
 
+/**
+ * holds a neighbor advertised in the TC messages of this node, a
+ * symmetric neighbor having selected it as a Routing MPR
+ */
+typedef struct
+{
+	T_NODE_ADDRESS a_neighbor_addr;                         /* Address of the advertised neighbor */
+	T_FLOAT a_out_metric;                                   /* n_out_metric, sent as the out metric of the address */
+	T_FLOAT a_in_metric;                                    /* n_in_metric, sent as the in metric of the address */
+}T_ADVERTISED_NEIGHBOUR_TUPLE;
+
 /*------------------------------------------------------------------
 3) Topology Information Base
 --------------------------------------------------------------------*/
@@ -249,7 +334,10 @@ typedef struct
 {
 	T_NODE_ADDRESS ar_orig_addr;	                            /* Originator address of the TC message(Routing MPR) */
 	T_UINT16 ar_seq_number;			                        /* Advertised neighbor sequence number */
-	Time ar_time;				                            /* Validity time of this tuple */
+	C_TUPLE_TIME ar_time;				                    /* Validity time of this tuple and of its router topology tuples */
+	T_UINT32 ar_first;                                      /* First router topology tuple of the originator's slab */
+	T_UINT16 ar_count;                                      /* Router topology tuples of the slab */
+	T_UINT16 ar_capacity;                                   /* Tuples the slab holds before it moves */
 }T_ADVERTISING_REMOTE_ROUTER_TUPLE;
 
 /**
@@ -260,8 +348,8 @@ typedef struct
 	T_NODE_ADDRESS tr_from_orig_addr;	                        /* Originator address of the TC message(Routing MPR) */
 	T_NODE_ADDRESS tr_to_orig_addr;	                        /* Originator Address of the node who is a routing MPR selector of TC message originator*/
 	T_UINT16 tr_seq_number;		                            /* Advertised neighbor sequence number */
+	C_TUPLE_TIME tr_time;			                        /* Validity time of this tuple, in the state the one of its slab */
 	T_FLOAT tr_metric;		                                /* Out metric between the TC message originator and its routing MPR  selector*/
-	Time tr_time;			                                /* Validity time of this tuple */
 }T_ROUTER_TOPOLOGY_TUPLE;
 
 /**
@@ -393,10 +481,10 @@ typedef struct
  */
 typedef struct
 {
-	E_OLSR_MSG_TYPE p_type;		                            /* Processed message type */
 	T_NODE_ADDRESS p_orig_addr;	                            /* Originator address of the sender */
 	T_UINT16 p_seq_number;		                            /* Sequence number */
-	Time p_time;			                                /* Validity time of this tuple */
+	C_TUPLE_TIME p_time;			                        /* Validity time of this tuple */
+	E_OLSR_MSG_TYPE p_type : 8;		                        /* Processed message type */
 }T_PROCESSED_MSG_TUPLE;
 
 /**
@@ -404,32 +492,36 @@ typedef struct
  */
 typedef struct
 {
-	E_OLSR_MSG_TYPE f_type;		                            /* Forwarded message type */
 	T_NODE_ADDRESS f_orig_addr;	                            /* Originator address of the receiver */
 	T_UINT16 f_seq_number;	                                /* Sequence number */
-	Time f_time;                                            /* Validity time of this tuple */
+	C_TUPLE_TIME f_time;                                    /* Validity time of this tuple */
+	E_OLSR_MSG_TYPE f_type : 8;		                        /* Forwarded message type */
 }T_FORWARDED_MSG_TUPLE;
 
 
-typedef std::vector<T_LINK_TUPLE> LinkSet;                                              /* Link Set */
+typedef std::pmr::vector<T_LINK_TUPLE> LinkSet;                                         /* Link Set */
 
 typedef std::vector<T_NODE_ADDRESS> RoutingMprSet;                                         /* Routing MPR address Set */
 
 typedef std::vector<T_NODE_ADDRESS> FloodingMprSet;                                        /* Flooding MPR address  Set */
 
-typedef std::vector<T_TWO_HOP_NEIGHBOUR_TUPLE> TwoHopNeighborSet;                       /* 2-hop neighbor address  Set */
+typedef std::pmr::vector<T_TWO_HOP_NEIGHBOUR_TUPLE> TwoHopNeighborSet;                  /* 2-hop neighbor address  Set */
+
+typedef std::pmr::vector<T_NEIGHBOUR_TUPLE> NeighbourSet;	                                /*  1-hop neighbor address Set */
+
+typedef std::pmr::vector<T_ADVERTISED_NEIGHBOUR_TUPLE> AdvertisedNeighbourSet;	            /*  Advertised neighbor address Set */
 
-typedef std::vector<T_NEIGHBOUR_TUPLE> NeighbourSet;	                                /*  1-hop neighbor address Set */
+typedef std::pmr::vector<T_ADVERTISING_REMOTE_ROUTER_TUPLE> AdvertisingRemoteRouterSet;	    /*  Advertising remote router address Set */
 
-typedef std::vector<T_ADVERTISING_REMOTE_ROUTER_TUPLE> AdvertisingRemoteRouterSet;	    /*  Advertising remote router address Set */
+typedef std::pmr::vector<T_ROUTER_TOPOLOGY_TUPLE> RouterTopologySet;	                        /*  Router topology address Set */
 
-typedef std::vector<T_ROUTER_TOPOLOGY_TUPLE> RouterTopologySet;	                        /*  Router topology address Set */
+typedef std::pmr::vector<T_PROCESSED_MSG_TUPLE> ProcessedMsgSet;	                            /*  Processed  message Set */
 
-typedef std::vector<T_PROCESSED_MSG_TUPLE> ProcessedMsgSet;	                            /*  Processed  message Set */
+typedef std::pmr::vector<T_FORWARDED_MSG_TUPLE> ForwardedMsgSet;	                            /*  Forwarded  message Set */
 
-typedef std::vector<T_FORWARDED_MSG_TUPLE> ForwardedMsgSet;	                            /*  Forwarded  message Set */
+typedef std::pmr::vector <T_ROUTING_TABLE_ENTRY> RoutingSet;                            /*  Routing table Set */
 
-typedef std::vector <T_ROUTING_TABLE_ENTRY> RoutingSet;                                 /*  Routing table Set */
+typedef std::pmr::map<T_NODE_ADDRESS, T_ROUTING_TABLE_ENTRY> RoutingTable;              /*  Routing table by destination */
 
 T_BOOL get_is_leader(void);
 Time get_cur_time();
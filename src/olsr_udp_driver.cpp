@@ -0,0 +1,332 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_udp_driver.cpp
+ *
+ * Description        :   Implements the loopback throughput driver of the olsr UDP transport .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include "olsr_udp_driver.hpp"
+
+using namespace std;
+
+namespace ns_olsr2_0
+{
+#define M_UDP_NODES_PER_NET         254         /* Node ids of one orthogonal net */
+
+  /********************************************************************
+   * @function  C_OLSR_UDP_DRIVER
+   * @brief     This function is the constructor of C_OLSR_UDP_DRIVER,
+   *            it binds the socket of each instance, connects the ring
+   *            and starts the instances.
+   * @param     config.
+   * @return    None.
+   * @note      An instance whose socket cannot be bound is not started.
+  ********************************************************************/
+  C_OLSR_UDP_DRIVER::C_OLSR_UDP_DRIVER(const T_UDP_DRIVER_CONFIG& config)
+    : m_config(config)
+  {
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+
+    m_config.node_count = std::max(m_config.node_count, (T_UINT32)2);
+    m_config.degree = std::min(std::max(m_config.degree, (T_UINT32)1), m_config.node_count - 1);
+    m_open_failures = 0;
+
+    set_olsr_clock(&m_clock);
+
+    for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+      {
+        m_nodes.push_back(std::unique_ptr<C_OLSR>(new C_OLSR()));
+        m_nodes.back()->set_node_addr(get_node_address(idx));
+        m_transports.push_back(std::unique_ptr<C_UDP_TRANSPORT>(new C_UDP_TRANSPORT(m_nodes.back().get(), m_config.base_port)));
+      }
+
+    for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+      {
+        if(m_transports[idx]->open_socket() == false)
+          {
+            m_open_failures++;
+            continue;
+          }
+
+        /* The nodes closest on the ring, one side after the other */
+        for(T_UINT32 peer = 0; peer < m_config.degree; peer++)
+          {
+            T_UINT32 step = 1 + (peer / 2);
+            T_UINT32 peer_idx = ((peer % 2) == 0) ? ((idx + step) % m_config.node_count)
+                                                  : ((idx + m_config.node_count - step) % m_config.node_count);
+
+            m_transports[idx]->add_peer(get_node_address(peer_idx));
+          }
+
+        m_nodes[idx]->init(NORMAL_NODE_INSTANCE);
+      }
+
+    set_olsr_clock(prev_clock);
+  }
+
+  /********************************************************************
+   * @function  ~C_OLSR_UDP_DRIVER
+   * @brief     This function is the destructor of C_OLSR_UDP_DRIVER.
+   * @param     None.
+   * @return    None.
+   * @note      The transports are closed before their instances.
+  ********************************************************************/
+  C_OLSR_UDP_DRIVER::~C_OLSR_UDP_DRIVER()
+  {
+    m_transports.clear();
+  }
+
+  /********************************************************************
+   * @function  get_default_config
+   * @brief     This function returns a ring of 64 nodes of degree 8
+   *            run for two minutes of protocol time, then saturated
+   *            for two seconds.
+   * @param     None.
+   * @return    config.
+   * @note      None.
+  ********************************************************************/
+  T_UDP_DRIVER_CONFIG C_OLSR_UDP_DRIVER::get_default_config(void)
+  {
+    T_UDP_DRIVER_CONFIG config;
+
+    config.node_count = 64;
+    config.degree = 8;
+    config.duration = 120 * M_MSEC_PER_SEC;
+    config.base_port = M_UDP_DEFAULT_BASE_PORT;
+    config.saturate_duration = M_UDP_DEFAULT_SATURATE_MS;
+
+    return config;
+  }
+
+  /********************************************************************
+   * @function  get_node_address
+   * @brief     This function returns the address of a node, 254 nodes
+   *            per orthogonal net.
+   * @param     idx.
+   * @return    Node address.
+   * @note      None.
+  ********************************************************************/
+  T_NODE_ADDRESS C_OLSR_UDP_DRIVER::get_node_address(T_UINT32 idx)
+  {
+    T_NODE_ADDRESS node_addr;
+
+    node_addr.net_id = 1 + (idx / M_UDP_NODES_PER_NET);
+    node_addr.node_id = 1 + (idx % M_UDP_NODES_PER_NET);
+
+    return node_addr;
+  }
+
+  /********************************************************************
+   * @function  run
+   * @brief     This function runs the instances for the configured
+   *            protocol time and measures their datagram rates.
+   * @param     None.
+   * @return    report.
+   * @note      Each pass runs every instance and flushes its socket,
+   *            then drains every socket. The clock only moves to the
+   *            next timer after a pass which moved no datagram, since
+   *            the loopback delivers a datagram during its sendmmsg.
+  ********************************************************************/
+  T_UDP_DRIVER_REPORT C_OLSR_UDP_DRIVER::run(void)
+  {
+    typedef std::chrono::steady_clock T_DRIVER_CLOCK;
+
+    T_UDP_DRIVER_REPORT report = T_UDP_DRIVER_REPORT();
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+    Time end_time = m_clock.now() + m_config.duration;
+
+    set_olsr_clock(&m_clock);
+
+    T_DRIVER_CLOCK::time_point wall_start = T_DRIVER_CLOCK::now();
+
+    while(m_clock.now() < end_time)
+      {
+        T_UINT32 moved = 0;
+
+        for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+          {
+            m_nodes[idx]->run();
+            moved += m_transports[idx]->flush();
+          }
+
+        for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+          {
+            moved += m_transports[idx]->poll(0);
+          }
+
+        if(moved == 0)
+          {
+            Time next_deadline = end_time;
+
+            for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+              {
+                next_deadline = std::min(next_deadline, m_nodes[idx]->next_deadline());
+              }
+            m_clock.advance_to(next_deadline);
+          }
+      }
+
+    report.wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(T_DRIVER_CLOCK::now() - wall_start).count();
+
+    set_olsr_clock(prev_clock);
+
+    report.open_failures = m_open_failures;
+
+    for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+      {
+        const T_UDP_TRANSPORT_COUNTERS& counters = m_transports[idx]->get_counters();
+
+        report.tx_packets += counters.tx_packets;
+        report.tx_bytes += counters.tx_bytes;
+        report.tx_errors += counters.tx_errors;
+        report.rx_packets += counters.rx_packets;
+        report.rx_bytes += counters.rx_bytes;
+        report.rx_dropped += counters.rx_dropped;
+      }
+
+    report.tx_packets_per_sec = (report.wall_ns != 0) ? ((double)report.tx_packets * 1e9 / report.wall_ns) : 0;
+    report.rx_packets_per_sec = (report.wall_ns != 0) ? ((double)report.rx_packets * 1e9 / report.wall_ns) : 0;
+
+    if(m_config.saturate_duration > 0)
+      {
+        run_saturated(report);
+      }
+
+    return report;
+  }
+
+  /********************************************************************
+   * @function  run_saturated
+   * @brief     This function has each instance build a HELLO and a TC,
+   *            then replays them until the saturation time is over,
+   *            one batch per socket and pass, each pass draining all
+   *            the sockets.
+   * @param     report.
+   * @return    None.
+   * @note      The replayed messages are renumbered, so each one is
+   *            decoded and processed by its receivers on their next
+   *            run. The clock does not move, so no tuple expires
+   *            during the replay.
+  ********************************************************************/
+  void C_OLSR_UDP_DRIVER::run_saturated(T_UDP_DRIVER_REPORT& report)
+  {
+    typedef std::chrono::steady_clock T_DRIVER_CLOCK;
+
+    C_OLSR_CLOCK* prev_clock = get_olsr_clock();
+    T_UINT64 tx_packets = 0, tx_errors = 0, rx_packets = 0;
+
+    set_olsr_clock(&m_clock);
+
+    for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+      {
+        const T_UDP_TRANSPORT_COUNTERS& counters = m_transports[idx]->get_counters();
+
+        tx_packets += counters.tx_packets;
+        tx_errors += counters.tx_errors;
+        rx_packets += counters.rx_packets;
+
+        if(m_transports[idx]->get_socket_fd() < 0)
+          {
+            continue;
+          }
+
+        m_transports[idx]->set_capture(true);
+        m_nodes[idx]->send_hello();
+        m_nodes[idx]->send_tc();
+        m_nodes[idx]->send_olsr_msg();
+        m_transports[idx]->set_capture(false);
+      }
+
+    T_DRIVER_CLOCK::time_point wall_start = T_DRIVER_CLOCK::now();
+    T_DRIVER_CLOCK::time_point wall_end = wall_start + std::chrono::milliseconds(m_config.saturate_duration);
+
+    while(T_DRIVER_CLOCK::now() < wall_end)
+      {
+        for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+          {
+            m_nodes[idx]->run();
+            m_transports[idx]->flush();
+            m_transports[idx]->replay();
+          }
+
+        for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+          {
+            m_transports[idx]->poll(0);
+          }
+      }
+
+    /* The datagrams still queued in the sockets are received and processed too */
+    for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+      {
+        m_transports[idx]->poll(0);
+        m_nodes[idx]->run();
+      }
+
+    report.sat_wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(T_DRIVER_CLOCK::now() - wall_start).count();
+
+    set_olsr_clock(prev_clock);
+
+    for(T_UINT32 idx = 0; idx < m_config.node_count; idx++)
+      {
+        const T_UDP_TRANSPORT_COUNTERS& counters = m_transports[idx]->get_counters();
+
+        report.sat_tx_packets += counters.tx_packets;
+        report.sat_tx_errors += counters.tx_errors;
+        report.sat_rx_packets += counters.rx_packets;
+      }
+
+    report.sat_tx_packets -= tx_packets;
+    report.sat_tx_errors -= tx_errors;
+    report.sat_rx_packets -= rx_packets;
+    report.sat_tx_packets_per_sec = (report.sat_wall_ns != 0) ? ((double)report.sat_tx_packets * 1e9 / report.sat_wall_ns) : 0;
+    report.sat_rx_packets_per_sec = (report.sat_wall_ns != 0) ? ((double)report.sat_rx_packets * 1e9 / report.sat_wall_ns) : 0;
+  }
+
+  /********************************************************************
+   * @function  print_report
+   * @brief     This function prints the ring and its throughput.
+   * @param     config, report.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_OLSR_UDP_DRIVER::print_report(const T_UDP_DRIVER_CONFIG& config, const T_UDP_DRIVER_REPORT& report)
+  {
+    cout << "UDP nodes = " << config.node_count << " degree = " << config.degree
+         << " duration = " << config.duration << " ms base port = " << config.base_port << endl;
+    if(report.open_failures != 0)
+      {
+        cout << "Sockets not bound = " << report.open_failures << endl;
+      }
+    cout << "Wall time = " << report.wall_ns << " ns" << endl;
+    cout << "Tx packets = " << report.tx_packets << " (" << report.tx_bytes << " bytes) errors = " << report.tx_errors
+         << " packets per second = " << report.tx_packets_per_sec << endl;
+    cout << "Rx packets = " << report.rx_packets << " (" << report.rx_bytes << " bytes) dropped = " << report.rx_dropped
+         << " packets per second = " << report.rx_packets_per_sec << endl;
+    if(config.saturate_duration > 0)
+      {
+        cout << "Saturated wall time = " << report.sat_wall_ns << " ns" << endl;
+        cout << "Saturated tx packets = " << report.sat_tx_packets << " errors = " << report.sat_tx_errors
+             << " packets per second = " << report.sat_tx_packets_per_sec << endl;
+        cout << "Saturated rx packets = " << report.sat_rx_packets
+             << " packets per second = " << report.sat_rx_packets_per_sec << endl;
+      }
+  }
+
+}
@@ -0,0 +1,112 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_udp_driver.hpp
+ *
+ * Description        :   To store the loopback throughput driver of the olsr UDP transport .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_UDP_DRIVER_HPP_
+#define OLSR_UDP_DRIVER_HPP_
+
+#include <memory>
+#include "olsr_udp_transport.hpp"    /* Include file for the UDP transport */
+
+namespace ns_olsr2_0
+{
+#define M_UDP_DEFAULT_BASE_PORT     40000       /* Port of the node address 0.0 */
+#define M_UDP_DEFAULT_SATURATE_MS   2000        /* Wall time of the saturated replay */
+
+  /**
+   * Instances run over the loopback
+   */
+  typedef struct
+  {
+    T_UINT32 node_count;                /* Instances, one UDP socket each */
+    T_UINT32 degree;                    /* 1-hop neighbors of each node on the ring, even for symmetric links */
+    Time duration;                      /* Protocol time run, in milli seconds */
+    T_UINT16 base_port;                 /* Port of the node address 0.0 */
+    Time saturate_duration;             /* Wall time of the saturated replay in milli seconds, 0 for none */
+  }T_UDP_DRIVER_CONFIG;
+
+  /**
+   * Results of a loopback run
+   */
+  typedef struct
+  {
+    T_UINT32 open_failures;             /* Instances whose socket could not be bound */
+    T_UINT64 wall_ns;                   /* Wall time of the run */
+    T_UINT64 tx_packets;                /* Datagrams sent by all the instances */
+    T_UINT64 tx_bytes;
+    T_UINT64 tx_errors;                 /* Datagrams the sockets refused */
+    T_UINT64 rx_packets;                /* Datagrams received by all the instances */
+    T_UINT64 rx_bytes;
+    T_UINT64 rx_dropped;                /* Truncated or unknown sender datagrams */
+    double tx_packets_per_sec;          /* Datagrams sent per second of wall time */
+    double rx_packets_per_sec;          /* Datagrams received per second of wall time */
+    T_UINT64 sat_wall_ns;               /* Wall time of the saturated replay */
+    T_UINT64 sat_tx_packets;            /* Datagrams replayed */
+    T_UINT64 sat_tx_errors;             /* Replayed datagrams the sockets refused */
+    T_UINT64 sat_rx_packets;            /* Replayed datagrams received and processed */
+    double sat_tx_packets_per_sec;      /* Datagrams replayed per second of wall time */
+    double sat_rx_packets_per_sec;      /* Replayed datagrams received per second of wall time */
+  }T_UDP_DRIVER_REPORT;
+
+  /**
+   * Runs instances in one thread, each on its own UDP socket on the
+   * loopback, connected as a ring where each node sends to the degree
+   * nodes closest to it. The instances share a virtual clock which
+   * jumps to the next timer once no datagram is in flight, so the wall
+   * time is spent in the stack: encoding, sendmmsg, the kernel,
+   * recvmmsg, decoding and processing. That rate follows the timers of
+   * the protocol, the saturated replay which follows it keeps the
+   * sockets full with the HELLO and TC packets of the converged ring,
+   * and gives the highest rate of the stack.
+   */
+  class C_OLSR_UDP_DRIVER
+  {
+
+  public:
+    C_OLSR_UDP_DRIVER(const T_UDP_DRIVER_CONFIG& config);
+
+    ~C_OLSR_UDP_DRIVER();
+
+    static T_UDP_DRIVER_CONFIG get_default_config(void);
+
+    T_UDP_DRIVER_REPORT run(void);      /* Runs the instances and returns the throughput */
+
+    static void print_report(const T_UDP_DRIVER_CONFIG& config, const T_UDP_DRIVER_REPORT& report);
+
+  private:
+
+    T_UDP_DRIVER_CONFIG m_config;
+
+    C_VIRTUAL_CLOCK m_clock;            /* Clock of the instances */
+
+    std::vector<std::unique_ptr<C_OLSR> > m_nodes;
+
+    std::vector<std::unique_ptr<C_UDP_TRANSPORT> > m_transports;       /* Transport of the node of the same index */
+
+    T_UINT32 m_open_failures;           /* Sockets that could not be bound */
+
+    static T_NODE_ADDRESS get_node_address(T_UINT32 idx);
+
+    void run_saturated(T_UDP_DRIVER_REPORT& report);      /* Replays the packets of the instances as fast as the sockets take them */
+  };
+
+}
+
+#endif /* OLSR_UDP_DRIVER_HPP_ */
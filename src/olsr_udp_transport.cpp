@@ -0,0 +1,461 @@
+/*                        Project title
+ *
+ *
+ * Source Code Name   :   olsr_udp_transport.cpp
+ *
+ * Description        :   Implements the Linux UDP transport of an olsr instance .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 | Shreehari H K    |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#include <cstring>
+#include <algorithm>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include "olsr_udp_transport.hpp"
+
+namespace ns_olsr2_0
+{
+
+  /********************************************************************
+   * @function  C_UDP_TRANSPORT
+   * @brief     This function is the constructor of C_UDP_TRANSPORT, it
+   *            links the receive headers to the pre allocated buffers.
+   * @param     node, base_port, bind_addr.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_UDP_TRANSPORT::C_UDP_TRANSPORT(C_OLSR* node, T_UINT16 base_port, in_addr_t bind_addr)
+  {
+    m_node = node;
+    m_base_port = base_port;
+    m_bind_addr = bind_addr;
+    m_socket_fd = -1;
+    m_epoll_fd = -1;
+    m_tx_packet_count = 0;
+    m_tx_msg_count = 0;
+    m_capture = false;
+    m_replay_next = 0;
+    m_replay_seq_num = 0;
+
+    std::memset(&m_counters, 0, sizeof(m_counters));
+    std::memset(m_rx_msgs.data(), 0, sizeof(m_rx_msgs));
+    std::memset(m_tx_msgs.data(), 0, sizeof(m_tx_msgs));
+
+    for(T_UINT32 idx = 0; idx < M_UDP_BATCH_SIZE; idx++)
+      {
+        m_rx_iov[idx].iov_base = m_rx_slots[idx].packet.get_buffer();
+        m_rx_iov[idx].iov_len = MAX_OLSR_BUF_SIZE;
+        m_rx_msgs[idx].msg_hdr.msg_iov = &m_rx_iov[idx];
+        m_rx_msgs[idx].msg_hdr.msg_iovlen = 1;
+        m_rx_msgs[idx].msg_hdr.msg_name = &m_rx_addr[idx];
+
+        m_tx_iov[idx].iov_base = m_tx_packets[idx].get_buffer();
+      }
+
+    m_node->set_transport(this);
+  }
+
+  /********************************************************************
+   * @function  ~C_UDP_TRANSPORT
+   * @brief     This function is the destructor of C_UDP_TRANSPORT.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  C_UDP_TRANSPORT::~C_UDP_TRANSPORT()
+  {
+    m_node->set_transport(NULL);
+    close_socket();
+  }
+
+  /********************************************************************
+   * @function  get_node_port
+   * @brief     This function returns the UDP port of a node.
+   * @param     base_port, node_address.
+   * @return    port.
+   * @note      None.
+  ********************************************************************/
+  T_UINT16 C_UDP_TRANSPORT::get_node_port(T_UINT16 base_port, const T_NODE_ADDRESS& node_address)
+  {
+    return (T_UINT16)(base_port + ((node_address.net_id << 8) | node_address.node_id));
+  }
+
+  /********************************************************************
+   * @function  open_socket
+   * @brief     This function opens a non blocking UDP socket on the
+   *            port of the node and registers it to epoll.
+   * @param     None.
+   * @return    false on a socket error.
+   * @note      None.
+  ********************************************************************/
+  T_BOOL C_UDP_TRANSPORT::open_socket(void)
+  {
+    struct sockaddr_in local_addr;
+    struct epoll_event event;
+
+    m_socket_fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    if(m_socket_fd < 0)
+      {
+        return false;
+      }
+
+    std::memset(&local_addr, 0, sizeof(local_addr));
+    local_addr.sin_family = AF_INET;
+    local_addr.sin_addr.s_addr = m_bind_addr;
+    local_addr.sin_port = htons(get_node_port(m_base_port, m_node->get_node_addr()));
+
+    if(bind(m_socket_fd, (struct sockaddr*)&local_addr, sizeof(local_addr)) < 0)
+      {
+        close_socket();
+        return false;
+      }
+
+    m_epoll_fd = epoll_create1(0);
+    if(m_epoll_fd < 0)
+      {
+        close_socket();
+        return false;
+      }
+
+    event.events = EPOLLIN;
+    event.data.fd = m_socket_fd;
+    if(epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_socket_fd, &event) < 0)
+      {
+        close_socket();
+        return false;
+      }
+
+    return true;
+  }
+
+  /********************************************************************
+   * @function  close_socket
+   * @brief     This function closes the socket and epoll descriptors.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_UDP_TRANSPORT::close_socket(void)
+  {
+    if(m_epoll_fd >= 0)
+      {
+        close(m_epoll_fd);
+        m_epoll_fd = -1;
+      }
+    if(m_socket_fd >= 0)
+      {
+        close(m_socket_fd);
+        m_socket_fd = -1;
+      }
+  }
+
+  /********************************************************************
+   * @function  add_peer
+   * @brief     This function adds a 1-hop neighbor which receives the
+   *            packets of this node.
+   * @param     peer_address, peer_ip.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_UDP_TRANSPORT::add_peer(const T_NODE_ADDRESS& peer_address, in_addr_t peer_ip)
+  {
+    struct sockaddr_in peer_addr;
+
+    std::memset(&peer_addr, 0, sizeof(peer_addr));
+    peer_addr.sin_family = AF_INET;
+    peer_addr.sin_addr.s_addr = peer_ip;
+    peer_addr.sin_port = htons(get_node_port(m_base_port, peer_address));
+
+    m_peers.push_back(peer_addr);
+  }
+
+  /********************************************************************
+   * @function  send_packet
+   * @brief     This function copies a packet to a send buffer and
+   *            queues one datagram per peer.
+   * @param     olsr_packet.
+   * @return    None.
+   * @note      The datagrams leave on the next flush, or now if the
+   *            batch is full. The sender is the node of the socket.
+   *            While capturing, the packet is only kept for the
+   *            replay.
+  ********************************************************************/
+  void C_UDP_TRANSPORT::send_packet(const T_NODE_ADDRESS& /* sender_address */, const C_PACKET_HEADER& olsr_packet)
+  {
+    if((m_peers.empty() == true) or (olsr_packet.get_packet_length() == 0))
+      {
+        return;
+      }
+
+    if(m_capture == true)
+      {
+        m_replay_packets.push_back(olsr_packet);
+        return;
+      }
+
+    if((m_tx_packet_count == M_UDP_BATCH_SIZE) or ((m_tx_msg_count + m_peers.size()) > M_UDP_BATCH_SIZE))
+      {
+        flush();
+      }
+
+    T_UINT32 slot = m_tx_packet_count++;
+    std::memcpy(m_tx_packets[slot].get_buffer(), olsr_packet.get_buffer(), olsr_packet.get_packet_length());
+    m_tx_iov[slot].iov_len = olsr_packet.get_packet_length();
+
+    for(std::vector<struct sockaddr_in>::iterator peer_iter = m_peers.begin(); peer_iter != m_peers.end(); peer_iter++)
+      {
+        /* More peers than a batch holds are sent in several batches */
+        if(m_tx_msg_count == M_UDP_BATCH_SIZE)
+          {
+            T_UINT32 packet_len = m_tx_iov[slot].iov_len;
+            flush();
+            std::memcpy(m_tx_packets[0].get_buffer(), olsr_packet.get_buffer(), packet_len);
+            m_tx_iov[0].iov_len = packet_len;
+            m_tx_packet_count = 1;
+            slot = 0;
+          }
+
+        struct msghdr& msg_hdr = m_tx_msgs[m_tx_msg_count].msg_hdr;
+        msg_hdr.msg_name = &(*peer_iter);
+        msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        msg_hdr.msg_iov = &m_tx_iov[slot];
+        msg_hdr.msg_iovlen = 1;
+        m_tx_msg_count++;
+      }
+  }
+
+  /********************************************************************
+   * @function  flush
+   * @brief     This function sends the queued datagrams with sendmmsg.
+   * @param     None.
+   * @return    Number of datagrams sent.
+   * @note      Datagrams the socket cannot take now are dropped, as
+   *            OLSR repeats its messages.
+  ********************************************************************/
+  T_UINT32 C_UDP_TRANSPORT::flush(void)
+  {
+    T_UINT32 sent = 0;
+
+    while(sent < m_tx_msg_count)
+      {
+        int result = sendmmsg(m_socket_fd, &m_tx_msgs[sent], m_tx_msg_count - sent, MSG_DONTWAIT);
+        m_counters.tx_batches++;
+
+        if(result < 0)
+          {
+            if(errno == EINTR)
+              {
+                continue;
+              }
+            m_counters.tx_errors += (m_tx_msg_count - sent);
+            break;
+          }
+
+        for(int idx = 0; idx < result; idx++)
+          {
+            m_counters.tx_bytes += m_tx_msgs[sent + idx].msg_len;
+          }
+        m_counters.tx_packets += result;
+        sent += result;
+      }
+
+    m_tx_msg_count = 0;
+    m_tx_packet_count = 0;
+
+    return sent;
+  }
+
+  /********************************************************************
+   * @function  receive_batch
+   * @brief     This function receives up to one batch of datagrams
+   *            and hands them to the instance.
+   * @param     None.
+   * @return    Number of datagrams received.
+   * @note      None.
+  ********************************************************************/
+  T_UINT32 C_UDP_TRANSPORT::receive_batch(void)
+  {
+    for(T_UINT32 idx = 0; idx < M_UDP_BATCH_SIZE; idx++)
+      {
+        m_rx_msgs[idx].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        m_rx_msgs[idx].msg_hdr.msg_flags = 0;
+      }
+
+    int result = recvmmsg(m_socket_fd, m_rx_msgs.data(), M_UDP_BATCH_SIZE, MSG_DONTWAIT, NULL);
+
+    if(result <= 0)
+      {
+        return 0;
+      }
+
+    m_counters.rx_batches++;
+
+    for(int idx = 0; idx < result; idx++)
+      {
+        C_OLSR::T_RX_PACKET& rx_slot = m_rx_slots[idx];
+        T_UINT16 sender_port = ntohs(m_rx_addr[idx].sin_port) - m_base_port;
+
+        if((m_rx_msgs[idx].msg_hdr.msg_flags & MSG_TRUNC) or (ntohs(m_rx_addr[idx].sin_port) < m_base_port))
+          {
+            m_counters.rx_dropped++;
+            continue;
+          }
+
+        rx_slot.packet.set_packet_length(m_rx_msgs[idx].msg_len);
+        rx_slot.sender_address.net_id = (T_UINT8)(sender_port >> 8);
+        rx_slot.sender_address.node_id = (T_UINT8)(sender_port & 0xFF);
+        rx_slot.receiver_address = m_node->get_node_addr();
+        rx_slot.l_in_metric = M_UDP_LINK_METRIC;
+
+        m_node->recv_olsr((void*)&rx_slot);
+
+        m_counters.rx_packets++;
+        m_counters.rx_bytes += m_rx_msgs[idx].msg_len;
+      }
+
+    return result;
+  }
+
+  /********************************************************************
+   * @function  poll
+   * @brief     This function waits for the socket to be readable and
+   *            drains it batch by batch.
+   * @param     timeout_ms - -1 waits without limit.
+   * @return    Number of datagrams received.
+   * @note      None.
+  ********************************************************************/
+  T_UINT32 C_UDP_TRANSPORT::poll(int timeout_ms)
+  {
+    struct epoll_event event;
+    T_UINT32 received = 0;
+
+    if(epoll_wait(m_epoll_fd, &event, 1, timeout_ms) <= 0)
+      {
+        return 0;
+      }
+
+    for(;;)
+      {
+        T_UINT32 batch = receive_batch();
+        received += batch;
+
+        if(batch < M_UDP_BATCH_SIZE)
+          {
+            break;
+          }
+      }
+
+    return received;
+  }
+
+  /********************************************************************
+   * @function  set_capture
+   * @brief     This function starts or stops keeping the packets sent
+   *            by the instance for the replay.
+   * @param     capture.
+   * @return    None.
+   * @note      The replay numbers its messages after the highest
+   *            sequence number kept.
+  ********************************************************************/
+  void C_UDP_TRANSPORT::set_capture(T_BOOL capture)
+  {
+    m_capture = capture;
+
+    for(std::vector<C_PACKET_HEADER>::const_iterator packet = m_replay_packets.begin(); packet != m_replay_packets.end(); packet++)
+      {
+        T_UINT16 offset = 0;
+        C_MESSAGE_HEADER::T_RAW_MSG_HEADER raw_header;
+
+        while(C_MESSAGE_HEADER::peek_header(packet->get_buffer() + offset, packet->get_packet_length() - offset, raw_header) == true)
+          {
+            m_replay_seq_num = std::max(m_replay_seq_num, raw_header.seq_num);
+            offset += raw_header.msg_len;
+          }
+      }
+  }
+
+  /********************************************************************
+   * @function  replay
+   * @brief     This function sends the kept packets in turn until one
+   *            batch of datagrams is queued, and flushes it.
+   * @param     None.
+   * @return    Number of datagrams sent.
+   * @note      Each message gets a new sequence number, so that the
+   *            receivers process it instead of dropping a duplicate.
+  ********************************************************************/
+  T_UINT32 C_UDP_TRANSPORT::replay(void)
+  {
+    T_UINT64 tx_packets = m_counters.tx_packets;
+
+    if((m_replay_packets.empty() == true) or (m_peers.empty() == true))
+      {
+        return 0;
+      }
+
+    T_UINT32 packet_count = std::max((T_UINT32)(M_UDP_BATCH_SIZE / m_peers.size()), (T_UINT32)1);
+
+    for(T_UINT32 idx = 0; idx < packet_count; idx++)
+      {
+        C_PACKET_HEADER& packet = m_replay_packets[m_replay_next];
+        T_UINT16 offset = 0;
+        C_MESSAGE_HEADER::T_RAW_MSG_HEADER raw_header;
+
+        m_replay_next = (m_replay_next + 1) % m_replay_packets.size();
+
+        while(C_MESSAGE_HEADER::peek_header(packet.get_buffer() + offset, packet.get_packet_length() - offset, raw_header) == true)
+          {
+            C_MESSAGE_HEADER::write_seq_num(packet.get_buffer() + offset, ++m_replay_seq_num);
+            offset += raw_header.msg_len;
+          }
+
+        send_packet(m_node->get_node_addr(), packet);
+      }
+
+    flush();
+
+    return (T_UINT32)(m_counters.tx_packets - tx_packets);
+  }
+
+  /********************************************************************
+   * @function  run_once
+   * @brief     This function is one iteration of the event loop, it
+   *            sleeps until the next timer of the instance or the next
+   *            datagram, runs the instance and sends its packets.
+   * @param     None.
+   * @return    None.
+   * @note      None.
+  ********************************************************************/
+  void C_UDP_TRANSPORT::run_once(void)
+  {
+    int timeout_ms = -1;
+    Time deadline = m_node->next_deadline();
+
+    if(deadline != M_TIME_INFINITE)
+      {
+        get_olsr_clock()->update();
+        Time wait_time = deadline - get_cur_time();
+
+        timeout_ms = (wait_time <= 0) ? 0 : ((wait_time > 0x7FFFFFFF) ? 0x7FFFFFFF : (int)wait_time);
+      }
+
+    poll(timeout_ms);
+
+    m_node->run();
+
+    flush();
+  }
+
+}
@@ -0,0 +1,141 @@
+/*                            Project title
+ *
+ *
+ * Source Code Name   :   olsr_udp_transport.hpp
+ *
+ * Description        :   To store the Linux UDP transport of an olsr instance .
+ *
+ * Subsystem Name     :   OLSR
+ *
+ * Revision History
+ * ---------------------------------------------------------------------------|
+ * Version | Change Description               |    Date    |    Changed By    |
+ * --------|----------------------------------|------------|------------------|
+ * 1.0     |Initial Version                   | 19-10-2026 |Shreehari H K     |
+ * --------|----------------------------------|------------|------------------|
+ *
+ *                              Copyright statement
+ *
+ *
+ */
+
+#ifndef OLSR_UDP_TRANSPORT_HPP_
+#define OLSR_UDP_TRANSPORT_HPP_
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include "olsr.hpp"                  /* Include file for olsr instance */
+
+namespace ns_olsr2_0
+{
+#define M_UDP_BATCH_SIZE        64          /* Datagrams moved by one recvmmsg/sendmmsg call */
+#define M_UDP_LINK_METRIC       1.0         /* In link metric given to packets received over UDP */
+
+  /**
+   * Counters of the UDP transport
+   */
+  typedef struct
+  {
+    T_UINT64 rx_packets;                /* Datagrams received */
+    T_UINT64 rx_bytes;                  /* Bytes received */
+    T_UINT64 rx_batches;                /* recvmmsg calls returning datagrams */
+    T_UINT64 rx_dropped;                /* Truncated or unknown sender datagrams */
+    T_UINT64 tx_packets;                /* Datagrams sent */
+    T_UINT64 tx_bytes;                  /* Bytes sent */
+    T_UINT64 tx_batches;                /* sendmmsg calls */
+    T_UINT64 tx_errors;                 /* Datagrams the socket refused */
+  }T_UDP_TRANSPORT_COUNTERS;
+
+  /**
+   * Transport of one OLSR instance over a UDP socket on the loopback
+   * or a veth interface. Each node listens on base_port plus its
+   * address, so the sender of a datagram is known from its port.
+   */
+  class C_UDP_TRANSPORT : public C_OLSR_TRANSPORT
+  {
+
+  public:
+    C_UDP_TRANSPORT(C_OLSR* node, T_UINT16 base_port, in_addr_t bind_addr = htonl(INADDR_LOOPBACK));
+
+    ~C_UDP_TRANSPORT();
+
+    T_BOOL open_socket(void);           /* Opens, binds and registers the socket to epoll */
+
+    void close_socket(void);            /* Closes the socket and epoll descriptors */
+
+    void add_peer(const T_NODE_ADDRESS& peer_address, in_addr_t peer_ip = htonl(INADDR_LOOPBACK));  /* Adds a 1-hop neighbor */
+
+    void send_packet(const T_NODE_ADDRESS& sender_address, const C_PACKET_HEADER& olsr_packet);
+
+    T_UINT32 flush(void);               /* Sends the pending datagrams and returns their count */
+
+    T_UINT32 poll(int timeout_ms);      /* Waits for datagrams and hands them to the instance */
+
+    void run_once(void);                /* Sleeps until the next timer or datagram and runs the instance */
+
+    void set_capture(T_BOOL capture);   /* Keeps the packets sent from now on for the replay, instead of sending them */
+
+    T_UINT32 replay(void);              /* Sends one batch of the kept packets renumbered, returns the datagrams sent */
+
+    static T_UINT16 get_node_port(T_UINT16 base_port, const T_NODE_ADDRESS& node_address);
+
+    const T_UDP_TRANSPORT_COUNTERS&
+    get_counters () const
+    {
+      return m_counters;
+    }
+
+    int
+    get_socket_fd () const
+    {
+      return m_socket_fd;
+    }
+
+  private:
+
+    C_OLSR* m_node;                     /* Instance using the transport */
+
+    T_UINT16 m_base_port;               /* Port of the node address 0.0 */
+
+    in_addr_t m_bind_addr;              /* Local IPv4 address */
+
+    int m_socket_fd;                    /* UDP socket */
+
+    int m_epoll_fd;                     /* epoll instance watching the socket */
+
+    std::vector<struct sockaddr_in> m_peers;                            /* 1-hop neighbors */
+
+    std::array<C_OLSR::T_RX_PACKET, M_UDP_BATCH_SIZE> m_rx_slots;       /* Pre allocated receive buffers */
+
+    std::array<struct mmsghdr, M_UDP_BATCH_SIZE> m_rx_msgs;             /* recvmmsg headers */
+
+    std::array<struct iovec, M_UDP_BATCH_SIZE> m_rx_iov;                /* Receive buffer of each datagram */
+
+    std::array<struct sockaddr_in, M_UDP_BATCH_SIZE> m_rx_addr;         /* Source of each datagram */
+
+    std::array<C_PACKET_HEADER, M_UDP_BATCH_SIZE> m_tx_packets;         /* Pre allocated send buffers */
+
+    std::array<struct iovec, M_UDP_BATCH_SIZE> m_tx_iov;                /* Send buffer of each packet */
+
+    std::array<struct mmsghdr, M_UDP_BATCH_SIZE> m_tx_msgs;             /* sendmmsg headers, one per packet and peer */
+
+    T_UINT32 m_tx_packet_count;         /* Packets waiting in m_tx_packets */
+
+    T_UINT32 m_tx_msg_count;            /* Datagrams waiting in m_tx_msgs */
+
+    T_UDP_TRANSPORT_COUNTERS m_counters;
+
+    T_BOOL m_capture;                   /* True while the packets sent are kept instead of sent */
+
+    std::vector<C_PACKET_HEADER> m_replay_packets;      /* Packets kept for the replay */
+
+    T_UINT32 m_replay_next;             /* Kept packet replayed next */
+
+    T_UINT16 m_replay_seq_num;          /* Sequence number of the last replayed message */
+
+    T_UINT32 receive_batch(void);       /* Drains one recvmmsg batch */
+  };
+
+}
+
+#endif /* OLSR_UDP_TRANSPORT_HPP_ */
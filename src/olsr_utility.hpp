@@ -36,6 +36,8 @@ typedef float  T_FLOAT;
 
 typedef unsigned long int  T_UINT64;
 
+typedef long int  T_INT64;
+
 }
 
 #endif /* OLSR_UTILITY_HPP_ */